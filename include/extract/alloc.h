@@ -16,6 +16,13 @@
 
 #include <stdlib.h>
 
+#if defined(_MSC_VER) && (_MSC_VER < 1700) /* MSVC older than VS2012 */
+	typedef unsigned __int64 extract_uint64_t;
+#else
+	#include <stdint.h>
+	typedef uint64_t extract_uint64_t;
+#endif
+
 /*
 	Abstract allocator, created by extract_alloc_create().
 */
@@ -81,22 +88,88 @@ int extract_realloc(extract_alloc_t *alloc, void **pptr, size_t newsize);
 */
 void extract_free(extract_alloc_t *alloc, void **pptr);
 
+/*
+	Categories for allocations, used by extract_alloc_stats_t when
+	accounting is enabled with extract_alloc_accounting().
+*/
+typedef enum
+{
+	extract_alloc_category_OTHER,
+	extract_alloc_category_CHARS,       /* Chars within spans. */
+	extract_alloc_category_CONTENT,     /* Pages, spans, lines, paragraphs, tables etc. */
+	extract_alloc_category_TABLELINES,  /* Lines that might define tables. */
+	extract_alloc_category_OUTPUT,      /* Generated content and other strings. */
+	extract_alloc_category_IMAGES,      /* Image data and lists of images. */
+	extract_alloc_category_ZIP,         /* Zip archive state and compression. */
+	extract_alloc_category_XML,         /* Parsing of XML. */
+	extract_alloc_category_NUM
+} extract_alloc_category_t;
+
+/* Returns name of <category>, e.g. "tablelines". */
+const char *extract_alloc_category_name(extract_alloc_category_t category);
+
+/*
+	Like extract_malloc(), extract_realloc() and extract_realloc2() but
+	with explicit category for accounting. The category of an existing block
+	does not change when it is reallocated.
+*/
+int extract_malloc_category(extract_alloc_t *alloc, extract_alloc_category_t category, void **pptr, size_t size);
+int extract_realloc_category(extract_alloc_t *alloc, extract_alloc_category_t category, void **pptr, size_t newsize);
+int extract_realloc2_category(extract_alloc_t *alloc, extract_alloc_category_t category, void **pptr, size_t oldsize, size_t newsize);
+
+/*
+	Category used by the extract_malloc() etc macros. Source files can define
+	this before including any extract headers to set the category of all of
+	their allocations.
+*/
+#ifndef extract_alloc_CATEGORY
+	#define extract_alloc_CATEGORY extract_alloc_category_OTHER
+#endif
+
 /* These allow callers to use any pointer type, not just void*. */
-#define extract_malloc(alloc, pptr, size)     (extract_malloc) (alloc, (void**)pptr, size)
-#define extract_realloc(alloc, pptr, newsize) (extract_realloc)(alloc, (void**)pptr, newsize)
+#define extract_malloc(alloc, pptr, size)     (extract_malloc_category) (alloc, extract_alloc_CATEGORY, (void**)pptr, size)
+#define extract_realloc(alloc, pptr, newsize) (extract_realloc_category)(alloc, extract_alloc_CATEGORY, (void**)pptr, newsize)
 #define extract_free(alloc, pptr)             (extract_free)   (alloc, (void**)pptr)
 
+#define extract_malloc_category(alloc, category, pptr, size) \
+		(extract_malloc_category)(alloc, category, (void**)pptr, size)
+#define extract_realloc_category(alloc, category, pptr, newsize) \
+		(extract_realloc_category)(alloc, category, (void**)pptr, newsize)
+#define extract_realloc2_category(alloc, category, pptr, oldsize, newsize) \
+		(extract_realloc2_category)(alloc, category, (void**)pptr, oldsize, newsize)
+
+/* Byte counts for a category of allocations. */
+typedef struct
+{
+	extract_uint64_t bytes_total;       /* Sum of allocation sizes and increases in size. */
+	extract_uint64_t bytes_current;
+	extract_uint64_t bytes_peak;
+} extract_alloc_bytes_t;
+
 typedef struct
 {
-	int num_malloc;
-	int num_realloc;
-	int num_free;
-	int num_libc_realloc;
+	extract_uint64_t num_malloc;
+	extract_uint64_t num_realloc;
+	extract_uint64_t num_free;
+	extract_uint64_t num_libc_realloc;
+
+	/* Only updated if accounting is enabled, see extract_alloc_accounting().
+	.bytes[extract_alloc_category_NUM] is the total for all categories; its
+	peak is the peak of the total, not the sum of peaks. */
+	extract_alloc_bytes_t bytes[extract_alloc_category_NUM + 1];
 } extract_alloc_stats_t;
 
 /* Retrieve statistics. */
 extract_alloc_stats_t *extract_alloc_stats(extract_alloc_t *alloc);
 
+/*
+	Enables accounting of bytes allocated, for each category. This stores
+	the size and category in front of each block, so must be called before
+	any allocations are made with <alloc>; otherwise returns -1 with
+	errno=EINVAL.
+*/
+int extract_alloc_accounting(extract_alloc_t *alloc);
+
 /*
 	A realloc variant that takes the existing buffer size.
 
@@ -108,7 +181,7 @@ extract_alloc_stats_t *extract_alloc_stats(extract_alloc_t *alloc);
 */
 int extract_realloc2(extract_alloc_t *alloc, void **pptr, size_t oldsize, size_t newsize);
 
-#define extract_realloc2(alloc, pptr, oldsize, newsize) (extract_realloc2)(alloc, (void**) pptr, oldsize, newsize)
+#define extract_realloc2(alloc, pptr, oldsize, newsize) (extract_realloc2_category)(alloc, extract_alloc_CATEGORY, (void**) pptr, oldsize, newsize)
 
 void extract_alloc_exp_min(extract_alloc_t *alloc, size_t size);
 
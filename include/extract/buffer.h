@@ -55,6 +55,40 @@ extract_buffer_read(extract_buffer_t *buffer,
 			size_t	     *o_actual);
 
 
+/*
+	Reads the next chunk of data from a read buffer without copying it if
+	possible, for callers that want to scan data in place.
+
+	If the buffer has a cache, *o_data is set to point to all unread data in
+	the cache (first repopulating the cache if it is empty). Otherwise we read
+	up to <scratch_size> bytes into <scratch> and set *o_data to <scratch>.
+
+	The returned data is marked as read and is only valid until the next
+	read from <buffer>.
+
+	Returns 0 with *o_numbytes non-zero, or +1 with *o_numbytes=0 if EOF, or
+	-1 with errno set.
+*/
+int extract_buffer_read_chunk(extract_buffer_t *buffer,
+			void	     *scratch,
+			size_t	      scratch_size,
+			const void  **o_data,
+			size_t	     *o_numbytes);
+
+
+/*
+	If all unread data in a read buffer is in memory, as with buffers from
+	extract_buffer_open_simple() and extract_buffer_open_mmap(), sets *o_data
+	and *o_numbytes to refer to it and marks it as read. The data remains
+	valid until the buffer is closed.
+
+	Otherwise returns -1 with errno=ENOTSUP, without reading anything.
+*/
+int extract_buffer_read_remaining(extract_buffer_t *buffer,
+			const void  **o_data,
+			size_t	     *o_numbytes);
+
+
 /*
 	Write specified data into buffer. Returns +1 if short write due to EOF.
 
@@ -276,6 +310,26 @@ int extract_buffer_open_file(extract_alloc_t      *alloc,
 				extract_buffer_t **o_buffer);
 
 
+/*
+	Creates a read buffer for a file by memory-mapping the whole file and
+	using the mapping as the buffer's cache, so extract_buffer_read() and
+	extract_buffer_read_chunk() never need to copy data via a callback.
+
+	Falls back to extract_buffer_open_file() if the file is not a regular
+	file or cannot be mapped, e.g. on platforms without mmap().
+
+	The returned buffer must only be used for reading.
+
+	path:
+		Path of file to read from.
+	o_buffer:
+		Out-param. Set to NULL on error.
+*/
+int extract_buffer_open_mmap(extract_alloc_t      *alloc,
+				const char        *path,
+				extract_buffer_t **o_buffer);
+
+
 /*
 	A write buffer that writes to an automatically-growing
 	contiguous area of memory.
@@ -163,6 +163,50 @@ int extract_add_image(
 		void                    *data_free_handle);
 
 
+/* Callback for fetching image data. See extract_add_image_lazy(). Should set
+*o_data to point to the image data and return 0, or return -1 with errno set.
+*/
+typedef int (extract_image_fetch)(void *handle, void **o_data);
+
+/*
+	Like extract_add_image() except that image data is not supplied now;
+	instead fetch(fetch_handle, &data) is called when the data is needed by
+	extract_write(), and data_free(data_free_handle, data) is called
+	immediately after the data has been used. So at most one image's data
+	is in memory at any time.
+
+	type
+		E.g. 'png'. Is copied so no need to persist after we return.
+	x y w h
+		Location and size of image.
+	data_size
+		Size of the data that <fetch> will return.
+	fetch fetch_handle
+		Callback for fetching the data; <fetch_handle> must persist for at
+		least the lifetime of <extract>.
+	data_free data_free_handle
+		If not NULL, called to release data returned by <fetch>.
+
+	Images with the same <type> and data are written only once, as with
+	extract_add_image(). To find such repeated images, <fetch> is also called
+	by extract_add_image_lazy() itself, and for any earlier image whose data
+	has the same hash, with the data released again immediately after
+	comparing.
+*/
+int extract_add_image_lazy(
+		extract_t               *extract,
+		const char              *type,
+		double                   x,
+		double                   y,
+		double                   w,
+		double                   h,
+		size_t                   data_size,
+		extract_image_fetch     *fetch,
+		void                    *fetch_handle,
+		extract_image_data_free *data_free,
+		void                    *data_free_handle);
+
+
 /* Adds a four-element path. Paths that define thin vertical/horizontal
 rectangles are used to find tables. */
 int extract_add_path4(
@@ -362,9 +406,35 @@ int extract_process(
 	Write output document to buffer.
 
 	For docx and odt, uses an internal template document.
+
+	If extract_set_stream() has been called, content has already been written
+	by extract_process() so we just write any trailing data (e.g. closing
+	brace for json) to the stream buffer, and <buffer> is ignored.
 */
 int extract_write(extract_t *extract, extract_buffer_t *buffer);
 
+/*
+	Also generate output in each of formats[0..formats_num) as well as the
+	format passed to extract_begin(). Each call to extract_process() then joins
+	the current pages once and generates content for every format, so a
+	document can be converted to several formats without being read or
+	analysed more than once.
+
+	Must be called before the first call of extract_process(). Formats that
+	are already being generated are ignored.
+
+	Per-page callbacks (extract_set_page_content_fn()) and streaming
+	(extract_set_stream()) only apply to the format passed to extract_begin().
+*/
+int extract_set_formats(extract_t *extract, const extract_format_t *formats, int formats_num);
+
+/*
+	Like extract_write() but writes output for <format>, which must be the
+	format passed to extract_begin() or one passed to extract_set_formats().
+	Otherwise returns -1 with errno=EINVAL.
+*/
+int extract_write_format(extract_t *extract, extract_format_t format, extract_buffer_t *buffer);
+
 
 /*
 	Writes paragraph content only into buffer.
@@ -380,19 +450,18 @@ int extract_write_content(extract_t *extract, extract_buffer_t *buffer);
 	Like extract_write() but uses a provided template document. Only works with
 	docx and odt output.
 
-	Uses the 'zip' and 'unzip' commands internally.
+	The template is read in memory; items that contain content are modified
+	and all other items are copied directly without recompression.
 
 	extract:
 		.
 	path_template:
 		Name of docx/odt file to use as a template.
 	path_out:
-		Name of docx/odt file to create. Must not contain single-quote, double
-		quote, space or ".." sequence - these will force EINVAL error because they
-		could make internal shell commands unsafe.
+		Name of docx/odt file to create.
 	preserve_dir:
-		If true, we don't delete the temporary directory <path_out>.dir containing
-		the output document contents prior to zipping.
+		Ignored; kept for API compatibility. We no longer create a temporary
+		directory.
 */
 int extract_write_template(
 		extract_t  *extract,
@@ -408,6 +477,139 @@ void extract_end(extract_t **pextract);
 /* Enables/Disables the layout analysis phase. */
 int extract_set_layout_analysis(extract_t *extract, int enable);
 
+/*
+	Makes extract move pending content and image data to a temporary file in
+	<dir> once more than <threshold> bytes are pending, so that memory usage
+	stays bounded for very large documents.
+
+	Image data is moved as images are added if it would take the pending
+	total above <threshold>; content is moved at the end of
+	extract_process(). Data is read back when needed by extract_write(); for
+	docx and odt output the content is read back into memory as a whole, but
+	images are read back one at a time.
+
+	Only image data that extract owns (i.e. passed to extract_add_image() with
+	non-NULL data_free) is moved.
+
+	extract:
+		.
+	dir:
+		Directory in which to create the temporary file, or NULL to disable.
+		Is copied so no need to persist after we return.
+	threshold:
+		Number of bytes of pending data above which we use the temporary file.
+*/
+int extract_set_spill(extract_t *extract, const char *dir, size_t threshold);
+
+/*
+	Makes subsequent calls to extract_page_begin(), extract_span_begin(),
+	extract_add_char(), extract_add_image() etc. also write their arguments to
+	<buffer> in a compact binary intermediate format. The data can later be
+	passed to extract_read_intermediate(), which is much faster than reading
+	the XML intermediate format.
+
+	Calls made by extract_read_intermediate() are also recorded, so this can
+	be used to convert XML intermediate data to binary.
+
+	For extract_add_image_lazy(), the image data is fetched immediately so
+	that it can be written.
+
+	extract:
+		.
+	buffer:
+		Where to write data, or NULL to stop recording. Caller must keep this
+		open until recording is stopped or extract_end() is called, and then
+		close it.
+*/
+int extract_set_record(extract_t *extract, extract_buffer_t *buffer);
+
+/*
+	Makes extract_read_intermediate() use up to <threads> threads when reading
+	XML intermediate data that is entirely in memory, e.g. from
+	extract_buffer_open_mmap() or extract_buffer_open_simple().
+
+	The data is split into ranges of whole pages, each of which is parsed on a
+	separate thread; the resulting pages are added to the document in their
+	original order, so output is the same as with a single thread.
+
+	Only the parsing of XML is done in parallel. Each thread converts its
+	range to binary intermediate data, which the calling thread then reads to
+	build the pages, so this reading is not parallelised. It takes roughly a
+	quarter of the time of reading XML on a single thread, which limits the
+	speedup. Joining and output generation in extract_process() always use a
+	single thread.
+
+	Has no effect unless extract was compiled with EXTRACT_THREADS defined,
+	which requires pthreads, so has no effect on Windows. Default is 1.
+*/
+int extract_set_threads(extract_t *extract, int threads);
+
+/*
+	Callback for receiving content of each page; see
+	extract_set_page_content_fn().
+
+	handle:
+		As passed to extract_set_page_content_fn().
+	page_index:
+		Index of page, starting at zero for the first page passed to the first
+		call of extract_process().
+	data:
+	data_length:
+		The page's content in the output format, e.g. an html <div> element,
+		json elements or docx/odt body xml. Not zero-terminated; only valid
+		until the callback returns.
+
+		This never includes anything that separates pages or wraps the whole
+		document, so the same framing applies to all formats: the document
+		written by extract_write() is a header, then each page's content,
+		then a trailer. For json the header is '{"elements" : [' and the
+		trailer is ']}' (plus newlines), and non-empty pages are separated by
+		",\n"; a page's content is its elements separated by ",\n", so it is
+		a valid json array if enclosed in '[...]'. For other formats there is
+		no separator between pages.
+
+	Should return 0 on success or -1 with errno set, in which case
+	extract_process() will fail.
+*/
+typedef int (extract_page_content_fn)(
+		void       *handle,
+		int         page_index,
+		const char *data,
+		size_t      data_length);
+
+/*
+	Makes extract_process() call <fn> with the content of each page as soon
+	as it has been generated.
+
+	extract:
+		.
+	fn:
+		Callback, or NULL to disable.
+	handle:
+		Passed to <fn>.
+	keep:
+		If zero, content is discarded after being passed to <fn>, so
+		extract_write() will not include it. Otherwise content is also kept for
+		extract_write() as usual.
+*/
+int extract_set_page_content_fn(
+		extract_t               *extract,
+		extract_page_content_fn *fn,
+		void                    *handle,
+		int                      keep);
+
+/*
+	Makes each extract_process() call write its content directly to <buffer>
+	and then free it, instead of accumulating all content in memory until
+	extract_write(). Only supported for html, text and json output; returns
+	-1 with errno=EINVAL for other formats.
+
+	Must be called before the first call of extract_process(). Caller must
+	still call extract_write() to finish the output, and should keep <buffer>
+	open until then.
+*/
+int extract_set_stream(extract_t *extract, extract_buffer_t *buffer);
+
 /* Things below are not generally used. */
 
 /*
@@ -420,12 +622,189 @@ int extract_tables_csv_format(extract_t *extract, const char *path_format);
 	Reads XML specification of spans and images from <buffer> and adds to
 	<extract>.
 
+	Also accepts the binary intermediate format written by
+	extract_set_record(); this is detected automatically.
+
 	(Makes internal calls to extract_span_begin(), extract_add_image() etc.)
 */
 int extract_read_intermediate(
 		extract_t        *extract,
 		extract_buffer_t *buffer);
 
+/*
+	Like extract_read_intermediate() followed by extract_process(), but
+	processes and frees pages while reading, so that memory used for pages
+	does not grow with the length of the document. Output is the same as
+	with a single call to extract_process() after reading everything.
+
+	Pending pages are processed after a page once there are at least
+	<max_pages> pending pages or at least <max_chars> pending chars. A zero
+	value disables that limit.
+
+	Generated content itself is still accumulated until the end.
+*/
+int extract_read_intermediate_process(
+		extract_t        *extract,
+		extract_buffer_t *buffer,
+		int               spacing,
+		int               rotation,
+		int               images,
+		int               max_pages,
+		size_t            max_chars);
+
+
+/*
+	Stages whose times are recorded in extract_stats_t.
+
+	Stages can nest, e.g. extract_stage_BUFFER_IO time spent writing
+	compressed data is also included in extract_stage_ZIP, and
+	extract_stage_MAKE_LINES time for table cells is also included in
+	extract_stage_TABLE_FILL.
+
+	extract_stage_INGEST:
+		extract_read_intermediate(), including any processing done by
+		extract_read_intermediate_process().
+	extract_stage_BOXER:
+		Layout analysis of pages, see extract_enable_analysis().
+	extract_stage_TABLE_SORT:
+		Sorting of lines that might form tables.
+	extract_stage_TABLE_FILL:
+		Finding and joining text within table cells.
+	extract_stage_MAKE_LINES:
+	extract_stage_MAKE_PARAGRAPHS:
+	extract_stage_ANALYSE_PARAGRAPHS:
+	extract_stage_ROTATED_BLOCKS:
+		Joining spans into lines, lines into paragraphs etc.
+	extract_stage_FORMAT:
+		Generating content in the output formats.
+	extract_stage_IMAGES:
+		Collecting images for output.
+	extract_stage_ZIP:
+		Compressing data for docx/odt output.
+	extract_stage_BUFFER_IO:
+		Calls to the read/write/cache functions of buffers passed to
+		extract_read_intermediate() and extract_write*().
+*/
+typedef enum
+{
+	extract_stage_INGEST,
+	extract_stage_BOXER,
+	extract_stage_TABLE_SORT,
+	extract_stage_TABLE_FILL,
+	extract_stage_MAKE_LINES,
+	extract_stage_MAKE_PARAGRAPHS,
+	extract_stage_ANALYSE_PARAGRAPHS,
+	extract_stage_ROTATED_BLOCKS,
+	extract_stage_FORMAT,
+	extract_stage_IMAGES,
+	extract_stage_ZIP,
+	extract_stage_BUFFER_IO,
+	extract_stage_NUM
+} extract_stage_t;
+
+/* Returns name of <stage>, e.g. "make_lines". */
+const char *extract_stage_name(extract_stage_t stage);
+
+/* Cumulative times for a stage, in seconds. */
+typedef struct
+{
+	double wall;
+	double cpu;     /* Process CPU time, so includes other threads. */
+	int    calls;
+} extract_stats_time_t;
+
+/*
+	Statistics gathered by an extract_t, see extract_set_stats().
+
+	Counts of spans, lines etc are of the items found by extract_process(),
+	including those inside table cells.
+*/
+typedef struct
+{
+	extract_stats_time_t times[extract_stage_NUM];
+
+	long    chars;
+	long    spans;
+	long    spans_split;        /* Spans split because of a change in ctm etc. */
+	long    spans_autosplit;    /* Spans split because of a gap between chars. */
+	long    lines;
+	long    paragraphs;
+	long    tables;
+	long    images;
+	size_t  bytes_written;      /* To buffers passed to extract_write*(). */
+} extract_stats_t;
+
+/*
+	Enables or disables gathering of statistics. Enabling resets all
+	statistics to zero. When disabled (the default), there is no overhead.
+*/
+int extract_set_stats(extract_t *extract, int enable);
+
+/*
+	Returns statistics gathered since extract_set_stats() was last called
+	with enable=1, or NULL if not enabled. Only valid until the next call of
+	extract_set_stats() or extract_end().
+*/
+const extract_stats_t *extract_stats(extract_t *extract);
+
+/*
+	Callback for receiving trace events; see extract_set_trace().
+
+	handle:
+		As passed to extract_set_trace().
+	name:
+		Name of a stage as returned by extract_stage_name(), or one of:
+			"process"       A call of extract_process().
+			"join"          Joining spans into lines, paragraphs and tables.
+			"page"          Joining a single page.
+			"join_subpage"  Joining a single subpage.
+			"write"         A call of extract_write() or extract_write_format().
+	begin:
+		1 at the start of <name>, 0 at the end. Events nest properly, also
+		if there is an error.
+	page:
+		Index of the page being processed, as passed to the
+		extract_page_content_fn, or -1 if not specific to a page.
+	time:
+		Wall clock time in seconds, from an arbitrary origin.
+*/
+typedef void (extract_trace_fn)(
+		void       *handle,
+		const char *name,
+		int         begin,
+		int         page,
+		double      time);
+
+/*
+	Makes <extract> call fn() at the beginning and end of each stage of
+	processing. <fn> can be NULL to disable tracing.
+*/
+int extract_set_trace(extract_t *extract, extract_trace_fn *fn, void *handle);
+
+/*
+	Built-in trace writer that writes Chrome trace-event JSON, which can be
+	viewed with chrome://tracing or https://ui.perfetto.dev. Use like:
+
+		extract_trace_chrome_t *chrome;
+		extract_trace_chrome_open(buffer, &chrome);
+		extract_set_trace(extract, extract_trace_chrome, chrome);
+		...
+		extract_set_trace(extract, NULL, NULL);
+		extract_trace_chrome_close(&chrome);
+*/
+typedef struct extract_trace_chrome_t extract_trace_chrome_t;
+
+/* Writes the start of the JSON to <buffer>. <buffer> must remain open until
+extract_trace_chrome_close(). */
+int extract_trace_chrome_open(extract_buffer_t *buffer, extract_trace_chrome_t **o_chrome);
+
+/* An extract_trace_fn; <handle> must be from extract_trace_chrome_open(). */
+void extract_trace_chrome(void *handle, const char *name, int begin, int page, double time);
+
+/* Writes the end of the JSON and frees *pchrome. Does not close the buffer.
+Fails if any earlier write failed. */
+int extract_trace_chrome_close(extract_trace_chrome_t **pchrome);
+
 
 /*
 	Cleans up internal singelton state that can look like a memory leak when
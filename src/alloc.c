@@ -12,6 +12,32 @@ struct extract_alloc_t
 	extract_caller_context_t *realloc_state;
 	size_t                    exp_min_alloc_size;
 	extract_alloc_stats_t     stats;
+	int                       accounting;
+};
+
+/* If accounting is enabled, this is stored in front of each block. The union
+ensures that the block itself is suitably aligned. */
+typedef union
+{
+	struct
+	{
+		size_t                    size;
+		extract_alloc_category_t  category;
+	} info;
+	long double  align_ld;
+	void        *align_p;
+} header_t;
+
+static const char *s_category_names[] =
+{
+	"other",
+	"chars",
+	"content",
+	"tablelines",
+	"output",
+	"images",
+	"zip",
+	"xml"
 };
 
 int
@@ -45,6 +71,73 @@ extract_alloc_stats_t *extract_alloc_stats(extract_alloc_t *alloc)
 	return &alloc->stats;
 }
 
+int extract_alloc_accounting(extract_alloc_t *alloc)
+{
+	if (alloc->stats.num_malloc || alloc->stats.num_realloc)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	alloc->accounting = 1;
+	return 0;
+}
+
+const char *extract_alloc_category_name(extract_alloc_category_t category)
+{
+	if ((int) category < 0 || category >= extract_alloc_category_NUM) return "?";
+	return s_category_names[category];
+}
+
+/* Updates byte counts for a block of <category> changing size from <oldsize>
+to <newsize>. */
+static void s_bytes_update(extract_alloc_bytes_t *bytes, size_t oldsize, size_t newsize)
+{
+	if (newsize > oldsize) bytes->bytes_total += newsize - oldsize;
+	bytes->bytes_current += newsize;
+	bytes->bytes_current -= oldsize;
+	if (bytes->bytes_current > bytes->bytes_peak) bytes->bytes_peak = bytes->bytes_current;
+}
+
+static void s_account(extract_alloc_t *alloc, extract_alloc_category_t category, size_t oldsize, size_t newsize)
+{
+	s_bytes_update(&alloc->stats.bytes[category], oldsize, newsize);
+	s_bytes_update(&alloc->stats.bytes[extract_alloc_category_NUM], oldsize, newsize);
+}
+
+/* Reallocates *pptr using a header_t; only used if alloc->accounting is set.
+*pptr is unchanged if we fail. */
+static int s_realloc_accounting(extract_alloc_t *alloc, extract_alloc_category_t category, void **pptr, size_t newsize)
+{
+	header_t *header = NULL;
+	size_t    oldsize = 0;
+
+	if (*pptr)
+	{
+		header = (header_t *) *pptr - 1;
+		oldsize = header->info.size;
+		category = header->info.category;
+	}
+	if (newsize == 0)
+	{
+		if (header) (void) alloc->realloc_fn(alloc->realloc_state, header, 0);
+		*pptr = NULL;
+	}
+	else
+	{
+		header = alloc->realloc_fn(alloc->realloc_state, header, sizeof(*header) + newsize);
+		if (!header)
+		{
+			errno = ENOMEM;
+			return -1;
+		}
+		header->info.size = newsize;
+		header->info.category = category;
+		*pptr = header + 1;
+	}
+	s_account(alloc, category, oldsize, newsize);
+	return 0;
+}
+
 static size_t round_up(extract_alloc_t *alloc, size_t n)
 {
 	size_t ret;
@@ -64,11 +157,18 @@ static size_t round_up(extract_alloc_t *alloc, size_t n)
 	return ret;
 }
 
-int (extract_malloc)(extract_alloc_t *alloc, void **pptr, size_t size)
+int (extract_malloc_category)(extract_alloc_t *alloc, extract_alloc_category_t category, void **pptr, size_t size)
 {
 	void *p;
 
 	size = round_up(alloc, size);
+	if (alloc && alloc->accounting)
+	{
+		*pptr = NULL;
+		if (s_realloc_accounting(alloc, category, pptr, size)) return -1;
+		alloc->stats.num_malloc += 1;
+		return 0;
+	}
 	p = (alloc) ? alloc->realloc_fn(alloc->realloc_state, NULL, size) : malloc(size);
 	*pptr = p;
 	if (!p && size)
@@ -80,9 +180,22 @@ int (extract_malloc)(extract_alloc_t *alloc, void **pptr, size_t size)
 	return 0;
 }
 
-int (extract_realloc)(extract_alloc_t *alloc, void **pptr, size_t newsize)
+int (extract_malloc)(extract_alloc_t *alloc, void **pptr, size_t size)
+{
+	return (extract_malloc_category)(alloc, extract_alloc_category_OTHER, pptr, size);
+}
+
+int (extract_realloc_category)(extract_alloc_t *alloc, extract_alloc_category_t category, void **pptr, size_t newsize)
 {
-	void *p = (alloc) ? alloc->realloc_fn(alloc->realloc_state, *pptr, newsize) : realloc(*pptr, newsize);
+	void *p;
+
+	if (alloc && alloc->accounting)
+	{
+		if (s_realloc_accounting(alloc, category, pptr, newsize)) return -1;
+		alloc->stats.num_realloc += 1;
+		return 0;
+	}
+	p = (alloc) ? alloc->realloc_fn(alloc->realloc_state, *pptr, newsize) : realloc(*pptr, newsize);
 	if (!p && newsize)
 	{
 		if (alloc) errno = ENOMEM;
@@ -93,19 +206,31 @@ int (extract_realloc)(extract_alloc_t *alloc, void **pptr, size_t newsize)
 	return 0;
 }
 
-int (extract_realloc2)(extract_alloc_t *alloc, void **pptr, size_t oldsize, size_t newsize)
+int (extract_realloc)(extract_alloc_t *alloc, void **pptr, size_t newsize)
+{
+	return (extract_realloc_category)(alloc, extract_alloc_category_OTHER, pptr, newsize);
+}
+
+int (extract_realloc2_category)(extract_alloc_t *alloc, extract_alloc_category_t category, void **pptr, size_t oldsize, size_t newsize)
 {
 	/* We ignore <oldsize> if <ptr> is NULL - allows callers to not worry
 	about edge cases e.g. with strlen+1. */
 	oldsize = (*pptr) ? round_up(alloc, oldsize) : 0;
 	newsize = round_up(alloc, newsize);
 	if (newsize == oldsize) return 0;
-	return (extract_realloc)(alloc, pptr, newsize);
+	return (extract_realloc_category)(alloc, category, pptr, newsize);
+}
+
+int (extract_realloc2)(extract_alloc_t *alloc, void **pptr, size_t oldsize, size_t newsize)
+{
+	return (extract_realloc2_category)(alloc, extract_alloc_category_OTHER, pptr, oldsize, newsize);
 }
 
 void (extract_free)(extract_alloc_t *alloc, void **pptr)
 {
-	if (alloc)
+	if (alloc && alloc->accounting)
+		(void) s_realloc_accounting(alloc, extract_alloc_category_OTHER, pptr, 0);
+	else if (alloc)
 		(void)alloc->realloc_fn(alloc->realloc_state, *pptr, 0);
 	else
 		free(*pptr);
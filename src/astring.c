@@ -1,7 +1,12 @@
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_OUTPUT
+
 #include "astring.h"
 #include "mem.h"
 #include "memento.h"
 
+#include "compat_stdint.h"
+
 #include <assert.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -13,6 +18,7 @@ void extract_astring_init(extract_astring_t *string)
 {
 	string->chars = NULL;
 	string->chars_num = 0;
+	string->chars_max = 0;
 }
 
 void extract_astring_free(extract_alloc_t *alloc, extract_astring_t *string)
@@ -22,11 +28,36 @@ void extract_astring_free(extract_alloc_t *alloc, extract_astring_t *string)
 }
 
 
+int extract_astring_reserve_category(
+		extract_alloc_t          *alloc,
+		extract_alloc_category_t  category,
+		extract_astring_t        *string,
+		size_t                    len)
+{
+	size_t n = string->chars_num + len + 1;
+	size_t chars_max;
+
+	if (n <= string->chars_max)
+		return 0;
+	chars_max = (string->chars_max) ? string->chars_max : 64;
+	while (chars_max < n)
+		chars_max *= 2;
+	if (extract_realloc_category(alloc, category, &string->chars, chars_max))
+		return -1;
+	string->chars_max = chars_max;
+	return 0;
+}
+
+int extract_astring_reserve(extract_alloc_t *alloc, extract_astring_t *string, size_t len)
+{
+	return extract_astring_reserve_category(alloc, extract_alloc_CATEGORY, string, len);
+}
+
 int extract_astring_catl(extract_alloc_t *alloc, extract_astring_t *string, const char *s, size_t s_len)
 {
-	if (extract_realloc2(alloc, &string->chars, string->chars_num+1, string->chars_num + s_len + 1))
+	if (extract_astring_reserve(alloc, string, s_len))
 		return -1;
-	/* Coverity doesn't seem to realise that extract_realloc2() modifies
+	/* Coverity doesn't seem to realise that extract_astring_reserve() modifies
 	string->chars. */
 	/* coverity[deref_parm_field_in_call] */
 	memcpy(string->chars + string->chars_num, s, s_len);
@@ -47,18 +78,175 @@ int extract_astring_cat(extract_alloc_t *alloc, extract_astring_t *string, const
 
 int extract_astring_catf(extract_alloc_t *alloc, extract_astring_t *string, const char *format, ...)
 {
-	char    *buffer = NULL;
-	int      e;
-	va_list  va;
+	int     n;
+	size_t  space;
+	va_list va;
 
+	/* First try formatting directly into any spare space, which is usually
+	sufficient. */
+	space = (string->chars) ? string->chars_max - string->chars_num : 0;
 	va_start(va, format);
-	e = extract_vasprintf(alloc, &buffer, format, va);
+	n = vsnprintf(string->chars ? string->chars + string->chars_num : NULL, space, format, va);
 	va_end(va);
-	if (e < 0) return e;
-	e = extract_astring_cat(alloc, string, buffer);
-	extract_free(alloc, &buffer);
+	if (n < 0 || (size_t) n >= space)
+	{
+		/* Restore terminating zero in case vsnprintf() wrote a partial
+		result. */
+		if (string->chars) string->chars[string->chars_num] = 0;
+	}
+	if (n < 0) return n;
+
+	if ((size_t) n >= space)
+	{
+		/* Not enough space so grow and try again. */
+		if (extract_astring_reserve(alloc, string, (size_t) n)) return -1;
+		va_start(va, format);
+		n = vsnprintf(string->chars + string->chars_num, (size_t) n + 1, format, va);
+		va_end(va);
+		if (n < 0) return n;
+	}
+	string->chars_num += (size_t) n;
 
-	return e;
+	return 0;
+}
+
+/* Exact powers of ten. */
+static const double s_pow10[] =
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+};
+
+/* Sets *o_r to <scaled> rounded to nearest integer. Returns -1 if <scaled> is
+too large or too close to a tie for the rounding to be certain to match that
+of the exact decimal expansion of the original value used by printf(). */
+static int s_round(double scaled, uint64_t *o_r)
+{
+	uint64_t    i;
+	double      frac;
+
+	/* Below 2^43, the error from scaling is less than 2^-10. */
+	if (!(scaled < 8.0e12)) return -1;
+	i = (uint64_t) scaled;
+	frac = scaled - (double) i;
+	if (frac > 0.49 && frac < 0.51) return -1;
+	*o_r = i + (frac >= 0.5);
+	return 0;
+}
+
+/* Writes <r> / 10^precision with exactly <precision> decimal places to
+<buffer>, returning number of chars written. */
+static int s_write_fixed(char *buffer, int negative, uint64_t r, int precision)
+{
+	char    digits[32];
+	int     digits_num = 0;
+	int     n = 0;
+
+	do
+	{
+		digits[digits_num++] = (char) ('0' + r % 10);
+		r /= 10;
+	} while (r);
+	while (digits_num <= precision)
+		digits[digits_num++] = '0';
+
+	if (negative) buffer[n++] = '-';
+	while (digits_num)
+	{
+		if (digits_num == precision) buffer[n++] = '.';
+		buffer[n++] = digits[--digits_num];
+	}
+	return n;
+}
+
+/* Formats <d> as if by "%.*f" into <buffer>, returning number of chars written
+or -1 if we can't handle <d>, in which case the caller should use printf(). */
+static int s_format_f(char *buffer, double d, int precision)
+{
+	int         negative = (d < 0 || (d == 0 && 1/d < 0));
+	uint64_t    r;
+
+	if (precision < 0 || precision >= (int) (sizeof(s_pow10) / sizeof(s_pow10[0]))) return -1;
+	if (negative) d = -d;
+	if (s_round(d * s_pow10[precision], &r)) return -1;
+	return s_write_fixed(buffer, negative, r, precision);
+}
+
+/* Formats <d> as if by "%g" into <buffer>, returning number of chars written
+or -1 if we can't handle <d>, in which case the caller should use printf(). */
+static int s_format_g(char *buffer, double d)
+{
+	int         negative = (d < 0 || (d == 0 && 1/d < 0));
+	int         exponent;
+	int         n;
+	int         i;
+	uint64_t    r;
+
+	if (negative) d = -d;
+	if (d == 0)
+	{
+		n = 0;
+		if (negative) buffer[n++] = '-';
+		buffer[n++] = '0';
+		return n;
+	}
+
+	/* %g uses fixed notation with 6-1-exponent decimal places if the
+	exponent, after rounding to 6 significant figures, is in [-4, 6).
+	Otherwise we leave exponential notation to printf(). */
+	if (!(d >= 1e-4 && d < 1e6)) return -1;
+	exponent = 0;
+	while (exponent < 5 && d >= s_pow10[exponent+1])
+		exponent += 1;
+	if (d < 1)
+	{
+		exponent = -1;
+		while (exponent > -4 && d * s_pow10[-exponent] < 1)
+			exponent -= 1;
+	}
+	for (i=0;; ++i)
+	{
+		if (i == 2) return -1;
+		if (s_round(d * s_pow10[5-exponent], &r)) return -1;
+		if (r < 100000)
+		{
+			if (exponent == -4) return -1;
+			exponent -= 1;
+		}
+		else if (r >= 1000000)
+		{
+			if (exponent == 5) return -1;
+			exponent += 1;
+		}
+		else break;
+	}
+
+	n = s_write_fixed(buffer, negative, r, 5-exponent);
+
+	/* Remove trailing zeros and decimal point. */
+	if (5-exponent > 0)
+	{
+		while (buffer[n-1] == '0') n -= 1;
+		if (buffer[n-1] == '.') n -= 1;
+	}
+	return n;
+}
+
+int extract_astring_cat_double_f(extract_alloc_t *alloc, extract_astring_t *string, double d, int precision)
+{
+	char    buffer[64];
+	int     n = s_format_f(buffer, d, precision);
+
+	if (n < 0) return extract_astring_catf(alloc, string, "%.*f", precision, d);
+	return extract_astring_catl(alloc, string, buffer, (size_t) n);
+}
+
+int extract_astring_cat_double_g(extract_alloc_t *alloc, extract_astring_t *string, double d)
+{
+	char    buffer[64];
+	int     n = s_format_g(buffer, d);
+
+	if (n < 0) return extract_astring_catf(alloc, string, "%g", d);
+	return extract_astring_catl(alloc, string, buffer, (size_t) n);
 }
 
 int extract_astring_truncate(extract_astring_t *content, int len)
@@ -206,3 +394,97 @@ int extract_astring_catc_unicode_xml(extract_alloc_t *alloc, extract_astring_t *
 					0 /*ascii_apostrophe*/
 					);
 }
+
+/* XML escape sequences for ASCII characters below 64, matching
+extract_astring_catc_unicode(); NULL for characters that are output verbatim.
+Illegal xml characters are replaced by 0xfffd, the unicode replacement
+character. */
+static const char *s_xml_escapes[64] =
+{
+	"&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;",
+	"&#xfffd;", "&#x9;",    "&#xa;",    "&#xfffd;", "&#xfffd;", "&#xd;",    "&#xfffd;", "&#xfffd;",
+	"&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;",
+	"&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;", "&#xfffd;",
+	NULL,       NULL,       "&quot;",   NULL,       NULL,       NULL,       "&amp;",    "&apos;",
+	NULL,       NULL,       NULL,       NULL,       NULL,       NULL,       NULL,       NULL,
+	NULL,       NULL,       NULL,       NULL,       NULL,       NULL,       NULL,       NULL,
+	NULL,       NULL,       NULL,       NULL,       "&lt;",     NULL,       "&gt;",     NULL,
+};
+
+int extract_astring_cat_unicode_array(
+		extract_alloc_t   *alloc,
+		extract_astring_t *string,
+		const unsigned    *ucs,
+		size_t             ucs_num,
+		size_t             ucs_stride,
+		int                xml,
+		int                ascii_ligatures,
+		int                ascii_dash,
+		int                ascii_apostrophe)
+{
+	const char *p = (const char*) ucs;
+	const char *end = p + ucs_num * ucs_stride;
+
+	if (ucs_num == 0) return 0;
+
+	/* Reserve space for the common case where all characters are ASCII. */
+	if (extract_astring_reserve(alloc, string, ucs_num)) return -1;
+
+	while (p != end)
+	{
+		/* Copy runs of verbatim ASCII characters directly into spare space. */
+		char   *out = string->chars + string->chars_num;
+		char   *out_end = string->chars + string->chars_max - 1;
+		for (; p != end && out != out_end; p += ucs_stride)
+		{
+			unsigned c = *(const unsigned*) p;
+			if (c >= 128) break;
+			if (xml && c < 64 && s_xml_escapes[c]) break;
+			*out++ = (char) c;
+		}
+		string->chars_num = out - string->chars;
+		if (p == end) break;
+
+		/* Handle a single character that needs special treatment. */
+		{
+			unsigned c = *(const unsigned*) p;
+			if (xml && c < 64 && s_xml_escapes[c])
+			{
+				if (extract_astring_cat(alloc, string, s_xml_escapes[c])) return -1;
+			}
+			else if (extract_astring_catc_unicode(
+					alloc,
+					string,
+					(int) c,
+					xml,
+					ascii_ligatures,
+					ascii_dash,
+					ascii_apostrophe
+					)) return -1;
+		}
+		p += ucs_stride;
+	}
+	string->chars[string->chars_num] = 0;
+
+	return 0;
+}
+
+int extract_astring_cat_unicode_array_xml(
+		extract_alloc_t   *alloc,
+		extract_astring_t *string,
+		const unsigned    *ucs,
+		size_t             ucs_num,
+		size_t             ucs_stride)
+{
+	return extract_astring_cat_unicode_array(
+			alloc,
+			string,
+			ucs,
+			ucs_num,
+			ucs_stride,
+			1 /*xml*/,
+			1 /*ascii_ligatures*/,
+			0 /*ascii_dash*/,
+			0 /*ascii_apostrophe*/
+			);
+}
@@ -10,6 +10,7 @@ typedef struct
 {
 	char   *chars;      /* NULL or zero-terminated. */
 	size_t  chars_num;  /* Length of string pointed to by .chars. */
+	size_t  chars_max;  /* Size of buffer pointed to by .chars. */
 } extract_astring_t;
 
 /* Initialises <string> so it is ready for use. */
@@ -19,13 +20,36 @@ void extract_astring_init(extract_astring_t *string);
 extract_astring_init(). */
 void extract_astring_free(extract_alloc_t *alloc, extract_astring_t *string);
 
+/* Ensures that <string> has space for at least <len> more chars plus
+terminating zero. Grows geometrically, so repeated appends do O(log(n))
+allocations. */
+int extract_astring_reserve(extract_alloc_t *alloc, extract_astring_t *string, size_t len);
+
+/* Like extract_astring_reserve(), but if <string> has no buffer yet, the
+allocation is accounted as <category>, which is then kept as <string> grows.
+Otherwise string allocations are accounted as extract_alloc_category_OUTPUT. */
+int extract_astring_reserve_category(
+		extract_alloc_t          *alloc,
+		extract_alloc_category_t  category,
+		extract_astring_t        *string,
+		size_t                    len);
+
 int extract_astring_catl(extract_alloc_t *alloc, extract_astring_t *string, const char *s, size_t s_len);
 
 int extract_astring_catc(extract_alloc_t *alloc, extract_astring_t *string, char c);
 
 int extract_astring_cat(extract_alloc_t *alloc, extract_astring_t *string, const char *s);
+
+/* Appends printf-style formatted text, writing directly into spare space in
+<string> where possible. */
 int extract_astring_catf(extract_alloc_t *alloc, extract_astring_t *string, const char *format, ...);
 
+/* Appends <d> formatted as if by printf("%.*f", precision, d). */
+int extract_astring_cat_double_f(extract_alloc_t *alloc, extract_astring_t *string, double d, int precision);
+
+/* Appends <d> formatted as if by printf("%g", d). */
+int extract_astring_cat_double_g(extract_alloc_t *alloc, extract_astring_t *string, double d);
+
 /* Removes last <len> chars. */
 int extract_astring_truncate(extract_astring_t *content, int len);
 
@@ -57,4 +81,35 @@ int extract_astring_catc_unicode(extract_alloc_t   *alloc,
 /* Appends specific unicode character, using XML escape sequences as required. */
 int extract_astring_catc_unicode_xml(extract_alloc_t *alloc, extract_astring_t *string, int c);
 
+/* Appends <ucs_num> unicode characters, with same behaviour as calling
+extract_astring_catc_unicode() for each one.
+
+	ucs:
+		Pointer to first character.
+	ucs_num:
+		Number of characters.
+	ucs_stride:
+		Number of bytes between successive characters, so that one can pass
+		e.g. &span->chars[0].ucs and sizeof(char_t).
+*/
+int extract_astring_cat_unicode_array(
+		extract_alloc_t   *alloc,
+		extract_astring_t *string,
+		const unsigned    *ucs,
+		size_t             ucs_num,
+		size_t             ucs_stride,
+		int                xml,
+		int                ascii_ligatures,
+		int                ascii_dash,
+		int                ascii_apostrophe);
+
+/* Appends <ucs_num> unicode characters, with same behaviour as calling
+extract_astring_catc_unicode_xml() for each one. */
+int extract_astring_cat_unicode_array_xml(
+		extract_alloc_t   *alloc,
+		extract_astring_t *string,
+		const unsigned    *ucs,
+		size_t             ucs_num,
+		size_t             ucs_stride);
+
 #endif
@@ -278,6 +278,35 @@ static void test_file(void)
     }
     if (extract_buffer_close(&file_buffer)) abort();
 
+    /* Check mmap buffer gives the same results. */
+    if (extract_buffer_open_mmap(NULL /*alloc*/, "test/generated/buffer-file", &file_buffer)) abort();
+
+    {
+        size_t  n;
+        char    buffer[10];
+        int     e;
+        errno = 0;
+        e = extract_buffer_read(file_buffer, buffer, 2, &n);
+        if (e == 0 && n == 2 && !memcmp(buffer, "fo", 2)) {}
+        else {
+            outf("extract_buffer_read() returned e=%i errno=%i n=%zi", e, errno, n);
+            abort();
+        }
+        e = extract_buffer_read(file_buffer, buffer, 3, &n);
+        if (e == 1 && n == 1 && buffer[0] == 'o') {}
+        else {
+            outf("extract_buffer_read() returned e=%i errno=%i n=%zi", e, errno, n);
+            abort();
+        }
+        e = extract_buffer_read(file_buffer, buffer, 3, &n);
+        if (e == 1 && n == 0) {}
+        else {
+            outf("extract_buffer_read() returned e=%i errno=%i n=%zi", e, errno, n);
+            abort();
+        }
+    }
+    if (extract_buffer_close(&file_buffer)) abort();
+
     /* Check writing to read-only file buffer fails. */
     {
         int e;
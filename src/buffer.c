@@ -2,6 +2,7 @@
 #include "extract/alloc.h"
 
 #include "outf.h"
+#include "stats.h"
 
 #include <assert.h>
 #include <errno.h>
@@ -9,6 +10,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
 /* TODO: Check whether the whole complexity of the cache is actually justified. */
 
 struct extract_buffer_t
@@ -23,6 +31,7 @@ struct extract_buffer_t
 	extract_buffer_fn_cache *fn_cache;
 	extract_buffer_fn_close *fn_close;
 	size_t                   pos;    /* Does not include bytes currently read/written to cache. */
+	extract_probe_t         *probe;  /* If not NULL, we record time spent in fn_*(). */
 };
 
 
@@ -55,6 +64,7 @@ int extract_buffer_open(extract_alloc_t          *alloc,
 	buffer->cache.numbytes = 0;
 	buffer->cache.pos = 0;
 	buffer->pos = 0;
+	buffer->probe = NULL;
 
 	*o_buffer = buffer;
 
@@ -73,6 +83,60 @@ size_t extract_buffer_pos(extract_buffer_t *buffer)
 }
 
 
+extract_probe_t *extract_buffer_set_probe(extract_buffer_t *buffer, extract_probe_t *probe)
+{
+	extract_probe_t *ret = buffer->probe;
+
+	buffer->probe = probe;
+
+	return ret;
+}
+
+extract_probe_t *extract_buffer_get_probe(extract_buffer_t *buffer)
+{
+	return buffer->probe;
+}
+
+
+/* Wrappers for buffer->fn_*() that record time taken in buffer->probe. */
+
+static int s_fn_read(extract_buffer_t *buffer, void *destination, size_t numbytes, size_t *o_actual)
+{
+	extract_probe_timer_t timer;
+	int                   e;
+
+	extract_probe_begin(buffer->probe, extract_stage_BUFFER_IO, &timer);
+	e = buffer->fn_read(buffer->handle, destination, numbytes, o_actual);
+	extract_probe_end(buffer->probe, extract_stage_BUFFER_IO, &timer);
+
+	return e;
+}
+
+static int s_fn_write(extract_buffer_t *buffer, const void *source, size_t numbytes, size_t *o_actual)
+{
+	extract_probe_timer_t timer;
+	int                   e;
+
+	extract_probe_begin(buffer->probe, extract_stage_BUFFER_IO, &timer);
+	e = buffer->fn_write(buffer->handle, source, numbytes, o_actual);
+	extract_probe_end(buffer->probe, extract_stage_BUFFER_IO, &timer);
+
+	return e;
+}
+
+static int s_fn_cache(extract_buffer_t *buffer)
+{
+	extract_probe_timer_t timer;
+	int                   e;
+
+	extract_probe_begin(buffer->probe, extract_stage_BUFFER_IO, &timer);
+	e = buffer->fn_cache(buffer->handle, &buffer->cache.cache, &buffer->cache.numbytes);
+	extract_probe_end(buffer->probe, extract_stage_BUFFER_IO, &timer);
+
+	return e;
+}
+
+
 /* Send contents of cache to fn_write() using a loop to cope with short
 writes. Returns with *o_actual containing the number of bytes successfully
 sent, and buffer->cache.{cache,numbytes,pos} all set to zero.
@@ -89,8 +153,8 @@ static int cache_flush(extract_buffer_t *buffer, size_t *o_actual)
 	while (p != buffer->cache.pos)
 	{
 		size_t actual;
-		if (buffer->fn_write(
-			buffer->handle,
+		if (s_fn_write(
+			buffer,
 			(char*) buffer->cache.cache + p,
 			buffer->cache.pos - p,
 			&actual
@@ -187,6 +251,8 @@ int extract_buffer_open_simple(extract_alloc_t           *alloc,
 	buffer->fn_write = NULL;
 	buffer->fn_cache = simple_cache;
 	buffer->fn_close = fn_close;
+	buffer->pos = 0;
+	buffer->probe = NULL;
 	*o_buffer = buffer;
 
 	return 0;
@@ -272,6 +338,94 @@ end:
 }
 
 
+/* Implementation of extract_buffer_open_mmap(). */
+
+#ifdef _WIN32
+
+int extract_buffer_open_mmap(extract_alloc_t *alloc, const char *path, extract_buffer_t **o_buffer)
+{
+	return extract_buffer_open_file(alloc, path, 0 /*writable*/, o_buffer);
+}
+
+#else
+
+typedef struct
+{
+	extract_alloc_t *alloc;
+	void            *data;
+	size_t           numbytes;
+} mmap_t;
+
+static void mmap_close(void *handle)
+{
+	mmap_t *mapping = handle;
+
+	munmap(mapping->data, mapping->numbytes);
+	extract_free(mapping->alloc, &mapping);
+}
+
+int extract_buffer_open_mmap(extract_alloc_t *alloc, const char *path, extract_buffer_t **o_buffer)
+{
+	int          e       = -1;
+	int          fd      = -1;
+	mmap_t      *mapping = NULL;
+	void        *data    = MAP_FAILED;
+	size_t       numbytes;
+	struct stat  statbuf;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		outf("failed to open '%s': %s", path, strerror(errno));
+		goto end;
+	}
+	if (fstat(fd, &statbuf)) goto end;
+	numbytes = (size_t) statbuf.st_size;
+	if (!S_ISREG(statbuf.st_mode) || statbuf.st_size == 0 || (off_t) numbytes != statbuf.st_size)
+	{
+		/* Pipes etc can't be mapped, empty files can't be mapped, and files
+		that are larger than our address space can't be mapped in one go. */
+		close(fd);
+		return extract_buffer_open_file(alloc, path, 0 /*writable*/, o_buffer);
+	}
+
+	data = mmap(NULL, numbytes, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+	{
+		outf("failed to mmap '%s': %s", path, strerror(errno));
+		close(fd);
+		return extract_buffer_open_file(alloc, path, 0 /*writable*/, o_buffer);
+	}
+#ifdef MADV_SEQUENTIAL
+	/* Only a hint, so ignore errors. */
+	(void) madvise(data, numbytes, MADV_SEQUENTIAL);
+#endif
+
+	if (extract_malloc(alloc, &mapping, sizeof(*mapping))) goto end;
+	mapping->alloc = alloc;
+	mapping->data = data;
+	mapping->numbytes = numbytes;
+	if (extract_buffer_open_simple(alloc, data, numbytes, mapping, mmap_close, o_buffer)) goto end;
+
+	e = 0;
+end:
+
+	if (fd >= 0)
+		close(fd);
+	if (e)
+	{
+		if (data != MAP_FAILED)
+			munmap(data, numbytes);
+		extract_free(alloc, &mapping);
+		*o_buffer = NULL;
+	}
+
+	return e;
+}
+
+#endif
+
+
 /* Support for read/write. */
 
 /* Called by extract_buffer_read() if not enough space in buffer->cache. */
@@ -308,7 +462,7 @@ int extract_buffer_read_internal(extract_buffer_t *buffer,
 			/* Carry on looping in case of short read. */
 			size_t actual;
 			outfx("using buffer->fn_read() directly for numbytes-pos=%i\n", numbytes-pos);
-			if (buffer->fn_read(buffer->handle, (char*) destination + pos, numbytes - pos, &actual))
+			if (s_fn_read(buffer, (char*) destination + pos, numbytes - pos, &actual))
 				goto end;
 			if (actual == 0)
 				break; /* EOF. */
@@ -319,7 +473,7 @@ int extract_buffer_read_internal(extract_buffer_t *buffer,
 		{
 			/* Repopulate cache. */
 			outfx("using buffer->fn_cache() for buffer->cache.numbytes=%i\n", buffer->cache.numbytes);
-			if (buffer->fn_cache(buffer->handle, &buffer->cache.cache, &buffer->cache.numbytes))
+			if (s_fn_cache(buffer))
 				goto end;
 			buffer->pos += buffer->cache.pos;
 			buffer->cache.pos = 0;
@@ -340,6 +494,60 @@ end:
 }
 
 
+int extract_buffer_read_chunk(extract_buffer_t  *buffer,
+				void              *scratch,
+				size_t             scratch_size,
+				const void       **o_data,
+				size_t            *o_numbytes)
+{
+	size_t n = buffer->cache.numbytes - buffer->cache.pos;
+
+	*o_numbytes = 0;
+	if (n == 0 && buffer->fn_cache)
+	{
+		/* Repopulate cache. */
+		if (s_fn_cache(buffer))
+			return -1;
+		buffer->pos += buffer->cache.pos;
+		buffer->cache.pos = 0;
+		n = buffer->cache.numbytes;
+	}
+	if (n)
+	{
+		/* Return data in cache. */
+		*o_data = (char *)buffer->cache.cache + buffer->cache.pos;
+		*o_numbytes = n;
+		buffer->cache.pos += n;
+		return 0;
+	}
+	if (buffer->fn_read == NULL)
+		return +1; /* EOF. */
+
+	if (s_fn_read(buffer, scratch, scratch_size, o_numbytes))
+		return -1;
+	buffer->pos += *o_numbytes;
+	*o_data = scratch;
+
+	return (*o_numbytes) ? 0 : +1;
+}
+
+int extract_buffer_read_remaining(extract_buffer_t  *buffer,
+				const void       **o_data,
+				size_t            *o_numbytes)
+{
+	if (buffer->fn_read || buffer->fn_cache != simple_cache)
+	{
+		errno = ENOTSUP;
+		return -1;
+	}
+	*o_data = (char *)buffer->cache.cache + buffer->cache.pos;
+	*o_numbytes = buffer->cache.numbytes - buffer->cache.pos;
+	buffer->cache.pos = buffer->cache.numbytes;
+
+	return 0;
+}
+
+
 int extract_buffer_write_internal(extract_buffer_t *buffer,
                                   const void       *source,
                                   size_t            numbytes,
@@ -409,7 +617,7 @@ int extract_buffer_write_internal(extract_buffer_t *buffer,
 				 * directly instead. Carry on looping in case of short
 				 * write. */
 				size_t actual;
-				if (buffer->fn_write(buffer->handle, (char*) source + pos, numbytes - pos, &actual))
+				if (s_fn_write(buffer, (char*) source + pos, numbytes - pos, &actual))
 					goto end;
 				if (actual == 0)
 					break; /* EOF. */
@@ -422,7 +630,7 @@ int extract_buffer_write_internal(extract_buffer_t *buffer,
 			{
 				/* Repopulate cache. */
 				outfx("repopulating cache buffer->pos=%i", buffer->pos);
-				if (buffer->fn_cache(buffer->handle, &buffer->cache.cache, &buffer->cache.numbytes))
+				if (s_fn_cache(buffer))
 					goto end;
 				buffer->cache.pos = 0;
 				if (buffer->cache.numbytes == 0)
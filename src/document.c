@@ -1,3 +1,6 @@
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_CONTENT
+
 #include "document.h"
 #include "outf.h"
 #include <assert.h>
@@ -145,6 +148,8 @@ content_clear(extract_alloc_t *alloc, content_root_t *proot)
 			break;
 		}
 	}
+	/* Each *_free() function unlinks its node, so <proot> is now empty. */
+	assert(proot->base.next == &proot->base && proot->base.prev == &proot->base);
 }
 
 int
@@ -341,7 +346,7 @@ void extract_image_clear(extract_alloc_t *alloc, image_t *image)
 	extract_free(alloc, &image->type);
 	extract_free(alloc, &image->name);
 	extract_free(alloc, &image->id);
-	if (image->data_free)
+	if (image->data_free && !image->fetch)
 	{
 		image->data_free(image->data_free_handle, image->data);
 		image->data_free = NULL;
@@ -350,10 +355,38 @@ void extract_image_clear(extract_alloc_t *alloc, image_t *image)
 	}
 }
 
+int extract_image_data_get(extract_alloc_t *alloc, images_t *images, image_t *image, void **o_data)
+{
+	(void) alloc;
+	if (image->spilled)
+	{
+		return extract_spill_read_alloc(images->spill, image->spill_offset, image->data_size, o_data);
+	}
+	if (image->fetch)
+	{
+		return image->fetch(image->fetch_handle, o_data);
+	}
+	*o_data = image->data;
+	return 0;
+}
+
+void extract_image_data_release(extract_alloc_t *alloc, image_t *image, void *data)
+{
+	if (image->spilled)
+	{
+		extract_free(alloc, &data);
+	}
+	else if (image->fetch && image->data_free && data)
+	{
+		image->data_free(image->data_free_handle, data);
+	}
+}
+
 void extract_image_free(extract_alloc_t *alloc, image_t **pimage)
 {
 	if (*pimage == NULL)
 		return;
+	content_unlink(&(*pimage)->base);
 	extract_image_clear(alloc, *pimage);
 	extract_free(alloc, pimage);
 }
@@ -5,6 +5,9 @@
 #include "extract/alloc.h"
 
 #include "compat_stdint.h"
+#include "spill.h"
+#include "stats.h"
+
 #include <assert.h>
 
 typedef struct span_t span_t;
@@ -515,6 +518,20 @@ struct image_t
 
 	extract_image_data_free *data_free;
 	void                    *data_free_handle;
+
+	/* If not NULL, .data is NULL and we call fetch(fetch_handle, ...) to get
+	the data when needed; see extract_image_data_get(). */
+	extract_image_fetch     *fetch;
+	void                    *fetch_handle;
+
+	/* Non-zero if this image has the same data as an earlier image, in which
+	case .data is NULL and .name/.id refer to the earlier image. */
+	int                      repeat;
+
+	/* Non-zero if data has been moved to spill file at .spill_offset, in
+	which case .data is NULL. */
+	int                      spilled;
+	uint64_t                 spill_offset;
 };
 
 void extract_image_init(image_t *image);
@@ -651,15 +668,25 @@ typedef struct
 
 typedef struct
 {
-	image_t **images;
-	int       images_num;
-	char    **imagetypes;
-	int       imagetypes_num;
+	image_t         **images;
+	int               images_num;
+	char            **imagetypes;
+	int               imagetypes_num;
+	extract_spill_t  *spill;    /* Not owned; holds data of spilled images. */
 } images_t;
 
+/* Sets *o_data to point to <image>'s data, fetching it or reading it from
+images->spill if necessary. Caller must pass *o_data to
+extract_image_data_release() when finished with it. */
+int extract_image_data_get(extract_alloc_t *alloc, images_t *images, image_t *image, void **o_data);
+
+/* Releases data returned by extract_image_data_get(). */
+void extract_image_data_release(extract_alloc_t *alloc, image_t *image, void *data);
 
-/* This does all the work of finding paragraphs and tables. */
-int extract_document_join(extract_alloc_t *alloc, document_t *document, int layout_analysis, double master_space_guess);
+
+/* This does all the work of finding paragraphs and tables. If <probe> is not
+NULL we record the time taken by each stage. */
+int extract_document_join(extract_alloc_t *alloc, extract_probe_t *probe, document_t *document, int layout_analysis, double master_space_guess);
 
 double extract_font_size(matrix4_t *ctm);
 
@@ -730,6 +757,14 @@ static inline content_t *content_tree_iterator_next(content_tree_iterator *it)
 	case content_paragraph:
 		it->next = ((paragraph_t *)next)->content.base.next;
 		break;
+	case content_block:
+		it->next = ((block_t *)next)->content.base.next;
+		break;
+	case content_image:
+	case content_table:
+		/* We don't descend into table cells. */
+		it->next = next->next;
+		break;
 	}
 
 	return next;
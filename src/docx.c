@@ -5,6 +5,9 @@ Caller must call things in a sensible order to create valid content -
 e.g. don't call docx_paragraph_start() twice without intervening call to
 docx_paragraph_finish(). */
 
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_OUTPUT
+
 #include "extract/extract.h"
 
 #include "docx_template.h"
@@ -58,19 +61,13 @@ docx_run_start(	extract_alloc_t   *alloc,
 	if (!e) e = extract_astring_cat(alloc, output, "\"/>");
 	if (!e && content_state->font.bold) e = extract_astring_cat(alloc, output, "<w:b/>");
 	if (!e && content_state->font.italic) e = extract_astring_cat(alloc, output, "<w:i/>");
-	{
-		char font_size_text[32];
-
-		if (!e) e = extract_astring_cat(alloc, output, "<w:sz w:val=\"");
-		snprintf(font_size_text, sizeof(font_size_text), "%f", content_state->font.size * 2);
-		extract_astring_cat(alloc, output, font_size_text);
-		extract_astring_cat(alloc, output, "\"/>");
+	if (!e) e = extract_astring_cat(alloc, output, "<w:sz w:val=\"");
+	if (!e) e = extract_astring_cat_double_f(alloc, output, content_state->font.size * 2, 6);
+	if (!e) e = extract_astring_cat(alloc, output, "\"/>");
 
-		if (!e) e = extract_astring_cat(alloc, output, "<w:szCs w:val=\"");
-		snprintf(font_size_text, sizeof(font_size_text), "%f", content_state->font.size * 2);
-		extract_astring_cat(alloc, output, font_size_text);
-		extract_astring_cat(alloc, output, "\"/>");
-	}
+	if (!e) e = extract_astring_cat(alloc, output, "<w:szCs w:val=\"");
+	if (!e) e = extract_astring_cat_double_f(alloc, output, content_state->font.size * 2, 6);
+	if (!e) e = extract_astring_cat(alloc, output, "\"/>");
 	if (!e) e = extract_astring_cat(alloc, output, "</w:rPr><w:t xml:space=\"preserve\">");
 
 	return e;
@@ -172,7 +169,6 @@ document_to_docx_content_paragraph(
 
 		for (span = content_span_iterator_init(&sit, &line->content); span != NULL; span = content_span_iterator_next(&sit))
 		{
-			int si;
 			double font_size_new;
 
 			content_state->ctm_prev = &span->ctm;
@@ -195,13 +191,14 @@ document_to_docx_content_paragraph(
 					goto end;
 			}
 
-			for (si=0; si<span->chars_num; ++si)
-			{
-				char_t* char_ = &span->chars[si];
-				int c = char_->ucs;
-				if (extract_astring_catc_unicode_xml(alloc, content, c))
-					goto end;
-			}
+			if (span->chars_num && extract_astring_cat_unicode_array_xml(
+					alloc,
+					content,
+					&span->chars[0].ucs,
+					span->chars_num,
+					sizeof(span->chars[0])
+					))
+				goto end;
 			/* Remove any trailing '-' at end of line. */
 			if (docx_char_truncate_if(content, '-'))
 				goto end;
@@ -597,130 +594,123 @@ end:
 }
 
 int
-extract_document_to_docx_content(
+extract_page_to_docx_content(
 		extract_alloc_t   *alloc,
-		document_t        *document,
+		extract_page_t    *page,
 		int                spacing,
 		int                rotation,
 		int                images,
+		int               *text_box_id,
 		extract_astring_t *output)
 {
 	int e = -1;
-	int text_box_id = 0;
-	int p;
+	int c;
 
-	/* Write paragraphs into <content>. */
-	for (p=0; p<document->pages_num; ++p)
+	for (c=0; c<page->subpages_num; ++c)
 	{
-		extract_page_t *page = document->pages[p];
-		int c;
-
-		for (c=0; c<page->subpages_num; ++c)
+		subpage_t                  *subpage = page->subpages[c];
+		content_iterator            cit;
+		content_t                  *content;
+		content_table_iterator      tit;
+		table_t                    *table;
+
+		content_state_t content_state;
+		content_state.font.name = NULL;
+		content_state.font.size = 0;
+		content_state.font.bold = 0;
+		content_state.font.italic = 0;
+		content_state.ctm_prev = NULL;
+
+		/* Output paragraphs and tables in order of y coordinate. */
+		content = content_iterator_init(&cit, &subpage->content);
+		table = content_table_iterator_init(&tit, &subpage->tables);
+		while (1)
 		{
-			subpage_t                  *subpage = page->subpages[c];
-			content_iterator            cit;
-			content_t                  *content;
-			content_table_iterator      tit;
-			table_t                    *table;
-
-			content_state_t content_state;
-			content_state.font.name = NULL;
-			content_state.font.size = 0;
-			content_state.font.bold = 0;
-			content_state.font.italic = 0;
-			content_state.ctm_prev = NULL;
-
-			/* Output paragraphs and tables in order of y coordinate. */
-			content = content_iterator_init(&cit, &subpage->content);
-			table = content_table_iterator_init(&tit, &subpage->tables);
-			while (1)
-			{
-				double y_paragraph;
-				double y_table;
-				/* Next block or NULL if none. */
-				block_t *block = (content && content->type == content_block) ? (block_t *)content : NULL;
-				/* Next paragraph or NULL if none. */
-				paragraph_t *paragraph = (content && content->type == content_paragraph) ? (paragraph_t *)content : (block ? content_first_paragraph(&block->content) : NULL);
-				line_t *first_line = paragraph ? content_first_line(&paragraph->content) : NULL;
-				span_t *first_span = first_line ? content_head_as_span(&first_line->content) : NULL;
+			double y_paragraph;
+			double y_table;
+			/* Next block or NULL if none. */
+			block_t *block = (content && content->type == content_block) ? (block_t *)content : NULL;
+			/* Next paragraph or NULL if none. */
+			paragraph_t *paragraph = (content && content->type == content_paragraph) ? (paragraph_t *)content : (block ? content_first_paragraph(&block->content) : NULL);
+			line_t *first_line = paragraph ? content_first_line(&paragraph->content) : NULL;
+			span_t *first_span = first_line ? content_head_as_span(&first_line->content) : NULL;
 
-				if (!paragraph && !table) break;
+			if (!paragraph && !table) break;
 
-				y_paragraph = (first_span) ? first_span->chars[0].y : DBL_MAX;
-				y_table = (table) ? table->pos.y : DBL_MAX;
+			y_paragraph = (first_span) ? first_span->chars[0].y : DBL_MAX;
+			y_table = (table) ? table->pos.y : DBL_MAX;
 
-				if (first_span && y_paragraph < y_table)
+			if (first_span && y_paragraph < y_table)
+			{
+				const matrix4_t *ctm   = &first_span->ctm;
+				double           angle = extract_baseline_angle(ctm);
+
+				if (spacing
+					&& content_state.ctm_prev
+					&& first_line
+					&& first_span
+					&& extract_matrix4_cmp(content_state.ctm_prev,
+								&first_span->ctm))
 				{
-					const matrix4_t *ctm   = &first_span->ctm;
-					double           angle = extract_baseline_angle(ctm);
-
-					if (spacing
-						&& content_state.ctm_prev
-						&& first_line
-						&& first_span
-						&& extract_matrix4_cmp(content_state.ctm_prev,
-									&first_span->ctm))
-					{
-						/* Extra vertical space between paragraphs that
-						 * were at different angles in the original
-						 * document. */
-						if (docx_paragraph_empty(alloc, output))
-							goto end;
-					}
+					/* Extra vertical space between paragraphs that
+					 * were at different angles in the original
+					 * document. */
+					if (docx_paragraph_empty(alloc, output))
+						goto end;
+				}
 
-					/* Extra vertical space between paragraphs. */
-					if (spacing)
-						if (docx_paragraph_empty(alloc, output))
-							goto end;
+				/* Extra vertical space between paragraphs. */
+				if (spacing)
+					if (docx_paragraph_empty(alloc, output))
+						goto end;
 
-					if (rotation && angle != 0)
-					{
-						assert(block);
-						if (docx_append_rotated_paragraphs(alloc, &content_state, block, &text_box_id, angle, output))
-							goto end;
-					}
-					else if (block)
-					{
-						content_paragraph_iterator pit;
-						int                        first = 1;
+				if (rotation && angle != 0)
+				{
+					assert(block);
+					if (docx_append_rotated_paragraphs(alloc, &content_state, block, text_box_id, angle, output))
+						goto end;
+				}
+				else if (block)
+				{
+					content_paragraph_iterator pit;
+					int                        first = 1;
 
-						for (paragraph = content_paragraph_iterator_init(&pit, &block->content); paragraph != NULL; paragraph = content_paragraph_iterator_next(&pit))
+					for (paragraph = content_paragraph_iterator_init(&pit, &block->content); paragraph != NULL; paragraph = content_paragraph_iterator_next(&pit))
+					{
+						if (spacing && !first)
 						{
-							if (spacing && !first)
-							{
-								/* Extra vertical space between paragraphs. */
-								if (docx_paragraph_empty(alloc, output))
-									goto end;
-							}
-							first = 0;
-
-							if (document_to_docx_content_paragraph(alloc, &content_state, paragraph, output)) goto end;
+							/* Extra vertical space between paragraphs. */
+							if (docx_paragraph_empty(alloc, output))
+								goto end;
 						}
+						first = 0;
+
+						if (document_to_docx_content_paragraph(alloc, &content_state, paragraph, output)) goto end;
 					}
-					else
-					{
-						if (document_to_docx_content_paragraph(alloc, &content_state, paragraph, output))
-							goto end;
-					}
-					content = content_iterator_next(&cit);
 				}
-				else if (table)
+				else
 				{
-					if (docx_append_table(alloc, table, output))
+					if (document_to_docx_content_paragraph(alloc, &content_state, paragraph, output))
 						goto end;
-					table = content_table_iterator_next(&tit);
 				}
+				content = content_iterator_next(&cit);
 			}
-
-			if (images)
+			else if (table)
 			{
-				content_image_iterator  iit;
-				image_t                *image;
-
-				for (image = content_image_iterator_init(&iit, &subpage->content); image != NULL; image = content_image_iterator_next(&iit))
-					docx_append_image(alloc, output, image);
+				if (docx_append_table(alloc, table, output))
+					goto end;
+				table = content_table_iterator_next(&tit);
 			}
 		}
+
+		if (images)
+		{
+			content_image_iterator  iit;
+			image_t                *image;
+
+			for (image = content_image_iterator_init(&iit, &subpage->content); image != NULL; image = content_image_iterator_next(&iit))
+				docx_append_image(alloc, output, image);
+		}
 	}
 
 	e = 0;
@@ -729,6 +719,35 @@ end:
 	return e;
 }
 
+int
+extract_document_to_docx_content(
+		extract_alloc_t   *alloc,
+		document_t        *document,
+		int                spacing,
+		int                rotation,
+		int                images,
+		extract_astring_t *output)
+{
+	int text_box_id = 0;
+	int p;
+
+	/* Write paragraphs into <content>. */
+	for (p=0; p<document->pages_num; ++p)
+	{
+		if (extract_page_to_docx_content(
+				alloc,
+				document->pages[p],
+				spacing,
+				rotation,
+				images,
+				&text_box_id,
+				output
+				)) return -1;
+	}
+
+	return 0;
+}
+
 
 /* Sets *o_begin to end of first occurrence of <begin> in <text>, and *o_end to
  * beginning of first occurtence of <end> in <text>. */
@@ -872,58 +891,63 @@ extract_docx_write_template(
 		const char        *path_out,
 		int                preserve_dir)
 {
-	int   e = -1;
-	int   i;
-	char *path_tempdir = NULL;
-	char *path = NULL;
-	char *text = NULL;
-	char *text2 = NULL;
-
+	int                   e = -1;
+	int                   i;
+	char                 *template_data = NULL;
+	size_t                template_data_length;
+	extract_zip_reader_t *reader = NULL;
+	extract_buffer_t     *buffer = NULL;
+	extract_zip_t        *zip = NULL;
+	char                 *name2 = NULL;
+	char                 *text = NULL;
+	char                 *text2 = NULL;
+
+	(void) preserve_dir;
 	assert(path_out);
 	assert(path_template);
 
-	if (extract_check_path_shell_safe(path_out))
+	outf("images->images_num=%i", images->images_num);
+	if (extract_read_all_path2(alloc, path_template, &template_data, &template_data_length))
 	{
-		outf("path_out is unsafe: %s", path_out);
+		outf("Failed to read template document: %s", path_template);
 		goto end;
 	}
+	if (extract_zip_reader_open(alloc, template_data, template_data_length, &reader)) goto end;
+	if (extract_buffer_open_file(alloc, path_out, 1 /*writable*/, &buffer)) goto end;
+	if (extract_zip_open(buffer, &zip)) goto end;
 
-	outf("images->images_num=%i", images->images_num);
-	if (extract_asprintf(alloc, &path_tempdir, "%s.dir", path_out) < 0) goto end;
-	if (extract_systemf(alloc, "rm -r '%s' 2>/dev/null", path_tempdir) < 0) goto end;
+	/* We modify just the items that we know extract_docx_content_item() will
+	modify, and copy all other items unchanged. */
 
-	if (extract_mkdir(path_tempdir, 0777)) {
-		outf("Failed to create directory: %s", path_tempdir);
-		goto end;
-	}
-
-	outf("Unzipping template document '%s' to tempdir: %s",
-		path_template, path_tempdir);
-	if (extract_systemf(alloc, "unzip -q -d '%s' '%s'", path_tempdir, path_template))
+	for (i=0; i<extract_zip_reader_files_num(reader); ++i)
 	{
-		outf("Failed to unzip %s into %s",
-			path_template, path_tempdir);
-		goto end;
-	}
+		const char *name = extract_zip_reader_file_name(reader, i);
+		int         j;
+
+		if (name[0] == 0 || name[strlen(name)-1] == '/')
+		{
+			/* Omit directory entries, like 'zip -D'. */
+			continue;
+		}
 
-	/* Might be nice to iterate through all items in path_tempdir, but for now
-	 * we look at just the items that we know extract_docx_content_item() will
-	 * modify. */
+		/* Omit items that will be replaced by our images. */
+		for (j=0; j<images->images_num; ++j)
+		{
+			extract_free(alloc, &name2);
+			if (extract_asprintf(alloc, &name2, "word/media/%s", images->images[j]->name) < 0) goto end;
+			if (!strcmp(name, name2)) break;
+		}
+		if (j != images->images_num) continue;
 
-	{
-		const char *names[] = {
-			"word/document.xml",
-			"[Content_Types].xml",
-			"word/_rels/document.xml.rels",
-		};
-		int names_num = sizeof(names) / sizeof(names[0]);
-		for (i=0; i<names_num; ++i) {
-			const char* name = names[i];
-			extract_free(alloc, &path);
+		if (0
+				|| !strcmp(name, "word/document.xml")
+				|| !strcmp(name, "[Content_Types].xml")
+				|| !strcmp(name, "word/_rels/document.xml.rels")
+				)
+		{
 			extract_free(alloc, &text);
 			extract_free(alloc, &text2);
-			if (extract_asprintf(alloc, &path, "%s/%s", path_tempdir, name) < 0) goto end;
-			if (extract_read_all_path(alloc, path, &text)) goto end;
+			if (extract_zip_reader_read_file(reader, i, &text, NULL)) goto end;
 
 			if (extract_docx_content_item(alloc,
 					contentss,
@@ -935,45 +959,40 @@ extract_docx_write_template(
 
 			{
 				const char *text3 = (text2) ? text2 : text;
-				if (extract_write_all(text3, strlen(text3), path)) goto end;
+				if (extract_zip_write_file(zip, text3, strlen(text3), name)) goto end;
 			}
 		}
-	}
-
-	/* Copy images into <path_tempdir>/media/. */
-	extract_free(alloc, &path);
-	if (extract_asprintf(alloc, &path, "%s/word/media", path_tempdir) < 0) goto end;
-	if (extract_mkdir(path, 0777)) goto end;
-
-	for (i=0; i<images->images_num; ++i) {
-		image_t* image = images->images[i];
-		extract_free(alloc, &path);
-		if (extract_asprintf(alloc, &path, "%s/word/media/%s", path_tempdir, image->name) < 0) goto end;
-		if (extract_write_all(image->data, image->data_size, path)) goto end;
-	}
-
-	outf("Zipping tempdir to create %s", path_out);
-	{
-		const char *path_out_leaf = strrchr(path_out, '/');
-		if (!path_out_leaf) path_out_leaf = path_out;
-		if (extract_systemf(alloc, "cd '%s' && zip -q -r -D '../%s' .", path_tempdir, path_out_leaf))
+		else
 		{
-			outf("Zip command failed to convert '%s' directory into output file: %s",
-				path_tempdir, path_out);
-			goto end;
+			if (extract_zip_copy_file(zip, reader, i)) goto end;
 		}
 	}
 
-	if (!preserve_dir) {
-		if (extract_remove_directory(alloc, path_tempdir)) goto end;
+	for (i=0; i<images->images_num; ++i)
+	{
+		image_t* image = images->images[i];
+		void*    data;
+		int      e2;
+		extract_free(alloc, &name2);
+		if (extract_asprintf(alloc, &name2, "word/media/%s", image->name) < 0) goto end;
+		if (extract_image_data_get(alloc, images, image, &data)) goto end;
+		e2 = extract_zip_write_file_method(zip, data, image->data_size, name2, extract_zip_method_for_type(image->type));
+		extract_image_data_release(alloc, image, data);
+		if (e2) goto end;
 	}
 
+	if (extract_zip_close(&zip)) goto end;
+	if (extract_buffer_close(&buffer)) goto end;
+
 	e = 0;
 end:
 
 	outf("e=%i", e);
-	extract_free(alloc, &path_tempdir);
-	extract_free(alloc, &path);
+	extract_zip_close(&zip);
+	extract_buffer_close(&buffer);
+	extract_zip_reader_close(&reader);
+	extract_free(alloc, &template_data);
+	extract_free(alloc, &name2);
 	extract_free(alloc, &text);
 	extract_free(alloc, &text2);
 
@@ -22,10 +22,28 @@ int extract_document_to_docx_content(
 		extract_astring_t *content);
 
 
+/*
+	Like extract_document_to_docx_content() but for a single page.
+
+	text_box_id
+		In/out-param; should be initialised to zero before the first page of
+		a document.
+*/
+int extract_page_to_docx_content(
+		extract_alloc_t   *alloc,
+		extract_page_t    *page,
+		int                spacing,
+		int                rotation,
+		int                images,
+		int               *text_box_id,
+		extract_astring_t *content);
+
+
 /*
 	Creates a new docx file using a provided template document.
 
-	Uses the 'zip' and 'unzip' commands internally.
+	We read the template in memory, modify the items that contain content and
+	copy all other items directly without decompression/recompression.
 
 	contentss
 	contentss_num
@@ -37,12 +55,9 @@ int extract_document_to_docx_content(
 	path_template
 		Name of docx file to use as a template.
 	path_out
-		Name of docx file to create. Must not contain single-quote, double quote,
-		space or ".." sequence - these will force EINVAL error because they could
-		make internal shell commands unsafe.
+		Name of docx file to create.
 	preserve_dir
-		If true, we don't delete the temporary directory <path_out>.dir containing
-		unzipped docx content.
+		Ignored; we no longer use a temporary directory.
 */
 int extract_docx_write_template(
 		extract_alloc_t   *alloc,
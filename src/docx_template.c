@@ -2,6 +2,8 @@
 
 #include "docx_template.h"
 
+#include <stddef.h>
+
 const docx_template_item_t docx_template_items[] =
 {
     {
@@ -19,7 +21,32 @@ const docx_template_item_t docx_template_items[] =
                 "<Override PartName=\"/word/fontTable.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.wordprocessingml.fontTable+xml\"/>"
                 "<Override PartName=\"/word/theme/theme1.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.theme+xml\"/>"
                 "<Override PartName=\"/docProps/core.xml\" ContentType=\"application/vnd.openxmlformats-package.core-properties+xml\"/>"
-                "<Override PartName=\"/docProps/app.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.extended-properties+xml\"/></Types>"
+                "<Override PartName=\"/docProps/app.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.extended-properties+xml\"/></Types>",
+        "\xb5\x94\xcb\x6a\xc3\x30\x10\x45\xf7\x85\xfe\x83\xd1\x36\xd8"
+        "\x4a\xba\x28\xa5\xc4\xc9\xa2\x8f\x65\x1b\x68\xfa\x01\xaa\x34\x4e"
+        "\x44\x65\x49\x68\x26\xaf\xbf\xef\x38\x4e\x43\x29\x69\x0c\x4d\xb2"
+        "\x31\xd8\x33\xf7\xde\x33\xc2\xa3\xe1\x78\x5d\xbb\x6c\x09\x09\x6d"
+        "\xf0\xa5\x18\x14\x7d\x91\x81\xd7\xc1\x58\x3f\x2b\xc5\xfb\xf4\x39"
+        "\xbf\x13\x19\x92\xf2\x46\xb9\xe0\xa1\x14\x1b\x40\x31\x1e\x5d\x5f"
+        "\x0d\xa7\x9b\x08\x98\xb1\xda\x63\x29\xe6\x44\xf1\x5e\x4a\xd4\x73"
+        "\xa8\x15\x16\x21\x82\xe7\x4a\x15\x52\xad\x88\x5f\xd3\x4c\x46\xa5"
+        "\x3f\xd5\x0c\xe4\x4d\xbf\x7f\x2b\x75\xf0\x04\x9e\x72\x6a\x3c\xc4"
+        "\x68\xf8\x08\x95\x5a\x38\xca\x9e\xd6\xfc\xb9\x25\x49\xe0\x50\x64"
+        "\x0f\x6d\x63\x93\x55\x0a\x15\xa3\xb3\x5a\x11\xd7\xe5\xd2\x9b\x5f"
+        "\x29\xf9\x2e\xa1\x60\xe5\xb6\x07\xe7\x36\x62\x8f\x1b\x84\x3c\x98"
+        "\xd0\x54\xfe\x0e\xd8\xe9\x5e\xf9\x68\x92\x35\x90\x4d\x54\xa2\x17"
+        "\x55\x73\x97\x5c\x85\x64\xa4\x09\x7a\x51\xb3\xb2\x38\x6e\x73\x80"
+        "\x33\x54\x95\xd5\xb0\xd7\x37\x6e\x31\x05\x0d\x88\x7c\xe6\xb5\x2b"
+        "\xf6\x95\x5a\x59\xdf\xeb\xe2\x40\xda\x38\xc0\xf3\x53\xb4\xbe\xdd"
+        "\xf1\x40\xc4\x82\x4b\x00\xec\x9c\x3b\x11\x56\xf0\xf1\x76\x31\x8a"
+        "\x1f\xe6\x9d\x20\x15\xe7\x4e\xd5\x87\x83\xf3\x63\xec\xad\x3b\x21"
+        "\x88\x37\x10\xda\xe7\xe0\x64\x8e\xad\xcd\xb1\x48\xee\x9c\xa4\x10"
+        "\x91\x37\x3a\xfd\x63\xec\xef\x95\x6d\xd4\x39\x0f\x1c\x21\x91\x3d"
+        "\xfe\xd7\xed\x13\xd9\xfa\xe4\xf9\xa0\xb9\x0d\x0c\x98\x03\xd9\x72"
+        "\x7b\xbf\x8d\xbe\x00",
+        340,
+        1312,
+        0x6cd2a4df
     },
 
     {
@@ -30,7 +57,25 @@ const docx_template_item_t docx_template_items[] =
                 "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
                 "<Relationship Id=\"rId3\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/extended-properties\" Target=\"docProps/app.xml\"/>"
                 "<Relationship Id=\"rId2\" Type=\"http://schemas.openxmlformats.org/package/2006/relationships/metadata/core-properties\" Target=\"docProps/core.xml\"/>"
-                "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/officeDocument\" Target=\"word/document.xml\"/></Relationships>"
+                "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/officeDocument\" Target=\"word/document.xml\"/></Relationships>",
+        "\xad\x92\xc1\x6a\xc3\x30\x0c\x40\xef\x83\xfd\x83\xd1\xbd\x51"
+        "\xda\xc1\x18\xa3\x4e\x2f\x63\xd0\xdb\x18\xd9\x07\x08\x5b\x49\x4c"
+        "\x13\xdb\xd8\x6a\xd7\xfe\xfd\x3c\xd8\xd8\x02\x5d\xe9\x61\x47\xcb"
+        "\xd2\xd3\x93\xd0\x7a\x73\x9c\x46\x75\xe0\x94\x5d\xf0\x1a\x96\x55"
+        "\x0d\x8a\xbd\x09\xd6\xf9\x5e\xc3\x5b\xfb\xbc\x78\x00\x95\x85\xbc"
+        "\xa5\x31\x78\xd6\x70\xe2\x0c\x9b\xe6\xf6\x66\xfd\xca\x23\x49\x29"
+        "\xca\x83\x8b\x59\x15\x8a\xcf\x1a\x06\x91\xf8\x88\x98\xcd\xc0\x13"
+        "\xe5\x2a\x44\xf6\xe5\xa7\x0b\x69\x22\x29\xcf\xd4\x63\x24\xb3\xa3"
+        "\x9e\x71\x55\xd7\xf7\x98\x7e\x33\xa0\x99\x31\xd5\xd6\x6a\x48\x5b"
+        "\x7b\x07\xaa\x3d\x45\xbe\x86\x1d\xba\xce\x19\x7e\x0a\x66\x3f\xb1"
+        "\x97\x33\x2d\x90\x8f\xc2\xde\xb2\x5d\xc4\x54\xea\x93\xb8\x32\x8d"
+        "\x6a\x29\xf5\x2c\x1a\x6c\x30\x2f\x25\x9c\x91\x62\xac\x0a\x1a\xf0"
+        "\xbc\xd1\xea\x7a\xa3\xbf\xa7\xc5\x89\x85\x2c\x09\xa1\x09\x89\x2f"
+        "\xfb\x7c\x66\x5c\x12\x5a\xfe\xe7\x8a\xe6\x19\x3f\x36\xef\x21\x59"
+        "\xb4\x5f\xe1\x6f\x1b\x9c\x5d\x41\xf3\x01",
+        233,
+        590,
+        0xb71a911e
     },
 
     {
@@ -54,7 +99,33 @@ const docx_template_item_t docx_template_items[] =
                 "<CharactersWithSpaces>19</CharactersWithSpaces>"
                 "<SharedDoc>false</SharedDoc>"
                 "<HyperlinksChanged>false</HyperlinksChanged>"
-                "<AppVersion>16.0000</AppVersion></Properties>"
+                "<AppVersion>16.0000</AppVersion></Properties>",
+        "\x9d\x52\xcb\x4e\xc3\x30\x10\xbc\x23\xf1\x0f\x51\xee\xad\xd3"
+        "\x22\x55\x05\x6d\x8c\x50\x2b\xc4\x81\x97\xd4\x00\x67\xcb\xde\x24"
+        "\x16\x8e\x6d\xd9\x06\xb5\x7f\xcf\x86\xb4\x21\x88\x1b\x3e\xed\xcc"
+        "\x7a\x47\x33\x6b\xc3\xf5\xbe\x33\xd9\x27\x86\xa8\x9d\x2d\xf3\xc5"
+        "\xbc\xc8\x33\xb4\xd2\x29\x6d\x9b\x32\x7f\xa9\x6e\x67\xeb\x3c\x8b"
+        "\x49\x58\x25\x8c\xb3\x58\xe6\x07\x8c\xf9\x35\x3f\x3f\x83\xe7\xe0"
+        "\x3c\x86\xa4\x31\x66\x24\x61\x63\x99\xb7\x29\xf9\x2b\xc6\xa2\x6c"
+        "\xb1\x13\x71\x4e\x6d\x4b\x9d\xda\x85\x4e\x24\x82\xa1\x61\xae\xae"
+        "\xb5\xc4\xad\x93\x1f\x1d\xda\xc4\x96\x45\xb1\x62\xb8\x4f\x68\x15"
+        "\xaa\x99\x1f\x05\xf3\x41\xf1\xea\x33\xfd\x57\x54\x39\xd9\xfb\x8b"
+        "\xaf\xd5\xc1\x93\x1e\x87\x0a\x3b\x6f\x44\x42\xfe\xd8\x4f\x9a\xb9"
+        "\x72\xa9\x03\x36\xb2\x50\xb9\x24\x4c\xa5\x3b\xe4\x17\x44\x8f\x00"
+        "\x9e\x45\x83\x91\x2f\x80\x0d\x05\xbc\xb9\xa0\x22\x5f\x02\x1b\x0a"
+        "\xd8\xb4\x22\x08\x99\x68\x7f\x7c\xb1\x06\x36\x81\x70\xe3\xbd\xd1"
+        "\x52\x24\x5a\x2c\x7f\xd0\x32\xb8\xe8\xea\x94\x3d\x7d\xbb\xcd\xfa"
+        "\x71\x60\xd3\x2b\x40\x09\x76\x28\x3f\x82\x4e\x07\x5e\x00\x9b\x42"
+        "\xb8\xd7\x76\xb0\x31\x14\x64\x2b\x88\x26\x08\xdf\x1e\xbd\x8d\x08"
+        "\x76\x52\x18\xdc\x50\x76\x5e\x0b\x13\x11\xd8\x0f\x01\x1b\xd7\x79"
+        "\x61\x49\x8e\x8d\x15\xe9\xbd\xc7\x17\x5f\xb9\x6d\xbf\x86\xe3\xc8"
+        "\x6f\x72\x92\xf1\x4d\xa7\x76\xe7\x85\xec\xbd\x5c\x4e\xd3\x4e\x1a"
+        "\xb0\x23\x16\x15\xd9\x1f\x1d\x8c\x04\xdc\xd1\x73\x04\xd3\xcb\xd3"
+        "\xac\x6d\x50\x9d\xee\xfc\x6d\xf4\xfb\x7b\x1d\xfe\x25\x5f\xac\xe6"
+        "\x05\x9d\xef\x85\x9d\x38\x8a\x3d\x7e\x18\xfe\x05",
+        363,
+        711,
+        0x1d6075e9
     },
 
     {
@@ -71,7 +142,32 @@ const docx_template_item_t docx_template_items[] =
                 "<cp:lastModifiedBy></cp:lastModifiedBy>"
                 "<cp:revision>1</cp:revision>"
                 "<dcterms:created xsi:type=\"dcterms:W3CDTF\">2020-09-25T17:04:00Z</dcterms:created>"
-                "<dcterms:modified xsi:type=\"dcterms:W3CDTF\">2020-09-25T17:07:00Z</dcterms:modified></cp:coreProperties>"
+                "<dcterms:modified xsi:type=\"dcterms:W3CDTF\">2020-09-25T17:07:00Z</dcterms:modified></cp:coreProperties>",
+        "\x8d\x92\x4d\x4f\xc3\x30\x0c\x86\xef\x48\xfc\x87\x2a\xf7\x36"
+        "\x69\xc7\x67\xd5\x76\x12\xa0\x9d\x98\x84\xc4\x10\x88\x5b\x48\xbc"
+        "\x2d\xac\x4d\xa2\x24\x5b\xd7\x7f\x4f\xda\x6e\x1d\x45\x3b\x70\xb3"
+        "\xfd\xbe\x7e\x64\x3b\xc9\xa6\xfb\xaa\x0c\x76\x60\xac\x50\x32\x47"
+        "\x71\x44\x50\x00\x92\x29\x2e\xe4\x2a\x47\x6f\x8b\x59\x78\x87\x02"
+        "\xeb\xa8\xe4\xb4\x54\x12\x72\xd4\x80\x45\xd3\xe2\xf2\x22\x63\x3a"
+        "\x65\xca\xc0\x8b\x51\x1a\x8c\x13\x60\x03\x4f\x92\x36\x65\x3a\x47"
+        "\x6b\xe7\x74\x8a\xb1\x65\x6b\xa8\xa8\x8d\xbc\x43\x7a\x71\xa9\x4c"
+        "\x45\x9d\x4f\xcd\x0a\x6b\xca\x36\x74\x05\x38\x21\xe4\x06\x57\xe0"
+        "\x28\xa7\x8e\xe2\x16\x18\xea\x81\x88\x0e\x48\xce\x06\xa4\xde\x9a"
+        "\xb2\x03\x70\x86\xa1\x84\x0a\xa4\xb3\x38\x8e\x62\x7c\xf2\x3a\x30"
+        "\x95\x3d\xdb\xd0\x29\xbf\x9c\x95\x70\x8d\x86\xb3\xd6\xa3\x38\xb8"
+        "\xf7\x56\x0c\xc6\xba\xae\xa3\x7a\xd2\x59\xfd\xfc\x31\xfe\x98\x3f"
+        "\xbf\x76\xab\x86\x42\xb6\xb7\x62\x80\x8a\x8c\xb3\xd4\x09\x57\x42"
+        "\x91\xe1\x53\xe8\x23\xbb\xfd\xfa\x06\xe6\xfa\xf2\x90\xf8\x98\x19"
+        "\xa0\x4e\x99\x5e\x18\x12\x7f\xe6\x0d\x34\xb5\x32\xdc\x7a\x65\x94"
+        "\x79\x1b\x07\xcb\x8c\xd0\xce\x3f\x5e\xdf\x37\x2a\x78\x77\x49\xad"
+        "\x9b\xfb\xd7\x5c\x0a\xe0\x0f\x4d\x4f\xf8\x5b\xf3\x25\x03\x3b\xd1"
+        "\xfe\x80\x22\xee\x1c\x43\x9a\x1d\xce\xd9\xcf\x03\x3c\xf0\x67\x48"
+        "\xfb\xa3\x1d\x95\xf7\xc9\xe3\xd3\x62\x86\x8a\x84\x24\x24\x24\xf7"
+        "\x61\x72\xbd\x88\x6f\x53\x72\x95\x12\xf2\xd9\x8e\x34\xea\x3f\x01"
+        "\xab\xc3\x00\xff\x27\xde\x8e\x89\x47\x40\xbf\xd3\xf8\x2b\x16\x3f",
+        351,
+        727,
+        0xcea5443b
     },
 
     {
@@ -153,7 +249,239 @@ const docx_template_item_t docx_template_items[] =
                 "<w:pgSz w:w=\"11906\" w:h=\"16838\"/>"
                 "<w:pgMar w:top=\"1440\" w:right=\"1440\" w:bottom=\"1440\" w:left=\"1440\" w:header=\"708\" w:footer=\"708\" w:gutter=\"0\"/>"
                 "<w:cols w:space=\"708\"/>"
-                "<w:docGrid w:linePitch=\"360\"/></w:sectPr></w:body></w:document>"
+                "<w:docGrid w:linePitch=\"360\"/></w:sectPr></w:body></w:document>",
+        "\xed\x5a\x57\x8f\xe3\xb8\x9a\x7d\x5f\x60\xff\x83\xe1\x0b\xec"
+        "\x8b\x6f\xb5\x72\xf2\x4c\xcd\x85\x64\x39\x27\xc9\xd9\xb5\x58\x5c"
+        "\x28\x4b\xb6\x92\x95\xe5\x5f\xbf\x24\x65\x57\x68\xd7\x0c\xaa\x6b"
+        "\x80\x7d\xda\x02\xda\x62\x3c\x3a\x5f\xe0\x21\x69\xf7\xef\xff\xaa"
+        "\x02\xbf\x55\x58\x49\xea\x45\xe1\x73\x9b\xf8\x81\xb7\x5b\x56\x68"
+        "\x44\xa6\x17\x3a\xcf\xed\xed\x66\xf0\xc4\xb7\x5b\x69\xa6\x85\xa6"
+        "\xe6\x47\xa1\xf5\xdc\xae\xad\xb4\xfd\xaf\x3f\xfe\xf3\x3f\x7e\x2f"
+        "\xbb\x66\x64\xe4\x81\x15\x66\x2d\x00\x11\xa6\xdd\x32\x36\x9e\xdb"
+        "\x6e\x96\xc5\x5d\x0c\x4b\x0d\xd7\x0a\xb4\xf4\x47\xe0\x19\x49\x94"
+        "\x46\x76\xf6\xc3\x88\x02\x2c\xb2\x6d\xcf\xb0\xb0\x32\x4a\x4c\x8c"
+        "\xc4\x09\x1c\x95\xe2\x24\x32\xac\x34\x05\xef\xeb\x69\x61\xa1\xa5"
+        "\xed\x1b\x9c\x51\x7d\x0d\xcd\x4c\xb4\x12\x4c\x86\x80\x34\x66\xb8"
+        "\x5a\x92\x59\xd5\x1b\x06\xf1\xcb\x20\x0c\x26\x60\xfc\x23\x10\xf9"
+        "\x0d\x20\x60\x21\x49\x3c\x42\x51\xbf\x0c\xc5\x62\x90\xd5\x03\x10"
+        "\xfd\x2d\x20\xc0\xea\x01\x89\xf9\x1e\xd2\x27\xc6\xb1\xdf\x43\x22"
+        "\x1f\x91\xb8\xef\x21\x51\x8f\x48\xfc\xf7\x90\x1e\xd2\x29\x78\x4c"
+        "\xf0\x28\xb6\x42\xd0\x69\x47\x49\xa0\x65\xa0\x9a\x38\x58\xa0\x25"
+        "\xe7\x3c\x7e\x02\xc0\xb1\x96\x79\xba\xe7\x7b\x59\x0d\x30\x71\xf6"
+        "\x0e\xa3\x79\xe1\xf9\x1b\x8c\xc0\xac\x57\x84\x80\x32\x7f\x19\x81"
+        "\xc3\x82\xc8\xb4\x7c\xca\xbc\xa3\x44\xcf\xed\x3c\x09\xbb\xb7\xf9"
+        "\x4f\xaf\xf3\x21\xf5\x6e\x33\xff\xf6\xb8\xcf\x48\xbe\x62\x7f\x33"
+        "\x45\xbe\x89\x03\xb2\x1c\x4b\x2c\x1f\xf8\x22\x0a\x53\xd7\x8b\x5f"
+        "\x57\x78\xf0\x5d\x34\xd0\xe9\xde\x41\x8a\xbf\x32\xa2\x08\xfc\xf6"
+        "\xab\x3a\x11\x5f\x5c\x2e\x7f\x26\x4f\x72\xe3\xca\x37\xc0\xaf\xd0"
+        "\xbf\xf9\x3f\xf0\x1b\xe6\x7f\x8d\x48\xe0\x5f\x88\x08\x84\x78\x9d"
+        "\xf1\x15\x0a\x1f\xdf\x79\x67\x12\x80\x2c\x7c\x7b\xf1\xb7\x5c\xf3"
+        "\xce\xb9\xc4\x17\x05\xe4\x0e\x40\x3e\x00\xb0\x86\xf5\x45\xc1\xbf"
+        "\x63\xf0\x37\x0c\xcc\x78\x5b\xa1\x10\xc7\xfb\xe2\xd2\xb8\xe3\xb0"
+        "\xaf\x38\x9e\xf9\x0e\xe7\x7b\x64\xde\x01\xa4\xd6\xaf\x41\x30\x77"
+        "\x1e\x69\x1d\xbc\xb3\x28\x76\xfe\x5e\xda\x0e\x93\x28\x8f\xdf\xd0"
+        "\xbc\xbf\x87\x36\x7e\x13\xa1\x32\xfc\x35\x03\x71\xf6\x67\x1f\xc5"
+        "\xe9\xdf\x23\xb3\x76\xb5\x18\x68\x53\x60\x74\xc7\x4e\x18\x25\x9a"
+        "\xee\x03\x46\x20\x99\x5b\x20\x1f\x5b\x28\x02\xad\x26\x21\xe0\xa3"
+        "\xd5\xe4\x58\x0b\x0a\x41\xfb\x0f\x70\x7c\xd1\x23\xb3\x86\xcf\x18"
+        "\xf4\xd0\xdd\x58\x4b\xb4\x31\xc8\x1c\xae\xc7\xf0\x22\x3b\x20\xda"
+        "\xa8\x15\x88\x7f\x06\x5b\xa9\x3e\xd9\x13\xfb\xd4\x00\xb4\x76\xc1"
+        "\x51\xc9\x5c\x3d\xb7\x81\x3d\x04\x2e\x73\xfc\x6b\x93\x6c\xd9\x5a"
+        "\xee\x67\xb0\x87\x1b\xd0\x34\xc9\xa1\xb7\x24\xf0\x23\xfb\x63\x64"
+        "\xf9\x7e\xd4\x02\xf4\x7d\xf3\x77\x0c\x36\xc0\xcf\x04\x7d\xc6\x8f"
+        "\x24\x18\x8a\x64\x58\x40\xe4\x23\x09\x82\xc2\x49\x12\x67\x85\x0f"
+        "\x24\x6e\xaf\xfa\x02\x89\x44\x41\x8f\x30\x52\x92\x28\xb2\xb1\x86"
+        "\x01\x6c\x03\xfe\x13\xfd\xcc\x4a\x42\x2d\xb3\x7a\x51\x98\x01\x9d"
+        "\x45\x8d\x3d\x37\x02\xde\x6f\xad\xac\x4b\xee\x25\x16\x88\x15\x08"
+        "\x18\x82\xbb\x89\x1a\x28\xc6\x5d\x2d\x34\xdc\x28\x69\x99\x5e\x9a"
+        "\x6d\xc0\x5b\xdb\xa8\x24\xbd\x96\x66\x80\x36\x41\x53\xf8\xad\xba"
+        "\x7a\xab\xa6\x5e\x10\xfb\x96\x12\xa5\x68\x6c\xb3\x41\x14\xd6\xc8"
+        "\xf2\x1c\x17\xd0\x27\x19\x82\x65\x04\x92\xa5\xdb\x2d\xdd\x72\xbd"
+        "\xd0\x04\x3b\x00\x1a\xe8\x47\xc6\xd9\x32\x9b\xa2\x56\x47\x79\x36"
+        "\x0e\x7b\xc0\xb7\x00\xb7\xdd\xd2\x80\x8f\xcb\x25\x38\xcc\xfa\x5a"
+        "\x8c\x1a\x60\xac\x6f\x0c\x1b\xb7\x8a\x24\x88\xd9\xbd\xc3\x32\x3d"
+        "\xe4\x57\x52\xe2\xfa\x3c\xd0\x81\x36\x32\xe8\x95\x57\xab\x42\x6f"
+        "\xa9\xe1\x27\x86\xba\xe2\x28\xf5\xe0\x2e\x36\x7a\xa5\x3b\x48\x22"
+        "\xb0\x8b\x19\x91\x9f\x07\x61\xfb\x3e\x66\x69\xdb\xa9\x95\xfd\x21"
+        "\xe0\x34\xcf\x31\xc0\xcb\xef\x1b\xef\xd5\x06\xe7\x03\xea\xee\x27"
+        "\x54\x98\x0c\x4e\xa2\xc5\xee\xcf\xc0\x2c\x21\x10\xe4\x5f\x02\xef"
+        "\xd0\x0c\x90\x36\xf0\x74\x0e\x0f\xd2\x14\x49\xf2\x02\xc7\xb4\x5b"
+        "\x06\x30\x07\x94\x59\x1c\xbf\x1b\x65\xd9\xb6\x65\x64\xfd\x66\x2c"
+        "\xf0\x23\xc5\x13\xb0\xb3\x05\x82\xc0\x91\x94\x00\x8b\x60\xdb\xa7"
+        "\x38\x82\x86\xf3\xf5\xd7\xd6\x66\x76\x09\x08\x2e\xc0\xc5\xa0\xa9"
+        "\x81\x1b\x81\x92\xb4\xa0\x00\x03\x1f\x87\x5a\x00\x96\xe3\x06\xb0"
+        "\x68\x49\x51\xd5\x22\x6e\x33\x8c\x45\x31\x84\x56\x79\xc6\x20\x01"
+        "\x23\x94\x04\x34\x6b\x5d\xa7\x69\xba\x9f\x6f\xbe\xb1\xb5\xa2\x0d"
+        "\xed\x1d\x94\xac\x65\x5a\x2b\x4f\xfe\xa6\xde\x35\x12\x03\x89\x03"
+        "\xbd\x4a\xe3\xa6\x00\x4c\x58\xc7\xc0\xd0\xac\x02\x86\x41\x5b\xb1"
+        "\xa6\x3d\x8d\xe1\x72\xd2\xba\x95\x9d\x04\xad\x24\x02\x1e\x24\x04"
+        "\x86\xe6\x78\x96\x43\xc4\xc0\xab\x7e\xca\x29\x0d\xc6\xe8\x2f\x03"
+        "\x84\x35\x68\x70\x68\x9c\xa4\xd9\xd0\x8a\x82\x16\x2c\x3c\xb7\x13"
+        "\x10\x35\x04\xab\x15\xb3\x34\x6b\x86\xde\x87\xc0\xe6\x34\xf2\x3d"
+        "\x73\xe0\xf9\x3e\xaa\x40\xdb\xad\x9e\x9f\xb4\x0a\x0d\xc4\xd8\xcf"
+        "\x88\x1b\xf8\x87\x51\x7e\xd8\x02\x27\x0a\x96\x62\xf0\xf6\x03\x02"
+        "\x84\x7e\x9d\xaf\xfb\x9a\x71\x7e\x44\xc0\x20\x04\xca\xc4\xbb\x2f"
+        "\x60\x29\xab\xf4\x0a\x89\x20\x78\xbe\xca\xcb\xcf\x8a\x47\x11\x8c"
+        "\xc0\xf5\x91\xb6\xbd\x53\x3c\x52\xc0\x29\x89\x40\x62\xfc\x1d\xc5"
+        "\xbb\xc9\xee\x8f\x96\x5a\x5a\x49\x56\xff\x68\xed\xbf\xa8\xbf\xb8"
+        "\x24\xf3\xa2\xc0\x33\x3f\xe9\xaf\x34\x90\x78\x92\xe6\x7f\x9d\x4d"
+        "\x0c\x15\xb7\x9f\x24\x60\x54\x56\xc7\x60\x55\xa4\x31\x20\xb6\xce"
+        "\xc0\xed\x02\xe5\xce\x9d\x6e\x90\xc7\xa6\xfd\x81\xdf\x9f\xcd\xed"
+        "\x87\x66\x1b\xbb\xd3\xc7\x7e\x72\x2e\xf6\xce\xed\xa0\x04\x37\x3a"
+        "\x90\xad\x28\x21\xa1\xf0\xc6\xc6\xc0\x03\xd1\x9c\x69\x69\xa6\x00"
+        "\x83\x51\x23\x10\xcd\x0c\x2a\xa7\x0d\x14\xf4\xb9\x1d\xdd\x4a\xed"
+        "\x16\x50\xce\xeb\x67\xed\x70\x3c\x58\x59\xa0\x17\x98\x9e\x40\xb9"
+        "\x4d\x2f\xb9\x96\x80\xdd\xd8\x1f\x87\x40\xd2\x05\x82\xa6\xa1\x88"
+        "\xa0\x0a\xcd\x70\x24\x94\x91\xf7\x3d\xfa\xfb\x9e\x30\x0f\x7a\x51"
+        "\xa3\xe1\x80\x1d\x2a\xc2\xf1\x99\x7f\x2f\xda\x40\x11\x41\xf0\x4c"
+        "\x31\x69\x6c\x68\x34\xfd\xb9\x9d\xdd\x8b\xbd\x2c\x69\x06\x46\x89"
+        "\x61\x89\x22\x2a\x37\x37\xb0\x59\xb8\x86\x5f\x4c\x10\xed\x7b\x16"
+        "\x6f\xaa\xbd\x96\xc4\xb7\x55\x04\x63\xbb\x88\xee\xab\xfc\x61\x31"
+        "\x35\x63\x61\x47\x18\x89\x79\x16\xd9\x1e\xea\x7c\xf3\xea\xad\x82"
+        "\xa4\x01\xfb\xa0\x3d\xef\xeb\x8d\x3a\x37\x4c\x51\xb8\x5e\x77\x50"
+        "\xec\x75\x9f\x45\x5b\xee\x00\x6c\x61\x3a\x58\x5b\x28\xf0\x9e\x01"
+        "\x62\x59\x74\x53\x48\x0e\x86\x1e\x25\xe3\x67\xbb\x19\x14\xdc\x7f"
+        "\x57\x40\x31\xf0\x7f\x67\x24\x4e\x42\xcb\x81\xaf\x52\xef\x0a\xb2"
+        "\x85\x24\x80\x94\xfc\x13\x7d\xb6\x5b\x11\x58\x96\x70\x73\x85\x63"
+        "\x80\x6b\xdc\xe7\x76\xf0\x4f\xbf\xe9\x4c\x9a\x81\x7e\xf3\xa8\xa0"
+        "\x37\xc0\xab\xb3\x24\x3a\x5b\xad\x53\xe4\x85\x69\x56\xc3\xd3\x55"
+        "\xe0\x81\x83\x02\xcc\xbc\xa2\x0b\x01\x5a\xc0\x40\xd3\x03\x49\x87"
+        "\x48\x46\x67\x14\x91\xa8\x6b\x44\x61\x08\xe4\xa9\xc9\x57\x24\x54"
+        "\xd0\x6b\xef\x4c\x79\xb5\x0b\x71\x7f\xb7\x47\x20\x8a\xef\xec\x49"
+        "\x09\x9c\x04\x17\xe7\x06\xe9\x1f\x1f\x8c\xbc\x31\xba\xef\x79\x5d"
+        "\x4d\x07\x52\x94\x67\xd6\x6f\xe0\x02\xee\x78\xe1\x93\x6f\xd9\x59"
+        "\x97\x23\x7e\x90\x4c\x9c\xdd\xdb\xb2\x28\xee\xd2\xfc\x0f\x0e\x36"
+        "\x95\x9e\x99\xb9\x5d\x92\xa1\x9b\x11\x2e\x3a\x79\x74\x09\x1e\x07"
+        "\x15\xb0\x56\xd0\x7d\xb5\xfb\x44\x92\x34\xd8\xf9\x58\xdb\xfc\xed"
+        "\xfa\x04\x8e\x21\x56\xd5\x7d\x3d\x9a\xfc\x56\x78\xe9\xed\x7e\xdf"
+        "\x45\x45\x1f\xbc\x3b\x8d\x9e\xe0\x7a\x78\x42\xec\xba\xcd\xa2\x78"
+        "\x6b\x85\x67\x20\x10\x41\xab\x21\x27\x40\x62\x0f\x5d\x90\x23\xfe"
+        "\x49\x7b\x82\xf8\x7d\x3e\x47\x8f\xb2\x0c\x5c\x11\x9b\x69\x77\x8f"
+        "\x3c\x81\x44\xf1\xae\x40\x14\x34\xff\x9d\x73\x3e\x1f\xf0\x74\x3f"
+        "\x7b\x20\xb5\xfb\x38\x0a\xae\x75\xcf\xf8\x53\x90\x7b\xf7\x4f\x10"
+        "\xc5\x13\x7c\x3c\x35\xf9\xda\x05\x46\xc1\xd8\x3a\x76\x65\x82\xb5"
+        "\xf1\xdc\xde\xf6\x53\x59\x92\x54\x51\x72\xc4\xb1\x08\xfe\xc6\x6a"
+        "\x8f\x74\xae\xde\x1a\x73\x40\x65\xd9\x97\xc0\xe7\x06\xb6\xef\xf1"
+        "\x45\xa1\x87\x2b\x1f\xfc\xb3\x77\x23\xbf\x7c\x39\x2c\xcc\x59\xe8"
+        "\x66\xfa\x64\xbd\x52\xb7\x9c\x3c\x97\xa4\xc1\x7f\xfd\xa3\x12\x7f"
+        "\x13\xf0\x93\x51\xda\xe3\xfd\x64\xcb\x72\xaa\xe8\xf8\xec\x71\x8a"
+        "\xaf\xf1\x5e\x34\x1a\x4a\xe7\x4d\x35\x9d\xbd\x0c\x2b\x66\x33\x74"
+        "\x8b\x13\xb3\x24\x87\xf8\x7a\xb5\x5f\x44\x57\x8c\xe3\xc3\x5c\x28"
+        "\x8d\xea\x3c\x98\x0f\x17\x0e\x7b\xc9\xd5\xcb\x8c\x5d\x89\x08\x10"
+        "\x4f\x99\x23\xeb\x25\x4c\x91\x09\xbe\x4c\x4c\x4a\x49\x1e\x97\xcb"
+        "\xf9\x64\x3a\x8a\x47\x7e\x9c\xb0\xc2\xd4\x36\x47\xa7\xba\x5a\x07"
+        "\x89\xb7\xb6\x8f\xd7\xce\x76\x1d\xee\x95\x23\x27\xe6\xf6\x62\xac"
+        "\x99\x53\x76\xde\x9f\xcc\x2b\x41\x8c\x65\x2c\x92\x11\xe0\xd2\xdf"
+        "\x24\x51\xe2\x1e\x48\x7f\xd0\xf7\xfc\xc0\x58\x92\x2b\x73\x91\x9d"
+        "\x7a\x4c\x25\x0f\x84\xb8\x97\x6f\xea\xa3\x24\x31\xba\xc7\xea\x2a"
+        "\x9d\xd6\xd1\x84\x72\x84\xbd\x8a\xd7\xe0\x5c\x33\xbb\x3a\xcc\xd4"
+        "\xec\x1d\xfc\xe9\xec\x54\x18\x7b\x5e\xa0\x10\xe0\x7a\xbb\xbc\x1c"
+        "\xca\xf0\xca\xc8\x89\x13\x8e\xb2\xc9\xa6\x5a\xa6\xaa\xdd\x9f\x8e"
+        "\x37\x9c\x1c\xc8\xeb\x6d\x4f\xab\x4a\x6e\x75\x09\x79\x8e\xe7\x5e"
+        "\xd2\x60\x35\x17\x2c\x72\x17\x28\x96\xb4\xa0\xf3\xcb\xb1\xd8\x64"
+        "\x7b\xee\x54\x78\x27\x47\x58\x60\x35\x02\x9c\xa4\x07\xcb\x98\x5d"
+        "\xf0\x4b\x67\x2f\xb3\x01\x0f\xdc\x2f\x63\x58\x39\x17\x1f\x83\x25"
+        "\xd2\xd8\x7a\x84\x11\x30\x58\x13\x15\x06\x6b\x06\xdb\x0f\xd4\xc4"
+        "\xd7\x47\xf3\x62\x16\x4e\x7c\x04\xa8\x8f\x96\xe7\xf3\x7c\x70\x29"
+        "\xaf\xe2\xdc\xcd\x3b\x72\x71\x54\x56\xf6\x61\xa8\x95\x95\x77\xda"
+        "\x78\x9d\x13\x3e\x2c\xe2\x51\x2a\x1f\xbd\x60\xae\xed\xf1\x63\x4d"
+        "\xda\x09\x39\xa7\x15\x69\x1e\x26\xfa\x56\xc7\x54\x81\xf6\x31\x1b"
+        "\x73\xe7\x1e\x71\x59\x35\x0c\x77\x63\x32\x5d\x66\xec\x76\xe2\x98"
+        "\x9d\x17\x4f\x76\x6c\x7b\xc6\x5b\xe7\x81\x3f\x58\xeb\xc5\x0e\x8f"
+        "\x22\xba\xaf\xf7\xdc\xeb\xb0\xa2\x6d\x61\xb8\x32\x75\x92\x19\xcd"
+        "\xd3\xa3\x7b\xf1\x7b\xe5\x90\xf1\x93\xd9\x45\xd0\xbd\x97\x73\xb5"
+        "\x5f\x7a\x97\x23\x02\x24\xc9\xa3\xb7\x49\x34\xf2\x7c\x9c\xe7\x84"
+        "\x4f\x64\xaa\x4c\xe1\x98\xae\x04\x54\x59\x1e\x17\x78\x45\xf0\x8e"
+        "\x4e\x33\xa2\xa9\x82\xae\x98\x39\x61\xe9\x40\x22\x37\xf8\x40\xe5"
+        "\x56\x78\xb8\x59\xf4\x77\xd4\x89\x8d\x04\xdb\x52\xaf\x49\x44\x78"
+        "\x4d\x94\xf7\x22\x41\x0f\x82\x8e\xca\x6b\x84\xc6\x77\xa4\x22\xc7"
+        "\x4c\xcc\x9c\xeb\xe4\xe4\xc8\xe4\x9e\xa2\xbb\x43\xec\x9c\x85\xb4"
+        "\x71\x19\x6e\x31\x2b\xa1\x62\xa3\x28\x7b\x7f\xe6\x67\x04\x38\x56"
+        "\x65\xd5\x61\x62\x75\xe7\x80\xb6\x59\xbf\x0f\xd7\x07\xec\x7c\x19"
+        "\x4d\xae\x33\x72\x5b\xeb\xf8\xaa\x38\xd6\x0c\xad\xef\xeb\x74\xd7"
+        "\x27\x0a\x12\xf8\xba\x50\xb1\xa3\x5d\x49\xf8\xa1\x43\x9e\x3b\x7b"
+        "\x4f\x5e\xf6\x0f\x7b\x70\x53\x68\x00\x23\x8f\x52\xe5\x13\x0e\x76"
+        "\xb7\xf2\x78\xc6\x77\x8b\x6d\x30\xa1\x0a\x8a\x51\xbc\x78\xee\x53"
+        "\x60\x49\xcd\x9c\xc9\x40\x39\x75\x56\x27\x76\x13\xee\x08\xf2\x44"
+        "\xee\x8e\xcc\x81\x99\xc7\x9d\xa5\x98\x32\x78\xf9\xb2\xde\xef\xb2"
+        "\x83\x53\x74\x38\x3b\x24\x9b\x95\x52\xee\x42\xc5\x71\x37\xbd\x33"
+        "\x31\x1c\xd8\xd5\xc2\x3a\xb0\x44\x47\x71\x5d\x2a\xbb\xbc\x0c\xb3"
+        "\x29\x58\x0c\x67\x43\xa4\xc3\x2a\x15\x8e\x7b\x5b\x22\x7b\xe1\x7e"
+        "\xff\xe2\x93\xc5\xae\x37\x12\x86\x3b\xf7\xdc\x9f\x52\xd3\x45\x6f"
+        "\xe6\xb1\x04\x5b\xe1\x0d\x43\x67\xc7\x45\xdc\xc2\x0d\xcf\x9d\xda"
+        "\xf7\xab\x78\xb4\x0d\x7d\x45\x2f\xa9\xbc\x96\xec\x89\xc2\x5e\xb6"
+        "\xa7\x31\xbf\x9b\xec\x0e\x8e\x15\xf4\xc6\x9c\xa5\x6e\x62\x7b\xb9"
+        "\xdb\xd4\xd7\x6a\x77\x9d\x1f\x62\xb2\x64\x89\x84\xd4\x8e\x2e\x56"
+        "\x4f\xc7\x4d\xda\x64\xc6\xf0\x24\xb1\x91\xde\x57\x37\x7a\xae\x44"
+        "\xca\xe5\xa2\xed\x4f\xa7\x6a\x47\x6f\xab\xf5\x99\x18\xec\x88\xdd"
+        "\xd4\x1f\xfa\xf2\x62\x3c\x12\x0e\x57\x73\xa1\xed\x27\xbb\x8b\xb3"
+        "\x39\x59\xa3\x60\x53\x63\xb4\xb0\xa7\x02\xde\x1e\x81\xa3\x84\x30"
+        "\xa6\xaf\x4d\x50\xaa\x0b\xce\x0e\x7c\xc2\x39\x90\xc1\xc9\x21\xbd"
+        "\xe5\x85\x22\xe6\x74\xcf\x9a\x0d\x7b\xae\x73\x4d\x3d\x8b\xeb\x8c"
+        "\xe6\x95\x6e\xee\x34\xc6\x3d\x79\x72\x4e\x8f\xc6\x7c\xe0\x03\x27"
+        "\x9e\xcf\xb3\xdd\xdc\x10\xdd\x4e\x55\x48\xec\xf9\x94\xd1\x9b\x06"
+        "\xd0\x96\x3d\x3e\x9f\xd4\xcb\xe5\xcb\x72\x5c\xbe\x70\x67\x6b\x1f"
+        "\x0f\xb3\x60\x39\x4b\x16\x3a\xc3\xf7\x77\xab\x92\x9d\xac\x8c\xb1"
+        "\x69\x4d\xfc\x4b\x55\xd8\x73\x69\xa8\xf6\x58\x17\x5f\xd3\x13\x82"
+        "\x3c\x64\xdc\x61\xcf\xae\x66\xe1\x8a\x20\x92\x8a\x3b\xf6\x10\x60"
+        "\x68\x1a\x2e\x73\x2c\x8b\x8d\x2f\x6b\xe9\x4c\x77\xce\xd8\xa2\x0a"
+        "\x23\x57\x39\xc6\x23\x96\x57\x88\x69\x0f\x3b\x0b\xbb\x90\x9a\x3a"
+        "\x93\x94\x34\xfa\xda\xc2\xf4\x63\x10\x88\x75\x92\xb8\x66\xb4\xb2"
+        "\xb6\xba\xd9\x2f\xd6\xaa\xf8\x52\x30\x40\x81\x11\x20\x75\x2a\xdc"
+        "\x92\x5d\x94\x43\x19\xc8\xd3\xe6\xea\x8a\x5b\xcb\xef\x19\xbe\xaa"
+        "\x53\x43\x72\x52\xd8\x57\x1d\x63\xc7\x2b\x8c\x5f\x31\xda\x75\x40"
+        "\x4b\xba\x81\x09\xce\x38\xbe\x9e\x36\x87\x12\x0f\x68\x6a\x5c\x0e"
+        "\xd3\xdd\x64\xc3\xd8\x2b\x4b\x4e\xfa\x08\xb0\x5a\x11\xa3\x5d\x6a"
+        "\xac\x52\x32\xc8\x7b\xea\xc5\xed\xf0\x4e\x1e\xac\xfa\xb6\xb0\x60"
+        "\xd3\x91\xbc\x2d\xc8\xd9\xc0\xb7\xa5\xad\x7b\x5c\x6f\xac\x59\x78"
+        "\x3a\x06\x82\xe9\x66\x38\x77\xdc\x6a\xc1\xbe\x2e\x37\x3d\x7d\x90"
+        "\xae\xb8\xb4\xde\xf8\x2f\x03\xb6\x61\xc8\x53\x21\x77\xde\xd2\x24"
+        "\x66\x5c\x8f\xd2\x26\xd7\x36\x98\x77\x2c\xb4\x3c\xd9\x64\x29\xb6"
+        "\x98\xa9\x86\xbb\x8c\x2e\xbe\xa2\x44\xbc\xc8\xed\x0e\x85\x99\xae"
+        "\xac\x78\x66\xe3\xcb\x8a\xdf\x72\x85\x67\x6f\xb9\x2b\xb6\xa0\x5d"
+        "\x03\xc9\x1e\x02\xfc\x5c\xfb\x24\x97\xe0\x66\x2c\x55\xc2\x5a\x04"
+        "\xb5\x4f\x79\x5b\x8e\xab\xc2\x24\x99\xfa\xe5\x70\xcc\xad\x21\x91"
+        "\x6e\xc6\x82\xb4\xa1\x17\x62\x7f\x7c\x28\x1a\xf9\x2a\xd8\xd1\xf5"
+        "\xc5\xa5\x53\x3c\xd7\x9d\x58\xab\x17\x63\x3d\x5a\xef\xa9\x75\xed"
+        "\x08\x47\x52\x1a\x8e\xb9\x5e\x5d\xaf\xf1\x42\x10\x8e\x74\xa8\x6c"
+        "\x29\xeb\x3a\xcf\x75\x8e\xdc\x73\xa4\xad\x7b\xee\x54\x29\x46\x3d"
+        "\xff\x38\xf3\xc6\xea\x7a\xb6\x6d\xd2\x66\xb4\xd9\x4e\xeb\xc2\x0e"
+        "\xf3\xd2\x50\x95\xc0\xa9\xf3\xd0\xea\xf7\x3c\x2e\x3a\xbe\x98\xf6"
+        "\x81\xdc\xb2\x0b\x8b\x99\x4b\xd7\xd2\x54\xeb\x39\xed\x8e\xea\xcb"
+        "\x40\x57\x5d\x79\x1a\x6c\x8b\x80\x5b\x69\x89\x50\x8a\xd5\xcc\x56"
+        "\xb2\x2a\x32\xf7\x22\x83\x00\x17\xd9\x74\xde\x49\xaf\x6e\x16\x5b"
+        "\xc9\xb4\x7f\x39\x13\x2b\xaa\x72\x89\xa3\xb2\x9f\xad\x80\xa2\xd0"
+        "\xe1\x85\x17\x95\x9d\x7d\x15\x76\x6a\xa5\xe8\x9d\xfd\x76\xd1\xeb"
+        "\x14\x2f\xfa\x50\x91\x5d\xcb\xd7\x03\x2c\xa8\x6a\x72\xec\x8c\x14"
+        "\x7a\xce\xcf\x1b\x93\x95\xcb\x42\xbe\x9e\xeb\x5d\xc0\xbb\x34\xae"
+        "\x2f\xac\x84\x9c\x92\xd3\xec\x64\xf0\xe4\x4a\xee\x7b\x1d\xe6\x30"
+        "\xdd\x39\x23\x7b\x31\x64\xe2\x90\x3f\xd4\x23\x4c\x54\x45\x11\xc3"
+        "\x78\x59\x1c\x48\x33\x51\x1d\x67\xe2\xa3\x1e\x7e\x7e\x52\x78\xfc"
+        "\x93\x74\x95\x14\x72\x73\xb8\xcb\xcd\x81\xb0\xb5\x0e\x92\x6f\x10"
+        "\x38\x0a\x0c\x08\xaa\x24\x7a\x78\x03\x38\x10\xc5\xa1\x28\x42\x34"
+        "\xd1\x15\xe5\x93\x30\xb6\xb1\x3d\xac\xf8\x22\xd4\xda\xf4\x01\x76"
+        "\x56\x82\xf6\x81\x50\xbf\xec\xab\xeb\xac\x66\xd0\xf3\xcf\x01\x17"
+        "\x3d\x39\xf0\xa5\x3d\xac\xa6\x2a\xb0\x4d\xa4\x1f\x01\xa1\xb2\x0f"
+        "\x57\xb5\x51\x0b\xfe\x3c\x10\xfa\x3a\x39\x7f\x65\x89\x00\x21\xf2"
+        "\x07\xd0\xe1\xe8\x90\x16\x89\x0d\x2b\x3d\x07\xb2\xe4\x1f\x40\x53"
+        "\xe8\xc8\x06\xf4\xac\x53\x66\x6e\x04\x3b\x12\x1e\x9c\x9a\x7d\x19"
+        "\x38\x57\x52\x8f\x8d\x97\x44\x60\xa7\x32\x87\x50\xbc\xa4\xa2\xa6"
+        "\x67\x34\x08\x5c\xa6\xc0\xad\xde\x88\x7c\x78\xd1\x2a\x5d\x70\xf0"
+        "\x6f\xfd\x37\x45\xe2\xc4\xff\xc0\xa3\x37\xbc\x17\x94\xb7\xef\xea"
+        "\x7e\x80\xe3\x33\xba\x2e\xc0\x03\x9f\x1e\xfd\xff\x65\xff\xff\xf6"
+        "\xb2\xff\xce\xef\xf7\x2b\x56\x33\x16\xdd\x1f\xb1\x0f\xb7\x4a\xec"
+        "\xd3\xef\x7a\xef\x6f\xbf\x11\xbb\x20\x07\x7e\xea\xb9\x14\xdc\xe5"
+        "\x94\xe4\x13\x97\x20\xf2\xce\xfa\x0a\xba\x4a\xf8\x1d\xaf\x00\x7f"
+        "\xee\x2c\xbb\xe0\x86\x49\xb0\x3c\xc5\x37\x86\xc7\xce\x5c\x43\xa6"
+        "\x45\xf0\xeb\x59\xf4\x35\x00\x40\x6a\x92\xe8\x5e\x6d\x6e\x32\x6f"
+        "\x75\x78\x51\x7a\xab\xb9\x96\x66\x5a\x20\x1d\x39\x1c\x05\xc6\x8e"
+        "\xa2\xec\x5d\xd5\xc9\x33\x54\x6d\xbe\x9c\x04\xb7\x50\x3f\x05\xad"
+        "\x69\xac\x19\x56\x33\x06\x35\x9b\x91\x31\x4c\xe0\x6f\x02\x5d\xdf"
+        "\x0b\x2d\xc5\xcb\x0c\xc0\x92\x62\xf1\x9b\x8b\x1b\x13\x51\xb1\xf9"
+        "\x85\x00\x7b\xfb\x9f\x0e\x7f\xfc\x2f",
+        3656,
+        8495,
+        0x1cde04ff
     },
 
     {
@@ -179,7 +507,40 @@ const docx_template_item_t docx_template_items[] =
                 "<w:charset w:val=\"00\"/>"
                 "<w:family w:val=\"swiss\"/>"
                 "<w:pitch w:val=\"variable\"/>"
-                "<w:sig w:usb0=\"E4002EFF\" w:usb1=\"C000247B\" w:usb2=\"00000009\" w:usb3=\"00000000\" w:csb0=\"000001FF\" w:csb1=\"00000000\"/></w:font></w:fonts>"
+                "<w:sig w:usb0=\"E4002EFF\" w:usb1=\"C000247B\" w:usb2=\"00000009\" w:usb3=\"00000000\" w:csb0=\"000001FF\" w:csb1=\"00000000\"/></w:font></w:fonts>",
+        "\xdd\x92\xdb\x8e\x9b\x30\x10\x86\xef\x2b\xf5\x1d\x2c\xdf\x6f"
+        "\x30\xe4\xb0\x29\x5a\xb2\x52\xdb\x8d\x54\xa9\xea\x45\xb5\x7d\x00"
+        "\xc7\x18\x18\xd5\x07\xe4\x71\xc2\xe6\xed\x6b\x0c\xa1\x91\xd2\x95"
+        "\x96\x5e\xf4\xa2\x20\x19\xfb\x1f\xcf\xe7\xf1\xcf\x3c\x3c\xbe\x68"
+        "\x45\x4e\xd2\x21\x58\x53\xd0\x74\xc1\x28\x91\x46\xd8\x12\x4c\x5d"
+        "\xd0\x1f\xcf\xfb\xbb\x2d\x25\xe8\xb9\x29\xb9\xb2\x46\x16\xf4\x2c"
+        "\x91\x3e\xee\xde\xbf\x7b\xe8\xf2\xca\x1a\x8f\x24\xe4\x1b\xcc\xb5"
+        "\x28\x68\xe3\x7d\x9b\x27\x09\x8a\x46\x6a\x8e\x0b\xdb\x4a\x13\x82"
+        "\x95\x75\x9a\xfb\xb0\x74\x75\xa2\xb9\xfb\x79\x6c\xef\x84\xd5\x2d"
+        "\xf7\x70\x00\x05\xfe\x9c\x64\x8c\x6d\xe8\x88\x71\x6f\xa1\xd8\xaa"
+        "\x02\x21\x3f\x5b\x71\xd4\xd2\xf8\x98\x9f\x38\xa9\x02\xd1\x1a\x6c"
+        "\xa0\xc5\x0b\xad\x7b\x0b\xad\xb3\xae\x6c\x9d\x15\x12\x31\xdc\x59"
+        "\xab\x81\xa7\x39\x98\x09\x93\xae\x6e\x40\x1a\x84\xb3\x68\x2b\xbf"
+        "\x08\x97\x19\x2b\x8a\xa8\x90\x9e\xb2\x38\xd3\xea\x37\x60\x3d\x0f"
+        "\x90\xdd\x00\x36\x42\xbe\xcc\x63\x6c\x47\x46\x12\x32\xaf\x39\x50"
+        "\xce\xe3\x6c\x26\x0e\x94\x57\x9c\xbf\x2b\xe6\x0a\x80\x72\x1e\x62"
+        "\x7d\xa9\x03\xcf\xba\xbf\x91\x16\xf9\x97\xda\x58\xc7\x0f\x2a\x90"
+        "\xc2\x3f\x22\xc1\x66\x12\xc1\x64\xb8\x67\xff\x21\x83\x75\x74\x37"
+        "\xf6\x2b\xe9\x72\xc3\x75\x48\xf8\xc4\x15\x1c\x1c\xc4\x40\xcb\x8d"
+        "\x45\x99\x86\xd8\x89\xab\x82\xb2\x8c\xed\xd9\x3a\x8c\xfd\xbb\x62"
+        "\xcb\x7e\xa4\x49\xbf\x51\x34\xdc\xa1\xf4\xd3\x46\x36\xc8\x15\xd7"
+        "\xa0\xce\x17\x15\x3b\x40\x1c\x02\x2d\x78\xd1\x5c\xf4\x13\x77\xd0"
+        "\x17\x3b\x84\x10\xea\x10\x38\xe2\x81\x15\xf4\x69\xc5\x58\xf6\xb4"
+        "\xdf\xd3\x41\x49\x43\x75\x2c\x28\xab\xfb\x8f\xa3\x92\xf5\x67\xc5"
+        "\xe7\xc3\xa8\x2c\x27\x85\xf5\x8a\x88\x9c\xb8\x4c\x07\x8e\x88\x9c"
+        "\x69\x4f\x38\x33\x19\x1c\xb8\x71\xe2\x19\xb4\x44\xf2\x4d\x76\xe4"
+        "\xbb\xd5\xdc\xbc\xe2\x48\xc6\x36\xc1\x89\x75\xf0\xa3\x77\x66\x39"
+        "\xcb\x11\x17\xb9\xb3\x1c\x61\x7f\x72\xe4\x7e\xbb\xfe\x27\x8e\x8c"
+        "\xbd\x41\xbe\x42\xdd\xf8\x57\x3b\x64\xf9\xff\x76\xc8\x38\xc1\xdd"
+        "\x2f",
+        464,
+        1567,
+        0x9a97d49a
     },
 
     {
@@ -225,7 +586,74 @@ const docx_template_item_t docx_template_items[] =
                 "<w:listSeparator w:val=\",\"/>"
                 "<w14:docId w14:val=\"32E52EF8\"/>"
                 "<w15:chartTrackingRefBased/>"
-                "<w15:docId w15:val=\"{A10F59F7-497D-44D4-A338-47719734E7A0}\"/></w:settings>"
+                "<w15:docId w15:val=\"{A10F59F7-497D-44D4-A338-47719734E7A0}\"/></w:settings>",
+        "\xb5\x56\xdb\x6e\xdb\x38\x10\x7d\x5f\x60\xff\x41\xd0\xf3\x3a"
+        "\xba\x58\xb6\x13\xa1\x4e\x91\x9b\xdb\x14\xf1\x76\x51\x67\xb1\xcf"
+        "\x94\x48\xd9\x44\x78\x03\x49\xd9\x71\x17\xfb\xef\x3b\xa4\x44\xcb"
+        "\x69\x8a\x22\x69\x91\x27\x53\x73\x66\xce\x0c\x67\x86\x33\x7e\xf7"
+        "\xfe\x91\xb3\x68\x4b\xb4\xa1\x52\xcc\xe3\xec\x24\x8d\x23\x22\x6a"
+        "\x89\xa9\x58\xcf\xe3\xbf\xef\x17\xa3\xd3\x38\x32\x16\x09\x8c\x98"
+        "\x14\x64\x1e\xef\x89\x89\xdf\x9f\xff\xfe\xdb\xbb\x5d\x69\x88\xb5"
+        "\xa0\x66\x22\xa0\x10\xa6\xe4\xf5\x3c\xde\x58\xab\xca\x24\x31\xf5"
+        "\x86\x70\x64\x4e\xa4\x22\x02\xc0\x46\x6a\x8e\x2c\x7c\xea\x75\xc2"
+        "\x91\x7e\x68\xd5\xa8\x96\x5c\x21\x4b\x2b\xca\xa8\xdd\x27\x79\x9a"
+        "\x4e\xe3\x9e\x46\xce\xe3\x56\x8b\xb2\xa7\x18\x71\x5a\x6b\x69\x64"
+        "\x63\x9d\x49\x29\x9b\x86\xd6\xa4\xff\x09\x16\xfa\x25\x7e\x3b\x93"
+        "\x6b\x59\xb7\x9c\x08\xeb\x3d\x26\x9a\x30\x88\x41\x0a\xb3\xa1\xca"
+        "\x04\x36\xfe\xb3\x6c\x00\x6e\x02\xc9\xf6\x47\x97\xd8\x72\x16\xf4"
+        "\x76\x59\xfa\x82\xeb\xee\xa4\xc6\x07\x8b\x97\x84\xe7\x0c\x94\x96"
+        "\x35\x31\x06\x0a\xc4\x59\x08\x90\x8a\xc1\x71\xf1\x8c\xe8\xe0\xfb"
+        "\x04\x7c\xf7\x57\xf4\x54\x60\x9e\xa5\xfe\x74\x1c\xf9\xe4\x75\x04"
+        "\xf9\x33\x82\x69\x4d\x1e\x5f\xc7\x71\xda\x73\x24\x60\x79\xcc\x43"
+        "\xf1\xeb\x78\xa6\x07\x1e\x8a\x8f\x78\x7e\x2e\x98\x23\x02\x43\x5e"
+        "\x47\x31\x09\x71\x98\x3d\x1f\x6e\x64\xd8\x4b\x6a\xdc\x41\x77\xb4"
+        "\xd2\x48\xef\x8f\x0b\xcc\xeb\xf2\x76\x2d\xa4\x46\x15\x83\x70\xa0"
+        "\xd0\x11\xd4\x2a\xf2\xd1\x45\x5d\xb2\xdc\x4f\xd4\xe5\x3f\x3e\x87"
+        "\x87\xfc\x55\x4a\x1e\xed\x4a\x45\x74\x0d\xdd\x0c\x53\x20\x4d\xe3"
+        "\xc4\x01\xd0\x43\xb2\x59\x59\x64\xc1\xb2\x34\x8a\x30\xe6\xc7\x42"
+        "\xcd\x08\x02\x47\xbb\x72\xad\x11\x87\x07\x1d\x24\xde\x06\x93\x06"
+        "\xb5\xcc\xde\xa3\x6a\x65\xa5\x02\xa5\x2d\x82\xfb\xcc\xf2\x9e\xb2"
+        "\xde\x20\x8d\x6a\x4b\xf4\x4a\xa1\x1a\xd8\xae\xa4\xb0\x5a\xb2\xa0"
+        "\x87\xe5\x9f\xd2\x5e\xc1\x70\xd0\xd0\xbb\xbd\x85\x1f\x15\xc3\x69"
+        "\xd5\x8d\x1d\xb0\x10\x88\xc3\x0d\x9f\x8c\x92\xa5\xc4\xc4\x45\xd6"
+        "\x6a\xfa\xf2\x52\xc4\xc1\x7b\x36\x39\x76\xf9\xad\x23\x09\x63\x52"
+        "\x53\x4c\xee\x5d\x66\x57\x76\xcf\xc8\x02\x82\x5f\xd1\xaf\xe4\x42"
+        "\xe0\x4f\xad\xb1\x14\x18\xfd\x40\xf9\x85\x08\x7e\x14\x00\x11\xce"
+        "\xf3\x67\xe8\x85\xfb\xbd\x22\x0b\x82\x6c\x0b\x69\x7a\x23\x67\xbe"
+        "\x12\x0b\x46\xd5\x92\x6a\x2d\xf5\xad\xc0\xd0\x1b\x6f\xe6\x8c\x36"
+        "\x0d\xd1\xe0\x80\x42\xaf\x2d\xa1\x7d\xa8\x96\x3b\x9f\xe7\x8f\x04"
+        "\x61\xd8\x4e\x6f\xe4\xb7\x35\xe4\x1f\x50\x86\xa7\x38\xbe\x87\xb6"
+        "\x7c\xb8\x94\xd6\x4a\xfe\x71\xaf\x36\x90\xeb\x5f\xab\xa4\xef\xf7"
+        "\xe4\xb8\x7d\x61\xc7\x62\x13\x0e\x5f\xa4\xb4\x07\xd5\x74\xb6\x28"
+        "\x8a\x7c\xd6\x45\xea\xd0\x01\xc9\x27\x93\xa2\x38\xfd\x1e\x32\xd8"
+        "\x24\x07\x6e\x5e\xba\x2d\xf4\x97\x0e\x27\xd7\xa0\x11\xef\x2c\xae"
+        "\x10\xaf\x34\x45\xd1\xd2\xed\xa9\xc4\x69\x54\xfa\xe1\x92\x8a\x80"
+        "\x57\x04\xc6\x0b\x39\x46\x56\x6d\x15\xc0\xd1\xa8\x03\x0c\x47\x8c"
+        "\x2d\x20\x55\x01\x48\x3b\x39\xa6\x46\x5d\x93\xc6\x9f\xd9\x12\xe9"
+        "\xf5\xc0\xdb\x6b\xe8\xef\x4a\x61\x5a\x7c\x3a\x70\xb9\xe9\x43\xf4"
+        "\x07\x2d\x5b\xd5\xa1\x3b\x8d\x54\xd7\x78\x41\x25\x2b\x8a\xde\x92"
+        "\x0a\x7b\x47\x79\x90\x9b\xb6\x5a\x05\x2b\x01\x03\xf1\x08\x6a\x05"
+        "\xfe\xbc\xd5\x3e\x4f\x43\x7a\x76\xa5\x85\x42\xfa\x07\x7c\x87\x7c"
+        "\x43\x78\x5d\x22\x46\x1f\x2e\xfb\x86\x61\x7a\xe5\x8a\x4d\x96\x48"
+        "\xa9\xae\x67\xaa\x75\x36\x8f\x19\x5d\x6f\x6c\xe6\xca\x6c\xe1\x0b"
+        "\xc3\xdf\x19\xff\x51\xad\xf3\x1e\xcb\x3d\x96\x77\x98\xff\x40\xb5"
+        "\xbb\x19\x68\xf7\x87\x41\x96\x07\xd9\x91\xde\x38\xc8\xc6\x83\xac"
+        "\x08\xb2\x62\x90\x4d\x82\x6c\x32\xc8\xa6\x41\x36\x75\xb2\x0d\x4c"
+        "\x09\x0d\x23\xfb\x01\xda\x37\x1c\x9d\xbc\x91\x8c\xc9\x1d\xc1\x1f"
+        "\x07\xfc\x99\xa8\x4b\x82\xd9\x20\x45\xae\xbb\x89\x0e\xed\x25\x3b"
+        "\x41\x3f\xe2\x4d\xb4\x2d\xc9\x23\xec\x0b\x82\xa9\x85\x7f\x89\x8a"
+        "\x62\x8e\x1e\xdd\xfa\xc8\xa7\xce\xbc\xd7\x66\x68\x2f\x5b\xfb\x44"
+        "\xd7\x61\x4e\x59\x3d\x65\xc0\xc8\xa2\xfe\xc1\x26\x4f\x8c\x7d\x8b"
+        "\x7f\x13\x8b\xdb\x34\x35\x85\x76\x5c\xed\x79\x35\x2c\x90\x93\x2e"
+        "\x70\x46\x0d\x3c\x76\x05\xbb\xc6\x4a\x1d\xb0\x3f\x3c\x96\x15\x25"
+        "\x96\xf5\xad\xdb\x82\x45\x27\x1f\xe7\x37\x93\xfc\x66\xd1\xbd\xb2"
+        "\x6c\xe2\x77\x94\xf5\xf3\x00\xea\xfe\x85\x34\x97\xc8\x10\xdc\x63"
+        "\xc1\x74\xd2\x99\xfe\x7b\x91\xa5\x8b\xc9\xd9\x62\x36\x2a\xce\x66"
+        "\xd7\xa3\xa2\xb8\x2e\x46\x17\xe3\xf1\xe9\xa8\x98\xcd\xb2\xb3\xd9"
+        "\xb8\xb8\x99\x5d\xa4\xff\xf5\x8f\x34\xfc\x61\x3e\xff\x1f",
+        1021,
+        2934,
+        0xf944ad08
     },
 
     {
@@ -645,7 +1073,191 @@ const docx_template_item_t docx_template_items[] =
                 "<w:name w:val=\"No List\"/>"
                 "<w:uiPriority w:val=\"99\"/>"
                 "<w:semiHidden/>"
-                "<w:unhideWhenUsed/></w:style></w:styles>"
+                "<w:unhideWhenUsed/></w:style></w:styles>",
+        "\xbd\x9d\x5d\x53\xe3\x38\x16\x86\xef\xb7\x6a\xff\x83\x2b\x57"
+        "\xbb\x17\xdd\x21\x01\x42\xd3\x35\xf4\x14\xd0\xcd\x40\x4d\xd3\xc3"
+        "\x74\x60\xfa\x5a\xb1\x15\xa2\x45\xb6\xb2\x96\xdd\xc0\xfe\xfa\x95"
+        "\x65\x27\x71\x72\x2c\xc7\x47\x3e\xc3\x15\xe4\xe3\x3c\xfa\x78\xf5"
+        "\x4a\x3a\xfe\xca\x2f\xbf\xbe\xc4\x32\xf8\xc9\x53\x2d\x54\x72\x36"
+        "\x18\xbd\x3f\x18\x04\x3c\x09\x55\x24\x92\xc7\xb3\xc1\xc3\xfd\xd5"
+        "\xbb\x0f\x83\x40\x67\x2c\x89\x98\x54\x09\x3f\x1b\xbc\x72\x3d\xf8"
+        "\xf5\xd3\x3f\xff\xf1\xcb\xf3\x47\x9d\xbd\x4a\xae\x03\x03\x48\xf4"
+        "\xc7\x38\x3c\x1b\x2c\xb2\x6c\xf9\x71\x38\xd4\xe1\x82\xc7\x4c\xbf"
+        "\x57\x4b\x9e\x98\x0f\xe7\x2a\x8d\x59\x66\x5e\xa6\x8f\xc3\x98\xa5"
+        "\x4f\xf9\xf2\x5d\xa8\xe2\x25\xcb\xc4\x4c\x48\x91\xbd\x0e\xc7\x07"
+        "\x07\x93\x41\x85\x49\xbb\x50\xd4\x7c\x2e\x42\xfe\x59\x85\x79\xcc"
+        "\x93\xcc\xc6\x0f\x53\x2e\x0d\x51\x25\x7a\x21\x96\x7a\x45\x7b\xee"
+        "\x42\x7b\x56\x69\xb4\x4c\x55\xc8\xb5\x36\x8d\x8e\x65\xc9\x8b\x99"
+        "\x48\xd6\x98\xd1\x11\x00\xc5\x22\x4c\x95\x56\xf3\xec\xbd\x69\x4c"
+        "\x55\x23\x8b\x32\xe1\xa3\x03\xfb\x5f\x2c\x37\x80\x63\x1c\x60\x0c"
+        "\x00\x93\x90\xbf\xe0\x18\x1f\x2a\xc6\xd0\x44\xd6\x39\x22\xc2\x71"
+        "\x26\x6b\x8e\x88\x6a\x1c\xbf\xca\xd4\x00\x9a\xe3\x10\xc7\xab\x7a"
+        "\xe8\xd7\xb8\x68\x51\x1c\x7e\xbc\x79\x4c\x54\xca\x66\xd2\x90\x8c"
+        "\x46\x81\xe9\xe6\xc0\x82\x83\xb2\x9d\xc5\x9f\xa0\xec\xba\xc1\x27"
+        "\x33\x60\x23\x15\x7e\xe6\x73\x96\xcb\x4c\x17\x2f\xd3\xbb\xb4\x7a"
+        "\x59\xbd\xb2\x7f\xae\x54\x92\xe9\xe0\xf9\x23\xd3\xa1\x10\xf7\xa6"
+        "\x5e\x06\x1e\x0b\x53\xce\xf5\x79\xa2\xc5\xc0\x7c\xc2\x99\xce\xce"
+        "\xb5\x60\x8d\x1f\x2e\x8a\x7f\x1a\x3f\x09\x75\x56\x7b\xfb\x42\x44"
+        "\x62\x30\x2c\x4a\xd4\xff\x33\x1f\xfe\x64\xf2\x6c\x30\x1e\xaf\xde"
+        "\xb9\xd4\xbb\xef\x49\x96\x3c\xae\xde\xe3\xc9\xbb\xdf\x2e\xea\x35"
+        "\xb1\x6f\x3d\x4c\x8b\xb7\x66\x86\x7b\x36\x60\xe9\xbb\xe9\x79\x11"
+        "\x38\xac\x1a\x36\xdc\x6d\xee\x72\xf7\x95\x2d\x78\xc9\x42\x61\xcb"
+        "\x61\xf3\x8c\x1b\x2f\x8e\x26\x07\x05\x54\x8a\xc2\xfa\xe3\xe3\xd3"
+        "\xd5\x8b\xef\x79\xd1\xe7\x2c\xcf\x54\x55\xc8\xb2\x2a\xa4\x8e\x1d"
+        "\x82\x1e\x37\x16\x35\x86\x9d\x96\xf3\x86\xf9\x94\xcf\xbf\xaa\xf0"
+        "\x89\x47\xd3\xcc\x7c\x70\x36\xb0\x65\x99\x37\x1f\x6e\xee\x52\xa1"
+        "\x52\x33\x37\x9c\x0d\x4e\x4f\xab\x37\xa7\x3c\x16\xd7\x22\x8a\x78"
+        "\x52\xfb\x62\xb2\x10\x11\xff\xb1\xe0\xc9\x83\xe6\xd1\xe6\xfd\x3f"
+        "\xaf\xac\xbf\xab\x37\x42\x95\x27\xe6\xff\xc3\x93\x89\x1d\x05\x52"
+        "\x47\x5f\x5e\x42\xbe\x2c\x66\x0b\xf3\x69\xc2\x0a\x4d\xbe\x15\x01"
+        "\xb2\xf8\x76\x2e\x36\x85\xdb\xf0\xff\xae\x60\xa3\x4a\x89\xa6\xf8"
+        "\x05\x67\xc5\x94\x19\x8c\x76\x11\xa7\x68\xc4\xb8\x88\xd0\xb5\xd6"
+        "\x36\x33\xf3\x9d\xb6\x8f\xd0\x05\x1d\xbe\x55\x41\x47\x6f\x55\xd0"
+        "\xf1\x5b\x15\x34\x79\xab\x82\x4e\xde\xaa\xa0\x0f\x6f\x55\xd0\xe9"
+        "\xdf\x5d\x90\x48\x22\xfe\x52\x1a\x11\x16\x03\xa8\xfb\x38\x0e\x37"
+        "\xa2\x39\x0e\xb3\xa1\x39\x0e\x2f\xa1\x39\x0e\xab\xa0\x39\x0e\x27"
+        "\xa0\x39\x8e\x81\x8e\xe6\x38\xc6\x31\x9a\xe3\x18\xa6\x08\x4e\xa6"
+        "\x42\xd7\x28\xac\x0d\xf6\x43\xc7\x68\x6f\xe7\xee\x5f\x23\xfc\xb8"
+        "\xfb\x97\x04\x3f\xee\xfe\x15\xc0\x8f\xbb\x7f\xc2\xf7\xe3\xee\x9f"
+        "\xdf\xfd\xb8\xfb\xa7\x73\x3f\xee\xfe\xd9\xdb\x8f\xbb\x7f\xb2\xc6"
+        "\x73\xcb\xad\x56\x70\x63\x6c\x96\x64\xbd\x5d\x36\x57\x2a\x4b\x54"
+        "\xc6\x83\x8c\xbf\xf4\xa7\xb1\xc4\xb0\x6c\x1e\x49\xc3\x2b\x16\x3d"
+        "\x9e\x92\x34\x92\x00\x53\xce\x6c\xd5\x42\xdc\x9b\x16\x32\xfb\x7a"
+        "\xff\x08\x39\xee\xb7\x9e\x67\x45\x82\x17\xa8\x79\x30\x17\x8f\x79"
+        "\xca\x75\xef\x8a\xf3\xe4\x27\x97\x6a\xc9\x03\x16\x45\x86\x47\x08"
+        "\x4c\x79\x96\xa7\x8e\x1e\xf1\x19\xd3\x29\x9f\xf3\x94\x27\x21\xa7"
+        "\x1c\xd8\x74\xd0\x22\x13\x0c\x92\x3c\x9e\x11\x8c\xcd\x25\x7b\x24"
+        "\x63\xf1\x24\x22\xee\xbe\x15\x91\x64\x52\x58\x0f\x68\x93\x3f\x2f"
+        "\x0a\x93\x08\x82\x41\x1d\xb3\x30\x55\x04\x7b\x16\x46\x36\x3f\x7c"
+        "\x15\xba\x7f\x5f\x15\x90\xe0\x22\x97\x92\x13\xb1\xbe\xd1\x0c\x31"
+        "\xcb\xea\x9f\x1b\x58\x4c\xff\xd4\xc0\x62\xfa\x67\x06\x16\xd3\x3f"
+        "\x31\xa8\x69\x46\xd5\x45\x15\x8d\xa8\xa7\x2a\x1a\x51\x87\x55\x34"
+        "\xa2\x7e\x2b\xc7\x27\x55\xbf\x55\x34\xa2\x7e\xab\x68\x44\xfd\x56"
+        "\xd1\xfa\xf7\xdb\xbd\xc8\x24\xdf\xdd\x75\x8c\xba\x1f\xbb\xbb\x94"
+        "\x4a\x53\x4c\x78\x53\xf1\x98\x30\xb3\x01\xe8\xbf\xdc\x54\xc7\x4c"
+        "\x83\x3b\x96\xb2\xc7\x94\x2d\x17\x41\x71\x54\x7a\xef\x4e\x0b\x5d"
+        "\xce\x85\x8a\x5e\x83\x7b\x8a\x35\x6d\x4d\xa2\xda\xd7\xdb\x21\x72"
+        "\x69\x5a\x2d\x92\xbc\x7f\x87\x6e\xd1\xa8\xcc\xb5\xe6\x11\xd9\x6b"
+        "\xcd\x23\x32\xd8\x9a\xd7\xdf\x62\xb7\x66\x9b\x5c\x6c\xd0\xae\x69"
+        "\xf2\x99\x69\x3e\xcb\x1a\x4d\xdb\x3d\x2b\x98\x32\x99\x97\x1b\xda"
+        "\xfe\x6e\x63\x59\xff\x11\xb6\x31\xc0\x95\x48\x35\x99\x0d\x9a\xb1"
+        "\x04\x23\xf8\x5b\xb1\x9d\xbd\x26\xda\xea\x6d\x6a\xd9\xbf\x62\x1b"
+        "\x56\x7f\x5b\xed\xce\x4a\xa4\xd5\xab\x90\x04\xb5\x94\x2a\x7c\xa2"
+        "\x99\x86\xaf\x5f\x97\x3c\x35\x69\xd9\x53\x6f\xd2\x95\x92\x52\x3d"
+        "\xf3\x88\x8e\x38\xcd\x52\x55\x8e\xb5\xba\xe5\xc7\xe3\xce\x96\xff"
+        "\x12\x2f\x17\x4c\x0b\x0d\x10\xdd\x97\xfa\xd5\x35\x03\xc1\x2d\x5b"
+        "\xf6\x6e\xd0\x9d\x64\x22\xa1\xd1\xed\xcb\xbb\x98\x09\x19\xd0\xed"
+        "\x20\xae\xef\x6f\xbf\x06\xf7\x6a\x59\xa4\x99\x45\xc7\xd0\x00\x2f"
+        "\x54\x96\xa9\x98\x8c\x59\x1d\x09\xfc\xd7\x0f\x3e\xfb\x37\x4d\x05"
+        "\xcf\x4d\x12\x9c\xbc\x12\xb5\xf6\x9c\xe8\xf0\x90\x85\x5d\x0a\x82"
+        "\x45\xa6\x24\xa9\x88\x88\x64\xb6\x99\x22\x11\x24\x6b\xa8\xe5\xfd"
+        "\xce\x5f\x67\x8a\xa5\x11\x0d\xed\x2e\xe5\xe5\x65\x3a\x19\x27\x22"
+        "\x4e\x59\xbc\x94\x54\xde\x32\xf3\xe2\xb3\x99\x7f\x08\x76\x43\x96"
+        "\xf7\x17\x4b\x45\x71\x5c\x88\xca\x54\xf7\x24\xb0\xda\x61\x43\x9d"
+        "\xcf\xfe\xc3\xc3\xfe\x53\xdd\x37\x15\x90\x1c\x19\xfa\x23\xcf\xec"
+        "\xf1\x47\xbb\xd5\xed\x7f\xb6\x77\x0b\xd7\x7f\x9b\xb0\x85\xeb\xbf"
+        "\x45\xb0\x6a\x9a\xe5\xa1\x18\xbf\x04\x8d\xdd\xc2\xf5\x6f\xec\x16"
+        "\x8e\xaa\xb1\x97\x92\x69\x2d\x9c\xa7\x50\xbd\x79\x54\xcd\x5d\xf1"
+        "\xa8\xdb\xdb\x3f\xf9\xab\x78\x4a\xaa\x74\x9e\x4b\xba\x0e\x5c\x01"
+        "\xc9\x7a\x70\x05\x24\xeb\x42\x25\xf3\x38\xd1\x94\x2d\xb6\x3c\xc2"
+        "\x06\x5b\x1e\x75\x7b\x09\x87\x8c\xe5\x11\x1c\x92\xb3\xbc\xdf\x52"
+        "\x11\x91\x89\x61\x61\x54\x4a\x58\x18\x95\x0c\x16\x46\xa5\x81\x85"
+        "\x91\x0a\xd0\xff\x0a\x9d\x1a\xac\xff\x65\x3a\x35\x58\xff\x6b\x75"
+        "\x4a\x18\xd1\x16\xa0\x06\xa3\x1a\x67\xa4\xcb\x3f\xd1\x59\x9e\x1a"
+        "\x8c\x6a\x9c\x59\x18\xd5\x38\xb3\x30\xaa\x71\x66\x61\x54\xe3\xec"
+        "\xf0\x73\xc0\xe7\x73\xb3\x09\xa6\x5b\x62\x6a\x48\xaa\x31\x57\x43"
+        "\xd2\x2d\x34\x49\xc6\xe3\xa5\x4a\x59\xfa\x4a\x84\xfc\x22\xf9\x23"
+        "\x23\x38\x40\x5a\xd2\xee\x52\x35\x2f\xee\xdf\x50\x49\x79\x11\x37"
+        "\xc5\x76\x36\x9f\x65\x94\x9b\xed\x12\x47\x25\xf2\x0f\x3e\x23\xab"
+        "\x5a\xc1\xa2\xac\x17\xc1\x11\x51\x26\xa5\x52\x44\xc7\xd6\x36\x0b"
+        "\x8e\x8d\xdc\xbe\x76\x6d\x5f\x98\xbd\x93\xa3\x77\x15\xee\x24\x0b"
+        "\xf9\x42\xc9\x88\xa7\x8e\x36\xb5\xe6\xcb\xd3\xf2\xb6\x8c\xdd\xea"
+        "\x77\x3f\x59\xf2\x55\x3c\x2e\xb2\x60\xba\x58\x1f\xed\xaf\x63\x26"
+        "\x07\x7b\x23\x57\x09\xfb\x56\xd8\xfe\x02\x9b\xfa\x7c\x32\x6e\x09"
+        "\xbb\xe5\x91\xc8\xe3\x55\x45\xe1\xcd\x14\x93\xc3\xee\xc1\x63\x10"
+        "\x7c\xb4\x3f\x78\xb3\x93\xd8\x8a\x3c\xee\x18\x09\xcb\x9c\xec\x8f"
+        "\xdc\xec\x92\xb7\x22\x4f\x3a\x46\xc2\x32\x3f\x74\x8c\x3c\x04\x91"
+        "\x6d\x7e\xf8\xcc\xd2\xa7\xc6\x81\x70\xd2\x36\x7e\xd6\x39\x9e\x63"
+        "\xf0\x9d\xb4\x9e\x98\x5f\x05\x37\x16\xdb\x36\x90\xd6\x91\x4d\x43"
+        "\xf0\xa4\x6d\x14\x6d\x59\x25\x38\x0f\xc3\xe2\x6c\x01\x54\xa7\x9b"
+        "\x67\xdc\xf1\xdd\xcc\xe3\x8e\xc7\xb8\xc8\x4d\xc1\xd8\xc9\x4d\xe9"
+        "\xec\x2b\x37\xa2\xcd\x60\xdf\xf9\x4f\xa1\x1b\x8f\x51\xef\x39\xff"
+        "\xbd\xbe\x7a\x02\xcc\xfb\x47\x9d\x67\xce\x3f\x73\x95\x81\xd3\xd4"
+        "\xe3\xee\x37\x75\xdd\x98\x8d\x53\xa2\x79\xd0\xc8\x39\xec\x7e\xe2"
+        "\x6a\x6b\x96\x71\xf7\x63\xe7\xe9\xc6\x8d\xe8\x3c\xef\xb8\x11\x9d"
+        "\x27\x20\x37\xa2\xd3\x4c\xe4\x0c\x47\x4d\x49\x6e\x4a\xe7\xb9\xc9"
+        "\x8d\xe8\x3c\x49\xb9\x11\xe8\xd9\x0a\xae\x08\xb8\xd9\x0a\xc6\xe3"
+        "\x66\x2b\x18\xef\x33\x5b\x41\x8a\xcf\x6c\xd5\x63\x17\xe0\x46\x74"
+        "\xde\x0e\xb8\x11\x68\xa3\x42\x04\xda\xa8\x3d\x76\x0a\x6e\x04\xca"
+        "\xa8\x20\xdc\xcb\xa8\x90\x82\x36\x2a\x44\xa0\x8d\x0a\x11\x68\xa3"
+        "\xc2\x0d\x18\xce\xa8\x30\x1e\x67\x54\x18\xef\x63\x54\x48\xf1\x31"
+        "\x2a\xa4\xa0\x8d\x0a\x11\x68\xa3\x42\x04\xda\xa8\x10\x81\x36\x2a"
+        "\x44\xa0\x8d\xea\xb9\xb7\x77\x86\x7b\x19\x15\x52\xd0\x46\x85\x08"
+        "\xb4\x51\x21\x02\x6d\xd4\xa3\x9e\x46\x85\xf1\x38\xa3\xc2\x78\x1f"
+        "\xa3\x42\x8a\x8f\x51\x21\x05\x6d\x54\x88\x40\x1b\x15\x22\xd0\x46"
+        "\x85\x08\xb4\x51\x21\x02\x6d\x54\x88\x40\x19\x15\x84\x7b\x19\x15"
+        "\x52\xd0\x46\x85\x08\xb4\x51\x21\x02\x6d\xd4\xe3\x9e\x46\x85\xf1"
+        "\x38\xa3\xc2\x78\x1f\xa3\x42\x8a\x8f\x51\x21\x05\x6d\x54\x88\x40"
+        "\x1b\x15\x22\xd0\x46\x85\x08\xb4\x51\x21\x02\x6d\x54\x88\x40\x19"
+        "\x15\x84\x7b\x19\x15\x52\xd0\x46\x85\x08\xb4\x51\x21\x02\x6d\xd4"
+        "\x49\x4f\xa3\xc2\x78\x9c\x51\x61\xbc\x8f\x51\x21\xc5\xc7\xa8\x90"
+        "\x82\x36\x2a\x44\xa0\x8d\x0a\x11\x68\xa3\x42\x04\xda\xa8\x10\x81"
+        "\x36\x2a\x44\xa0\x8c\x0a\xc2\xbd\x8c\x0a\x29\x68\xa3\x42\x04\xda"
+        "\xa8\x10\xd1\x36\x3e\xab\x53\x94\xae\xcb\xec\x47\xf8\xa3\x9e\xce"
+        "\x2b\xf6\x11\xf7\xf9\x94\x95\xfa\x5e\xbf\x95\x7b\xeb\x18\x6a\x77"
+        "\xd4\xaa\x56\x6e\x56\xf7\x7b\x11\x2e\x94\x7a\x0a\x1a\x6f\x3c\x3c"
+        "\x3c\xec\x0e\x11\x33\x29\x94\x3d\x44\xed\x38\xad\x5e\xe7\x9e\xa0"
+        "\x4f\x7c\xfe\x71\xd9\x7e\x87\x4f\x87\xc7\x78\x74\x6d\x4a\x75\x2f"
+        "\x84\x3d\x67\x0a\xe0\x47\x5d\x23\xc1\x31\x95\xa3\xb6\x21\x5f\x8f"
+        "\x04\x49\xde\x51\xdb\x48\xaf\x47\x82\x5d\xe7\x51\xdb\xec\x5b\x8f"
+        "\x04\xcb\xe0\x51\xdb\xa4\x6b\x7d\xb9\xba\x28\xc5\x2c\x47\x20\xb8"
+        "\x6d\x9a\xa9\x05\x8f\x1c\xe1\x6d\xb3\x75\x2d\x1c\x76\x71\xdb\x1c"
+        "\x5d\x0b\x84\x3d\xdc\x36\x33\xd7\x02\x61\x07\xb7\xcd\xc7\xb5\xc0"
+        "\xe3\xa0\x98\x9c\x77\xa3\x8f\x3b\xf6\xd3\x64\x7d\x7d\x29\x20\xb4"
+        "\x0d\xc7\x1a\xe1\xc4\x4d\x68\x1b\x96\x50\x2b\xe7\xb1\xfd\xce\xa2"
+        "\xb9\x09\x5d\xd5\x73\x13\xba\xca\xe8\x26\xa0\xf4\x74\x62\xf0\xc2"
+        "\xba\x51\x68\x85\xdd\x28\x3f\xa9\xa1\xcd\xb0\x52\xfb\x1b\xd5\x4d"
+        "\xc0\x4a\x0d\x09\x5e\x52\x03\x8c\xbf\xd4\x10\xe5\x2d\x35\x44\xf9"
+        "\x49\x0d\x27\x46\xac\xd4\x90\x80\x95\xda\x7f\x72\x76\x13\xbc\xa4"
+        "\x06\x18\x7f\xa9\x21\xca\x5b\x6a\x88\xf2\x93\x1a\x2e\x65\x58\xa9"
+        "\x21\x01\x2b\x35\x24\x60\xa5\xee\xb9\x20\x3b\x31\xfe\x52\x43\x94"
+        "\xb7\xd4\x10\xe5\x27\x35\xdc\xdc\x61\xa5\x86\x04\xac\xd4\x90\x80"
+        "\x95\x1a\x12\xbc\xa4\x06\x18\x7f\xa9\x21\xca\x5b\x6a\x88\xf2\x93"
+        "\x1a\x64\xc9\x68\xa9\x21\x01\x2b\x35\x24\x60\xa5\x86\x04\x2f\xa9"
+        "\x01\xc6\x5f\x6a\x88\xf2\x96\x1a\xa2\xda\xa4\xb6\x47\x51\xfc\xb3"
+        "\xa5\x5a\x38\x6e\x13\x56\x0b\xc4\x2d\xc8\xb5\x40\xdc\xe4\x5c\x0b"
+        "\xf4\xc8\x96\x6a\xd1\x9e\xd9\x52\x8d\xe0\x99\x2d\x41\xad\xfc\xb2"
+        "\xa5\xba\x68\x7e\xd9\x52\x5d\x3d\xbf\x6c\xa9\x2e\xa3\x5f\xb6\x04"
+        "\xf4\xf4\xcb\x96\x1a\x85\xf5\xcb\x96\x1a\x15\xf6\xcb\x96\xdc\x52"
+        "\xe3\xb2\xa5\x26\xa9\xfd\x8d\xea\x97\x2d\x35\x49\x8d\xcb\x96\x9c"
+        "\x52\xe3\xb2\xa5\x56\xa9\x71\xd9\x52\xab\xd4\xb8\x6c\xc9\x2d\x35"
+        "\x2e\x5b\x6a\x92\x1a\x97\x2d\x35\x49\xed\x3f\x39\xfb\x65\x4b\x4e"
+        "\xa9\x71\xd9\x52\xab\xd4\xb8\x6c\xa9\x55\x6a\x5c\xb6\xe4\x96\x1a"
+        "\x97\x2d\x35\x49\x8d\xcb\x96\x9a\xa4\xc6\x65\x4b\x4d\x52\xf7\x5c"
+        "\x90\xfd\xb2\xa5\x56\xa9\x71\xd9\x52\xab\xd4\xb8\x6c\xc9\x2d\x35"
+        "\x2e\x5b\x6a\x92\x1a\x97\x2d\x35\x49\x8d\xcb\x96\x9a\xa4\xc6\x65"
+        "\x4b\x4e\xa9\x71\xd9\x52\xab\xd4\xb8\x6c\xa9\x55\x6a\x5c\xb6\xe4"
+        "\x96\x1a\x97\x2d\x35\x49\x8d\xcb\x96\x9a\xa4\xc6\x65\x4b\x4d\x52"
+        "\xe3\xb2\x25\xa7\xd4\xb8\x6c\xa9\x55\x6a\x5c\xb6\xd4\x2a\x35\x2e"
+        "\x5b\xba\x35\x21\x82\xe0\x11\x50\xd3\x98\xa5\x59\x40\xf7\xbc\xb8"
+        "\x6b\xa6\x17\x19\xeb\xff\x70\xc2\x87\x24\xe5\x5a\xc9\x9f\x3c\x0a"
+        "\x68\x9b\xfa\x15\xd5\xca\xe1\xf3\xd6\xcf\x5f\x15\x6c\xfb\x03\x7a"
+        "\xe6\xfb\x99\xe9\xb3\xe2\x09\xe8\xb5\xdb\x95\xa2\xf2\x09\xb0\x15"
+        "\xd0\x7e\xf1\x26\x5a\xff\x4c\x55\x11\x5c\xd4\x24\xa8\x7e\x10\xac"
+        "\x7a\xdb\x56\xb8\x3a\x5d\x5b\x96\x68\x03\x61\x51\xe1\xc2\x94\x15"
+        "\x56\xcf\xae\x72\x14\x55\x3d\x83\x76\x7d\x13\x95\x7d\x02\xed\x6e"
+        "\xc1\x8e\x07\xd5\xda\x8a\x6c\x06\xe0\xea\xdb\x55\x97\x6e\xfa\xab"
+        "\xfc\xde\x56\x6f\xb5\xd6\x3b\x2b\x06\x7c\x4b\x9d\xad\x21\x5a\xfb"
+        "\xa8\x7a\x2e\x96\xa3\x82\xa7\xa7\xdd\x6a\x68\xea\x33\x93\xe5\x4f"
+        "\xa6\x99\x7f\x6e\x92\xc8\x00\x9e\xab\x9f\x0b\x2b\x6b\x1a\xbd\xb0"
+        "\xc1\xea\x8b\x97\x5c\xca\x5b\x56\x7e\x5b\x2d\xdd\x5f\x95\x7c\x9e"
+        "\x95\x9f\x8e\x0e\x3e\x34\x7c\x3e\x2b\x9f\xbe\xe7\x8c\x4f\xed\x34"
+        "\xed\x04\x0c\xb7\x2b\x33\x5c\x37\xc2\xdd\xdf\xe5\xf3\xf8\xab\xeb"
+        "\x07\x9c\x43\xd2\xde\x9d\x09\xbb\xbb\xbc\x6b\xb3\x67\x4f\x6f\xea"
+        "\xb6\xfa\x4f\x7f\xfa\x3f",
+        2885,
+        29364,
+        0xf9cf9128
     },
 
     {
@@ -655,7 +1267,30 @@ const docx_template_item_t docx_template_items[] =
                 ""
                 "<w:webSettings xmlns:mc=\"http://schemas.openxmlformats.org/markup-compatibility/2006\" xmlns:r=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships\" xmlns:w=\"http://schemas.openxmlformats.org/wordprocessingml/2006/main\" xmlns:w14=\"http://schemas.microsoft.com/office/word/2010/wordml\" xmlns:w15=\"http://schemas.microsoft.com/office/word/2012/wordml\" xmlns:w16cex=\"http://schemas.microsoft.com/office/word/2018/wordml/cex\" xmlns:w16cid=\"http://schemas.microsoft.com/office/word/2016/wordml/cid\" xmlns:w16=\"http://schemas.microsoft.com/office/word/2018/wordml\" xmlns:w16se=\"http://schemas.microsoft.com/office/word/2015/wordml/symex\" mc:Ignorable=\"w14 w15 w16se w16cid w16 w16cex\">"
                 "<w:optimizeForBrowser/>"
-                "<w:allowPNG/></w:webSettings>"
+                "<w:allowPNG/></w:webSettings>",
+        "\x9d\xd2\xcd\x4e\x02\x31\x10\x00\xe0\xbb\x89\xef\xd0\xf4\x0e"
+        "\x5d\x88\x10\xb2\x61\x21\x31\x06\xe3\xc5\x98\xa8\x0f\x50\xba\xb3"
+        "\xd0\xd8\xe9\x6c\x3a\xc5\x05\x9f\xde\xb2\x80\x62\xb8\xb0\x9e\xfa"
+        "\x3b\x5f\x66\xa6\x9d\xce\xb7\xe8\xc4\x27\x04\xb6\xe4\x0b\x39\xe8"
+        "\x67\x52\x80\x37\x54\x5a\xbf\x2a\xe4\xfb\xdb\xa2\x37\x91\x82\xa3"
+        "\xf6\xa5\x76\xe4\xa1\x90\x3b\x60\x39\x9f\xdd\xde\x4c\x9b\xbc\x81"
+        "\xe5\x2b\xc4\x98\x6e\xb2\x48\x8a\xe7\x1c\x4d\x21\xd7\x31\xd6\xb9"
+        "\x52\x6c\xd6\x80\x9a\xfb\x54\x83\x4f\x87\x15\x05\xd4\x31\x2d\xc3"
+        "\x4a\xa1\x0e\x1f\x9b\xba\x67\x08\x6b\x1d\xed\xd2\x3a\x1b\x77\x6a"
+        "\x98\x65\x63\x79\x64\xc2\x35\x0a\x55\x95\x35\xf0\x40\x66\x83\xe0"
+        "\x63\x1b\xaf\x02\xb8\x24\x92\xe7\xb5\xad\xf9\xa4\x35\xd7\x68\x0d"
+        "\x85\xb2\x0e\x64\x80\x39\xd5\x83\xee\xe0\xa1\xb6\xfe\x87\x19\xdc"
+        "\x5d\x40\x68\x4d\x20\xa6\x2a\xf6\x53\x31\xc7\x8c\x5a\x2a\x85\x0f"
+        "\xb2\x76\x86\xee\x17\x18\x75\x03\x86\x17\xc0\xd8\xc0\xb6\x9b\x31"
+        "\x39\x1a\x2a\x45\x9e\x3b\xb6\xec\xe6\x8c\x7f\x1c\x5b\x9e\x39\xff"
+        "\x4b\xe6\x0c\x60\xe8\x46\x8c\x4e\x79\xf0\x0e\xf7\x15\xa1\xc9\x9f"
+        "\x56\x9e\x82\x5e\xba\x24\xa5\x37\x12\xa9\xcd\xa2\x85\xc5\xa1\xce"
+        "\xfd\x20\x0e\xad\x93\xb3\xf4\x6b\xa9\x8e\x16\xed\x17\x2c\x28\xdc"
+        "\x07\x6a\x18\x82\xda\x6f\x6b\xe7\xa8\x79\x79\x7e\x4c\x0b\xf5\xe7"
+        "\x6b\xcf\xbe\x01",
+        307,
+        803,
+        0xf1ffc140
     },
 
     {
@@ -668,7 +1303,25 @@ const docx_template_item_t docx_template_items[] =
                 "<Relationship Id=\"rId2\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/settings\" Target=\"settings.xml\"/>"
                 "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/styles\" Target=\"styles.xml\"/>"
                 "<Relationship Id=\"rId5\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/theme\" Target=\"theme/theme1.xml\"/>"
-                "<Relationship Id=\"rId4\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/fontTable\" Target=\"fontTable.xml\"/></Relationships>"
+                "<Relationship Id=\"rId4\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/fontTable\" Target=\"fontTable.xml\"/></Relationships>",
+        "\xad\x92\xcb\x4e\xc3\x30\x10\x45\xf7\x48\xfc\x83\x35\x7b\xe2"
+        "\xa4\x3c\x84\xaa\x3a\xdd\xa0\x4a\xdd\x42\xf8\x00\xd7\x99\x3c\x84"
+        "\x63\x5b\x9e\x29\x90\xbf\xc7\x2a\x02\x52\x51\x55\x5d\x64\x39\xd7"
+        "\x9a\x73\xcf\x48\x5e\xad\x3f\x07\x2b\xde\x31\x52\xef\x9d\x82\x22"
+        "\xcb\x41\xa0\x33\xbe\xee\x5d\xab\xe0\xb5\xda\xdc\x3c\x82\x20\xd6"
+        "\xae\xd6\xd6\x3b\x54\x30\x22\xc1\xba\xbc\xbe\x5a\x3d\xa3\xd5\x9c"
+        "\x96\xa8\xeb\x03\x89\x44\x71\xa4\xa0\x63\x0e\x4b\x29\xc9\x74\x38"
+        "\x68\xca\x7c\x40\x97\x5e\x1a\x1f\x07\xcd\x69\x8c\xad\x0c\xda\xbc"
+        "\xe9\x16\xe5\x22\xcf\x1f\x64\x9c\x32\xa0\x3c\x62\x8a\x6d\xad\x20"
+        "\x6e\xeb\x5b\x10\xd5\x18\xf0\x12\xb6\x6f\x9a\xde\xe0\x93\x37\xfb"
+        "\x01\x1d\x9f\xa8\x90\x1f\xb8\x7b\x41\xe6\x74\x1c\x25\xac\x8e\x2d"
+        "\xb2\x82\x49\x98\x25\x22\xc8\xd3\x22\x8b\x39\x45\xe8\x9f\x05\x5d"
+        "\xa0\x50\xcc\xaa\xc0\xa3\xc5\xa9\xc0\x61\x3e\x57\x7f\x3f\x67\x3d"
+        "\xa7\x5d\xfc\x6b\x3f\x8c\xdf\x61\x71\xce\xe1\x6e\x4e\x87\xc6\x3b"
+        "\xae\xf4\xce\x4e\x3c\x7e\xa3\x1f\x09\x79\xf4\xd1\xcb\x2f",
+        237,
+        817,
+        0x51b364d6
     },
 
     {
@@ -902,7 +1555,117 @@ const docx_template_item_t docx_template_items[] =
                 "<a:extraClrSchemeLst/>"
                 "<a:extLst>"
                 "<a:ext uri=\"{05A4C25C-085E-4340-85A3-A5531E510DB2}\">"
-                "<thm15:themeFamily xmlns:thm15=\"http://schemas.microsoft.com/office/thememl/2012/main\" name=\"Office Theme\" id=\"{62F939B6-93AF-4DB8-9C6B-D6C7DFDC589F}\" vid=\"{4A3C46E8-61CC-4603-A589-7422A47A8E4A}\"/></a:ext></a:extLst></a:theme>"
+                "<thm15:themeFamily xmlns:thm15=\"http://schemas.microsoft.com/office/thememl/2012/main\" name=\"Office Theme\" id=\"{62F939B6-93AF-4DB8-9C6B-D6C7DFDC589F}\" vid=\"{4A3C46E8-61CC-4603-A589-7422A47A8E4A}\"/></a:ext></a:extLst></a:theme>",
+        "\xed\x59\x4f\x6f\xdb\x36\x14\xbf\x0f\xd8\x77\x10\x74\x77\x25"
+        "\xdb\x92\xff\x04\x75\x0a\x5b\xb6\x9b\xb6\x49\x1b\x34\x6e\x87\x1e"
+        "\x69\x99\x96\x18\x53\xa2\x41\xd2\x49\x8c\xa2\xc0\xd0\x9e\x76\x19"
+        "\x30\xa0\x1b\x76\x58\x81\xdd\x76\x18\x86\x15\x58\x81\x15\xbb\xec"
+        "\xc3\x04\x68\xb1\x75\x1f\x62\x4f\xf2\x3f\xd1\xa6\xda\xa4\x4d\x87"
+        "\x02\x8b\x03\xd8\x24\xf5\x7b\x8f\x3f\xbe\xf7\xf8\xf8\x22\x5e\xbd"
+        "\x76\x12\x51\xe3\x08\x73\x41\x58\xdc\x30\x8b\x57\x6c\xd3\xc0\xb1"
+        "\xcf\x06\x24\x0e\x1a\xe6\xbd\x5e\xb7\x50\x33\x0d\x21\x51\x3c\x40"
+        "\x94\xc5\xb8\x61\x4e\xb1\x30\xaf\x6d\x7f\xfe\xd9\x55\xb4\x25\x43"
+        "\x1c\x61\x03\xe4\x63\xb1\x85\x1a\x66\x28\xe5\x78\xcb\xb2\x84\x0f"
+        "\xc3\x48\x5c\x61\x63\x1c\xc3\xb3\x21\xe3\x11\x92\xd0\xe5\x81\x35"
+        "\xe0\xe8\x18\xf4\x46\xd4\x2a\xd9\x76\xc5\x8a\x10\x89\x4d\x23\x46"
+        "\x11\xa8\xbd\x33\x1c\x12\x1f\x1b\xbd\x44\xa5\xb9\xbd\x50\xde\xa1"
+        "\xf0\x15\x4b\x91\x0c\xf8\x94\x1f\xf8\xe9\x8c\x59\x89\x14\x3b\x18"
+        "\x15\x93\x1f\x31\x15\x1e\xe5\xc6\x11\xa2\x0d\x13\xe6\x19\xb0\xe3"
+        "\x1e\x3e\x91\xa6\x41\x91\x90\xf0\xa0\x61\xda\xe9\xc7\xb4\xb6\xaf"
+        "\x5a\x4b\x21\x2a\x73\x64\x33\x72\xdd\xf4\x33\x97\x9b\x0b\x0c\x46"
+        "\xa5\x54\x8e\x07\xfd\xa5\xa0\xe3\xb8\x4e\xa5\xb9\xd4\x5f\x9a\xe9"
+        "\xdf\xc4\x75\xaa\x9d\x4a\xa7\xb2\xd4\x97\x02\x90\xef\xc3\x4a\x8b"
+        "\x1a\x9d\xd5\x92\xe7\xcc\xb1\x19\xd0\xac\xa9\xd1\xdd\xae\xb6\xcb"
+        "\x45\x05\x9f\xd1\x5f\xde\xc0\x37\xdd\xe4\x4f\xc1\x97\x57\x78\x67"
+        "\x03\xdf\xed\x7a\x2b\x1b\x66\x40\xb3\xa6\xbb\x81\x77\x5b\xf5\x56"
+        "\x5b\xd5\xef\xae\xf0\x95\x0d\x7c\xd5\x6e\xb6\x9d\xaa\x82\x4f\x41"
+        "\x21\x25\xf1\x68\x03\x6d\xbb\x95\xb2\xb7\x58\xed\x12\x32\x64\x74"
+        "\x47\x0b\xaf\xbb\x4e\xb7\x5a\x9a\xc3\x57\x28\x2b\x13\x5d\x33\xf9"
+        "\x58\xe6\xc5\x5a\x84\x0e\x19\xef\x02\x20\x75\x2e\x92\x24\x36\xe4"
+        "\x74\x8c\x87\xc8\x07\x9c\x87\x28\xe9\x73\x62\xec\x92\x20\x84\xc0"
+        "\x1b\xa3\x98\x09\x18\xb6\x4b\x76\xd7\x2e\xc3\x77\xf2\xe7\xa4\xad"
+        "\xd4\xa3\x68\x0b\xa3\x8c\xf4\x6c\xc8\x17\x1b\x43\x09\x1f\x43\xf8"
+        "\x9c\x8c\x65\xc3\xbc\x09\x5a\xcd\x0c\xe4\xd5\xcb\x97\xa7\x8f\x5f"
+        "\x9c\x3e\xfe\xfd\xf4\xc9\x93\xd3\xc7\xbf\xce\xe7\xde\x94\xdb\x41"
+        "\x71\x90\x95\x7b\xf3\xd3\x37\xff\x3c\xfb\xd2\xf8\xfb\xb7\x1f\xdf"
+        "\x3c\xfd\x56\x8f\x17\x59\xfc\xeb\x5f\xbe\x7a\xfd\xc7\x9f\x6f\x53"
+        "\x2f\x15\x5a\xdf\x3d\x7f\xfd\xe2\xf9\xab\xef\xbf\xfe\xeb\xe7\xa7"
+        "\x1a\x78\x93\xa3\x7e\x16\xde\x23\x11\x16\xc6\x6d\x7c\x6c\xdc\x65"
+        "\x11\x2c\x50\x33\x01\xee\xf3\xf3\x49\xf4\x42\x44\xb2\x12\xcd\x38"
+        "\x10\x28\x46\x89\x8c\x06\xdd\x91\xa1\x82\xbe\x3d\x45\x14\x69\x70"
+        "\x2d\xac\xda\xf1\x3e\x87\x74\xa1\x03\x5e\x9f\x1c\x2a\x84\x0f\x42"
+        "\x3e\x91\x44\x03\xbc\x15\x46\x0a\x70\x8f\x31\xda\x62\x5c\xbb\xa6"
+        "\x5b\xc9\x5c\x59\x2b\x4c\xe2\x40\x3f\x39\x9f\x64\x71\x77\x11\x3a"
+        "\xd2\xcd\xed\xad\x79\xb9\x33\x19\x43\xdc\x13\x9d\x4a\x2f\xc4\x0a"
+        "\xcd\x7d\x0a\x2e\x47\x01\x8e\xb1\x34\x92\x67\x6c\x84\xb1\x46\xec"
+        "\x01\x21\x8a\x5d\xf7\x88\xcf\x99\x60\x43\x69\x3c\x20\x46\x0b\x11"
+        "\xad\x49\x7a\xa4\x2f\xf5\x42\x3b\x24\x02\xbf\x4c\x75\x04\xc1\xdf"
+        "\x8a\x6d\xf6\xee\x1b\x2d\x46\x75\xea\xdb\xf8\x48\x45\xc2\xde\x40"
+        "\x54\xa7\x12\x53\xc5\x8c\xd7\xd1\x44\xa2\x48\xcb\x18\x45\x34\x8b"
+        "\xdc\x45\x32\xd4\x91\x3c\x98\x72\x5f\x31\xb8\x90\xe0\xe9\x00\x53"
+        "\x66\x74\x06\x58\x08\x9d\xcc\x1d\x3e\x55\xe8\xde\x82\x34\xa3\x77"
+        "\xfb\x1e\x9d\x46\x2a\x92\x4b\x32\xd2\x21\x77\x11\x63\x59\x64\x9b"
+        "\x8d\xbc\x10\x45\x63\x2d\x67\x12\x87\x59\xec\x0d\x31\x82\x10\x45"
+        "\xc6\x3e\x93\x5a\x12\x4c\xdd\x21\x49\x1f\xfc\x80\xe2\x5c\x77\xdf"
+        "\x27\x58\x9e\x6f\x6f\xdf\x83\x34\xa4\x0f\x90\xe4\xc9\x84\xeb\xb6"
+        "\x04\x66\xea\x7e\x9c\xd2\x21\xc2\x3a\xe5\x4d\x1e\x29\x29\xb6\xc9"
+        "\x89\x36\x3a\x5a\x93\x40\x09\xed\x5d\x8c\x29\x3a\x46\x03\x8c\x8d"
+        "\x7b\x37\x74\x78\x36\x66\x7a\xd2\x37\x43\xc8\x2a\x3b\x58\x67\x9b"
+        "\x9b\x48\x8d\xd5\xa4\x1f\x63\x01\xb5\x52\x52\xdc\x68\x1c\x4b\x84"
+        "\x12\xb2\x07\x38\x60\x39\x7c\xf6\xa6\x6b\x89\x67\x8a\xe2\x08\xf1"
+        "\x3c\xcd\xb7\x47\x6a\xc8\x74\xe0\xa8\x8b\xb4\xf1\x4a\xfd\x91\x92"
+        "\x4a\x09\x4f\x36\xad\x9e\xc4\x1d\x11\xa1\x33\x69\xdd\x0f\x91\x12"
+        "\x56\x49\x5f\xe8\xe3\x75\xca\xe3\xf3\xee\x31\x90\x39\x7c\x0f\x19"
+        "\x7c\x6e\x19\x48\xec\x67\xb6\x4d\x0f\x51\xac\x0f\x98\x1e\x82\x2a"
+        "\x43\x97\x6e\x41\x64\xa2\x17\x49\xb6\x53\x2a\x36\xd1\xca\x0d\xd5"
+        "\x4d\xbb\x72\x83\xb5\x56\xf4\x44\x24\x7e\x67\x05\xb4\x56\xfb\xb8"
+        "\x1f\xaf\xf6\x81\x0a\xe3\xd5\x0f\xcf\x3e\x5a\xbd\x73\xf1\x95\x4e"
+        "\x5e\x32\x59\xaf\x6f\xf2\x70\xeb\x55\x8d\xc7\xf8\x80\x7c\xfa\x45"
+        "\x4d\x1b\x4d\xe2\x7d\x0c\xe7\xc8\x65\x4d\x73\x59\xd3\xfc\x1f\x6b"
+        "\x9a\xbc\xfd\x7c\x59\xc9\x5c\x56\x32\x97\x95\xcc\x7f\x56\xc9\xac"
+        "\x8a\x17\x2b\xfb\xa2\x27\xd5\x12\xe5\xbe\xf5\x19\x12\x4a\x0f\xe4"
+        "\x94\xe2\x5d\x91\x96\x3d\x02\xf6\xfe\xa0\x0b\x83\x69\x27\x15\x5a"
+        "\xbe\x64\x1a\x87\xd0\x9c\x4f\xa7\xe0\x02\x8e\xd2\xb6\xc1\x99\xfc"
+        "\x82\xc8\xf0\x20\x44\x63\x98\xa6\x98\xce\x10\x88\xb9\xea\x40\x18"
+        "\x63\x26\xa0\x70\x32\x73\x75\xa7\x85\xd7\x24\xda\x63\x83\xd9\x68"
+        "\xb1\xb8\x78\xaf\x09\x02\x48\xae\xc6\xa1\xf0\x5a\x8c\x43\x99\x26"
+        "\x67\xa3\x95\xea\xea\x05\xde\x52\x7d\xda\x0b\x44\x96\x80\x9b\x2a"
+        "\x3d\x3b\x89\xcc\x64\x2a\x89\xb2\x86\x44\xb5\x7c\x36\x12\x45\xfb"
+        "\xa2\x58\xd4\x35\x2c\x6a\xc5\xb7\xb1\xb0\x32\x5e\x81\xc3\xc9\x40"
+        "\xc9\x2b\x71\xd7\x99\x31\x82\x70\x83\x90\x1e\x24\x7e\x9a\xc9\x2f"
+        "\xbc\x7b\xe1\x9e\xce\x33\xa6\xba\xec\x92\x66\x79\x75\xe7\xc2\x3c"
+        "\xad\x90\xc8\x84\x9b\x4a\x22\x13\x86\x21\x1c\x1e\xeb\xc3\x17\xec"
+        "\xeb\x7a\x5d\xef\xea\x92\x96\x46\xb5\xf6\x31\x7c\x6d\x6d\xe6\x06"
+        "\x1a\xab\x3d\xe3\x18\xf6\x5c\xd9\x05\x35\x3e\x1a\x37\xcc\x21\xfc"
+        "\xcb\x04\xcd\x68\x0c\xfa\x44\x92\xa9\x10\x0d\xe2\x86\xe9\xcb\xb9"
+        "\xa1\xdf\x27\xb3\x8c\xb9\x90\x6d\x24\xc2\x19\x2c\x7d\x34\x5b\x7f"
+        "\x44\x24\xe6\x06\x25\x11\xc4\x7a\xd6\x0d\x34\x5e\x71\x2b\x96\xaa"
+        "\xf6\xa7\x4b\xae\x6e\x7f\x7a\x96\xb3\xd6\x9d\x8c\x87\x43\xec\xcb"
+        "\x9c\x91\x55\x17\x9e\xcd\x94\x68\x9f\x7e\x20\x38\xe9\xb0\x09\x90"
+        "\x3e\x08\x07\xc7\x46\x9f\x4e\xf8\x5d\x04\x86\x72\xab\xc5\xc4\x80"
+        "\x03\x22\xe4\xd2\x9a\x03\xc2\x33\xc1\xbd\xb2\xe2\x5a\xba\x9a\x6f"
+        "\x45\xe5\xbe\x65\xb5\x45\x11\x1d\x87\x68\x7e\xa2\x64\x93\xf9\x0c"
+        "\x9e\xb6\x97\x74\x32\xeb\x48\x99\xae\xaf\xca\xd2\x99\xb0\x1f\x74"
+        "\x2f\xe2\xd4\x7d\xb7\xd0\x5a\xd2\xcc\x39\x40\xaa\xb9\x59\xec\xe3"
+        "\x1d\xf2\x19\x56\x65\x3d\x2b\x57\x9b\xeb\xea\x35\xfb\xed\xa7\xc4"
+        "\x87\x1f\x08\x19\x6a\x35\x3d\xb5\xb2\x9e\x5a\xde\xd9\x71\x81\x05"
+        "\x41\x66\xba\x4a\x8e\xdd\x4a\xb9\xde\xfc\xc0\xd3\x60\x3d\x6a\xad"
+        "\x4c\x5d\x99\xf6\x36\x2e\xb6\x59\xff\x10\x22\xbf\x0d\xd5\xea\x84"
+        "\x4a\x31\x7b\x35\x76\x02\xe5\xb7\xb7\xb8\x92\x9c\x65\x82\x74\x74"
+        "\x91\x5d\x4e\xa4\x31\xe1\xa4\x61\x3e\xb4\xdd\xa6\xe3\x95\x5c\xaf"
+        "\x60\xd7\xdc\x4e\xc1\x29\x3b\x76\xa1\xe6\x36\xcb\x85\xa6\xeb\x96"
+        "\x8b\x1d\xb7\x68\xb7\x5b\xa5\x47\x60\x14\x19\x46\x45\x77\x36\x77"
+        "\x17\xfe\xd9\xa7\xd3\xf9\xbd\x7d\x3a\xbe\x71\x77\x1f\x2d\x4a\xed"
+        "\x2b\x3e\x8b\x2c\x96\xd6\xc1\x56\x2a\x9c\xde\xdd\x17\x4b\xf9\x77"
+        "\xf7\x06\x01\xcb\x3c\xac\x94\xba\xf5\x72\xbd\x55\x29\xd4\xcb\xcd"
+        "\x6e\xc1\x69\xb7\x6a\x85\xba\x57\x69\x15\xda\x15\xaf\xda\xee\xb6"
+        "\x3d\xb7\x56\xef\x3e\x32\x8d\xa3\x14\xec\x34\xcb\x9e\x53\xe9\xd4"
+        "\x0a\x95\xa2\xe7\x15\x9c\x8a\x9d\xd0\xaf\xd5\x0b\x55\xa7\x54\x6a"
+        "\x3a\xd5\x66\xad\xe3\x34\x1f\xcd\x6d\x0d\x2b\x5f\xfc\x2e\xcc\x9b"
+        "\xf2\xda\xfe\x17",
+        1699,
+        8393,
+        0x9867f4b6
     },
 
 };
@@ -8,6 +8,13 @@ typedef struct
 {
     const char* name; /* Name of item in docx archive. */
     const char* text; /* Contents of item in docx archive. */
+
+    /* If not NULL, raw deflate compressed version of <text>, for copying
+    directly into zip files if <text> is not modified. */
+    const char*   compressed;
+    int           compressed_length;
+    int           text_length;   /* strlen(text). */
+    unsigned long crc;           /* CRC-32 of text. */
 } docx_template_item_t;
 
 extern const docx_template_item_t docx_template_items[];
@@ -29,6 +29,7 @@ import os
 import re
 import sys
 import textwrap
+import zlib
 
 
 def system(command):
@@ -100,6 +101,27 @@ assert not path_safe('foo;rm -rf *')
 assert not path_safe('..')
 assert path_safe('foo/bar.x')
 
+def write_c_bytes(out, data):
+    '''
+    Writes <data> as a C string literal using hex escapes.
+    '''
+    out.write(f'        "')
+    i = 0
+    for byte in data:
+        i += 1
+        if i % 16 == 0:
+            out.write(f'"\n        "')
+        out.write(f'\\x{byte:02x}')
+    out.write(f'"')
+
+def deflate_raw(data):
+    '''
+    Returns raw deflate compressed data, as used within zip files and as
+    written by extract's zip.c.
+    '''
+    c = zlib.compressobj(zlib.Z_DEFAULT_COMPRESSION, zlib.DEFLATED, -15)
+    return c.compress(data) + c.flush()
+
 
 def main():
 
@@ -156,6 +178,8 @@ def main():
     out_c.write(f'\n')
     out_c.write(f'#include "{os.path.basename(path_out)}.h"\n')
     out_c.write(f'\n')
+    out_c.write(f'#include <stddef.h>\n')
+    out_c.write(f'\n')
 
 
     out_c.write(f'const {infix}_template_item_t {infix}_template_items[] =\n')
@@ -184,6 +208,14 @@ def main():
             out_c.write(f'        "{name}",\n')
             if filename.endswith('.xml') or filename.endswith('.rels'):
                 text = read(os.path.join(dirpath, filename), 'utf-8')
+
+                # Bytes of the C string that we generate below, used to
+                # create precompressed data.
+                #
+                raw = text
+                for tag in 'dc:creator', 'cp:lastModifiedBy':
+                    raw = re.sub(f'[<]{tag}[>][^<]*[<]/{tag}[>]', f'<{tag}></{tag}>', raw)
+                raw = raw.encode('utf-8')
                 #print(f'first line is: %r' % text.split("\n")[0])
                 text = text.replace('"', '\\"')
 
@@ -213,17 +245,22 @@ def main():
                     else:
                         for cc in c.encode( 'utf-8'):
                             out_c.write( f'\\x{cc:02x}')
-                out_c.write(f'"\n')
+                out_c.write(f'",\n')
+
+                # Precompressed data so that unmodified items can be copied
+                # directly into zip files.
+                #
+                compressed = deflate_raw(raw)
+                write_c_bytes(out_c, compressed)
+                out_c.write(f',\n')
+                out_c.write(f'        {len(compressed)},\n')
+                out_c.write(f'        {len(raw)},\n')
+                out_c.write(f'        0x{zlib.crc32(raw):08x}\n')
             else:
                 data = read(os.path.join(dirpath, filename), encoding=None)
-                out_c.write(f'        "')
-                i = 0
-                for byte in data:
-                    i += 1
-                    if i % 16 == 0:
-                        out_c.write(f'"\n        "')
-                    out_c.write(f'\\x{byte:02x}')
-                out_c.write(f'"\n')
+                write_c_bytes(out_c, data)
+                out_c.write(f',\n')
+                out_c.write(f'        NULL, 0, 0, 0\n')
 
             out_c.write(f'    }},\n')
             out_c.write(f'\n')
@@ -246,6 +283,13 @@ def main():
     out_h.write(f'{{\n')
     out_h.write(f'    const char* name; /* Name of item in {infix} archive. */\n')
     out_h.write(f'    const char* text; /* Contents of item in {infix} archive. */\n')
+    out_h.write(f'\n')
+    out_h.write(f'    /* If not NULL, raw deflate compressed version of <text>, for copying\n')
+    out_h.write(f'    directly into zip files if <text> is not modified. */\n')
+    out_h.write(f'    const char*   compressed;\n')
+    out_h.write(f'    int           compressed_length;\n')
+    out_h.write(f'    int           text_length;   /* strlen(text). */\n')
+    out_h.write(f'    unsigned long crc;           /* CRC-32 of text. */\n')
     out_h.write(f'}} {infix}_template_item_t;\n')
     out_h.write(f'\n')
     out_h.write(f'extern const {infix}_template_item_t {infix}_template_items[];\n')
@@ -4,8 +4,9 @@
 #define _CRT_SECURE_NO_WARNINGS
 #endif
 
-#include "../include/extract.h"
-#include "../include/extract_alloc.h"
+#include "extract/extract.h"
+#include "extract/alloc.h"
+#include "extract/buffer.h"
 
 #include "memento.h"
 #include "outf.h"
@@ -31,6 +32,24 @@ static int arg_next_string(char** argv, int argc, int* i, const char** out)
     return 0;
 }
 
+/* Sets *o_format from a format name such as "docx".
+*/
+static int format_parse(const char* name, int* o_format)
+{
+    if (!strcmp(name, "odt")) *o_format = extract_format_ODT;
+    else if (!strcmp(name, "docx")) *o_format = extract_format_DOCX;
+    else if (!strcmp(name, "html")) *o_format = extract_format_HTML;
+    else if (!strcmp(name, "text")) *o_format = extract_format_TEXT;
+    else if (!strcmp(name, "json")) *o_format = extract_format_JSON;
+    else
+    {
+        printf("format should be 'odt', 'docx', 'html', 'text' or 'json', not '%s'.\n", name);
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
 /* Error-detecting equivalent to *out = atoi(argv[++i]).
 */
 static int arg_next_int(char** argv, int argc, int* i, int* out)
@@ -45,6 +64,80 @@ static int arg_next_int(char** argv, int argc, int* i, int* out)
     return 0;
 }
 
+/* Error-detecting equivalent to *out = strtoul(argv[++i], NULL, 10), for
+sizes that may not fit in an int.
+*/
+static int arg_next_size(char** argv, int argc, int* i, size_t* out)
+{
+    const char*     s;
+    char*           end;
+    unsigned long   value;
+    if (*i + 1 >= argc) {
+        printf("Expected size arg after: %s\n", argv[*i]);
+        errno = EINVAL;
+        return -1;
+    }
+    *i += 1;
+    s = argv[*i];
+    errno = 0;
+    value = strtoul(s, &end, 10);
+    if (end == s || *end || s[0] == '-' || errno || (size_t) value != value) {
+        printf("Expected size, not: %s\n", s);
+        errno = EINVAL;
+        return -1;
+    }
+    *out = (size_t) value;
+    return 0;
+}
+
+static void s_print_stats(const extract_stats_t* stats)
+{
+    int i;
+    printf("Stats:\n");
+    for (i=0; i<extract_stage_NUM; ++i) {
+        printf("    %-20s wall=%.6fs cpu=%.6fs calls=%i\n",
+                extract_stage_name((extract_stage_t) i),
+                stats->times[i].wall,
+                stats->times[i].cpu,
+                stats->times[i].calls
+                );
+    }
+    printf("    chars=%li spans=%li spans_split=%li spans_autosplit=%li\n",
+            stats->chars,
+            stats->spans,
+            stats->spans_split,
+            stats->spans_autosplit
+            );
+    printf("    lines=%li paragraphs=%li tables=%li images=%li bytes_written=%lu\n",
+            stats->lines,
+            stats->paragraphs,
+            stats->tables,
+            stats->images,
+            (unsigned long) stats->bytes_written
+            );
+}
+
+/* extract_page_content_fn for --o-pages; <handle> is the path prefix. */
+static int s_page_content(void* handle, int page_index, const char* data, size_t data_length)
+{
+    char    path[1024];
+    FILE*   f;
+    size_t  n;
+    if ((size_t) snprintf(path, sizeof(path), "%s.%i", (const char*) handle, page_index) >= sizeof(path)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    f = fopen(path, "wb");
+    if (!f) return -1;
+    n = fwrite(data, 1, data_length, f);
+    if (fclose(f)) return -1;
+    if (n != data_length) {
+        errno = EIO;
+        return -1;
+    }
+    return 0;
+}
+
 static void* s_realloc(void* state, void* prev, size_t size)
 {
     assert(state == (void*) 123);
@@ -58,18 +151,35 @@ int main(int argc, char** argv)
     const char* input_path          = NULL;
     const char* docx_template_path  = NULL;
     const char* content_path        = NULL;
+    const char* record_path         = NULL;
+    const char* pages_path          = NULL;
+    const char* trace_path          = NULL;
     int         preserve_dir        = 0;
     int         spacing             = 1;
     int         rotation            = 1;
     int         autosplit           = 0;
     int         images              = 1;
     int         alloc_stats         = 0;
+    int         stats               = 0;
     int         format              = -1;
+    int         stream              = 0;
+    int         threads             = 1;
+    int         bounded_pages       = 0;
+    size_t      bounded_chars       = 0;
+    const char* spill_dir           = NULL;
+    size_t      spill_threshold     = 0;
+    extract_format_t also_formats[4];
+    const char* also_paths[4];
+    int         also_num            = 0;
     int         i;
 
     extract_alloc_t*    alloc = NULL;
     extract_buffer_t*   out_buffer = NULL;
+    extract_buffer_t*   stream_buffer = NULL;
     extract_buffer_t*   intermediate = NULL;
+    extract_buffer_t*   record_buffer = NULL;
+    extract_buffer_t*   trace_buffer = NULL;
+    extract_trace_chrome_t* trace_chrome = NULL;
     extract_t*          extract = NULL;
 
     /* Create an allocator so we test the allocation code. */
@@ -93,36 +203,66 @@ int main(int argc, char** argv)
                     "Args:\n"
                     "    --alloc-exp-min <bytes>\n"
                     "        Internal: set exponential allocation with minimum alloc size.\n"
+                    "    --also odt | docx | html | text | json <path>\n"
+                    "        Also generate output in the specified format and write it to\n"
+                    "        <path>, from the same processing pass. Can be repeated.\n"
                     "    --autosplit 0|1\n"
                     "        If 1, we initially split spans when y coordinate changes. This\n"
                     "        stresses our handling of spans when input is from mupdf.\n"
-                    "    -f odt | docx\n"
+                    "    --bounded <pages> <chars>\n"
+                    "        Process and free pages while reading the intermediate file,\n"
+                    "        whenever <pages> pages or <chars> chars are pending; 0 means\n"
+                    "        no limit. Output is unchanged but memory use is bounded.\n"
+                    "    -f odt | docx | html | text | json\n"
                     "        Sets output format. Required.\n"
                     "    -i <intermediate-path>\n"
-                    "        Path of XML file containing intermediate text spans.\n"
+                    "        Path of XML or binary file containing intermediate text spans.\n"
                     "    -o <docx-path>\n"
                     "        If specified, we generate the specified docx file.\n"
                     "    --o-content <path>\n"
                     "        If specified, we write raw docx content to <path>; this is the\n"
                     "        text that we embed inside the template word/document.xml file\n"
                     "        when generating the docx file.\n"
+                    "    --o-intermediate <path>\n"
+                    "        If specified, we write the input to <path> in binary\n"
+                    "        intermediate format, which can be read back with -i.\n"
+                    "    --o-pages <path>\n"
+                    "        If specified, we use extract_set_page_content_fn() to write\n"
+                    "        each page's content to <path>.<page-index>.\n"
                     "    -p 0|1\n"
-                    "        If 1 and -t <docx-template> is specified, we preserve the\n"
-                    "        uncompressed <docx-path>.lib/ directory.\n"
+                    "        Ignored; kept for compatibility.\n"
                     "    -r 0|1\n"
                     "       If 1, we we output rotated text inside a rotated drawing. Otherwise\n"
                     "       output text is always horizontal.\n"
+                    "    --spill <dir> <bytes>\n"
+                    "        Move pending content and image data to a temporary file in <dir>\n"
+                    "        once more than <bytes> are pending.\n"
+                    "    --stats 0|1\n"
+                    "        If 1, show time taken by each stage of processing, and counts\n"
+                    "        of chars, spans etc.\n"
+                    "    --stream 0|1\n"
+                    "        If 1, html/text/json output is written to <docx-path> by\n"
+                    "        extract_process() instead of being accumulated in memory.\n"
                     "    -s 0|1\n"
                     "        If 1, we insert extra vertical space between paragraphs and extra\n"
                     "        vertical space between paragraphs that had different ctm matrices\n"
                     "        in the original document.\n"
+                    "    --threads <n>\n"
+                    "        Use up to <n> threads to parse the intermediate file. Pages\n"
+                    "        are still built on a single thread. Has no effect unless built\n"
+                    "        with EXTRACT_THREADS defined.\n"
+                    "    --trace <path>\n"
+                    "        Write Chrome trace-event JSON to <path>, showing time taken by\n"
+                    "        each page and stage of processing.\n"
                     "    -t <docx-template>\n"
                     "        If specified we use <docx-template> as template. Otheerwise we use\n"
                     "        an internal template.\n"
                     "    -v <verbose>\n"
                     "        Set verbose level.\n"
-                    "    -v-alloc\n"
-                    "        Show alloc stats.\n"
+                    "    --v-alloc 0|1|2\n"
+                    "        If 1, show alloc stats. If 2, also account for bytes allocated\n"
+                    "        and show current, peak and total bytes for each category of\n"
+                    "        allocation. Should be before any other args.\n"
                     );
             if (i + 1 == argc) {
                 e = 0;
@@ -138,18 +278,28 @@ int main(int argc, char** argv)
         else if (!strcmp(arg, "--autosplit")) {
             if (arg_next_int(argv, argc, &i, &autosplit)) goto end;
         }
+        else if (!strcmp(arg, "--bounded")) {
+            if (arg_next_int(argv, argc, &i, &bounded_pages)) goto end;
+            if (arg_next_size(argv, argc, &i, &bounded_chars)) goto end;
+        }
         else if (!strcmp(arg, "-f")) {
             const char* format_name;
             if (arg_next_string(argv, argc, &i, &format_name)) goto end;
-            if (!strcmp(format_name, "odt")) format = extract_format_ODT;
-            else if (!strcmp(format_name, "docx")) format = extract_format_DOCX;
-            else if (!strcmp(format_name, "html")) format = extract_format_HTML;
-            else
-            {
-                printf("-f value should be 'odt' or 'docx', not '%s'.\n", format_name);
+            if (format_parse(format_name, &format)) goto end;
+        }
+        else if (!strcmp(arg, "--also")) {
+            const char* format_name;
+            int         also_format;
+            if (also_num == sizeof(also_formats) / sizeof(also_formats[0])) {
+                printf("Too many --also args.\n");
                 errno = EINVAL;
                 goto end;
             }
+            if (arg_next_string(argv, argc, &i, &format_name)) goto end;
+            if (format_parse(format_name, &also_format)) goto end;
+            if (arg_next_string(argv, argc, &i, &also_paths[also_num])) goto end;
+            also_formats[also_num] = (extract_format_t) also_format;
+            also_num += 1;
         }
         else if (!strcmp(arg, "-i")) {
             if (arg_next_string(argv, argc, &i, &input_path)) goto end;
@@ -160,6 +310,12 @@ int main(int argc, char** argv)
         else if (!strcmp(arg, "--o-content")) {
             if (arg_next_string(argv, argc, &i, &content_path)) goto end;
         }
+        else if (!strcmp(arg, "--o-intermediate")) {
+            if (arg_next_string(argv, argc, &i, &record_path)) goto end;
+        }
+        else if (!strcmp(arg, "--o-pages")) {
+            if (arg_next_string(argv, argc, &i, &pages_path)) goto end;
+        }
         else if (!strcmp(arg, "-p")) {
             if (arg_next_int(argv, argc, &i, &preserve_dir)) goto end;
         }
@@ -169,6 +325,22 @@ int main(int argc, char** argv)
         else if (!strcmp(arg, "-s")) {
             if (arg_next_int(argv, argc, &i, &spacing)) goto end;
         }
+        else if (!strcmp(arg, "--spill")) {
+            if (arg_next_string(argv, argc, &i, &spill_dir)) goto end;
+            if (arg_next_size(argv, argc, &i, &spill_threshold)) goto end;
+        }
+        else if (!strcmp(arg, "--stats")) {
+            if (arg_next_int(argv, argc, &i, &stats)) goto end;
+        }
+        else if (!strcmp(arg, "--stream")) {
+            if (arg_next_int(argv, argc, &i, &stream)) goto end;
+        }
+        else if (!strcmp(arg, "--threads")) {
+            if (arg_next_int(argv, argc, &i, &threads)) goto end;
+        }
+        else if (!strcmp(arg, "--trace")) {
+            if (arg_next_string(argv, argc, &i, &trace_path)) goto end;
+        }
         else if (!strcmp(arg, "-t")) {
             if (arg_next_string(argv, argc, &i, &docx_template_path)) goto end;
         }
@@ -180,6 +352,7 @@ int main(int argc, char** argv)
         }
         else if (!strcmp(arg, "--v-alloc")) {
             if (arg_next_int(argv, argc, &i, &alloc_stats)) goto end;
+            if (alloc_stats >= 2 && extract_alloc_accounting(alloc)) goto end;
         }
         else {
             printf("Unrecognised arg: '%s'\n", arg);
@@ -192,7 +365,7 @@ int main(int argc, char** argv)
 
     if (format == -1)
     {
-        printf("'-f odt | docx' must be specified\n");
+        printf("'-f odt | docx | html | text | json' must be specified\n");
         errno = EINVAL;
         goto end;
     }
@@ -203,15 +376,56 @@ int main(int argc, char** argv)
         goto end;
     }
 
-    if (extract_buffer_open_file(alloc, input_path, 0 /*writable*/, &intermediate)) {
+    if (extract_buffer_open_mmap(alloc, input_path, &intermediate)) {
         printf("Failed to open intermediate file: %s\n", input_path);
         goto end;
     }
 
     if (extract_begin(alloc, format, &extract)) goto end;
-    if (extract_read_intermediate(extract, intermediate)) goto end;
+    if (extract_set_formats(extract, also_formats, also_num)) goto end;
+    if (stream && docx_out_path && !docx_template_path) {
+        if (extract_buffer_open_file(alloc, docx_out_path, 1 /*writable*/, &stream_buffer)) goto end;
+        if (extract_set_stream(extract, stream_buffer)) goto end;
+    }
+    if (pages_path) {
+        if (extract_set_page_content_fn(extract, s_page_content, (void*) pages_path, 1 /*keep*/)) goto end;
+    }
+    if (spill_dir) {
+        if (extract_set_spill(extract, spill_dir, spill_threshold)) goto end;
+    }
+    if (extract_set_threads(extract, threads)) goto end;
+    if (extract_set_stats(extract, stats)) goto end;
+    if (trace_path) {
+        if (extract_buffer_open_file(alloc, trace_path, 1 /*writable*/, &trace_buffer)) goto end;
+        if (extract_trace_chrome_open(trace_buffer, &trace_chrome)) goto end;
+        if (extract_set_trace(extract, extract_trace_chrome, trace_chrome)) goto end;
+    }
+    if (record_path) {
+        if (extract_buffer_open_file(alloc, record_path, 1 /*writable*/, &record_buffer)) goto end;
+        if (extract_set_record(extract, record_buffer)) goto end;
+    }
+    if (bounded_pages || bounded_chars) {
+        if (extract_read_intermediate_process(
+                extract,
+                intermediate,
+                spacing,
+                rotation,
+                images,
+                bounded_pages,
+                bounded_chars
+                )) goto end;
+    }
+    else {
+        if (extract_read_intermediate(extract, intermediate)) goto end;
+    }
+    if (record_buffer) {
+        if (extract_set_record(extract, NULL)) goto end;
+        if (extract_buffer_close(&record_buffer)) goto end;
+    }
 
-    if (extract_process(extract, spacing, rotation, images)) goto end;
+    if (!bounded_pages && !bounded_chars) {
+        if (extract_process(extract, spacing, rotation, images)) goto end;
+    }
 
     if (content_path) {
         if (extract_buffer_open_file(alloc, content_path, 1 /*writable*/, &out_buffer)) goto end;
@@ -230,6 +444,13 @@ int main(int argc, char** argv)
                 goto end;
             }
         }
+        else if (stream_buffer) {
+            if (extract_write(extract, stream_buffer)) {
+                printf("Failed to create docx file: %s\n", docx_out_path);
+                goto end;
+            }
+            if (extract_buffer_close(&stream_buffer)) goto end;
+        }
         else {
             if (extract_buffer_open_file(alloc, docx_out_path, 1 /*writable*/, &out_buffer)) goto end;
             if (extract_write(extract, out_buffer)) {
@@ -239,13 +460,33 @@ int main(int argc, char** argv)
             if (extract_buffer_close(&out_buffer)) goto end;
         }
     }
+    for (i=0; i<also_num; ++i) {
+        if (extract_buffer_open_file(alloc, also_paths[i], 1 /*writable*/, &out_buffer)) goto end;
+        if (extract_write_format(extract, also_formats[i], out_buffer)) {
+            printf("Failed to create file: %s\n", also_paths[i]);
+            goto end;
+        }
+        if (extract_buffer_close(&out_buffer)) goto end;
+    }
+    if (stats) {
+        s_print_stats(extract_stats(extract));
+    }
+    if (trace_chrome) {
+        if (extract_set_trace(extract, NULL, NULL)) goto end;
+        if (extract_trace_chrome_close(&trace_chrome)) goto end;
+        if (extract_buffer_close(&trace_buffer)) goto end;
+    }
 
     e = 0;
     end:
 
     extract_buffer_close(&intermediate);
     extract_buffer_close(&out_buffer);
+    extract_buffer_close(&stream_buffer);
     extract_end(&extract);
+    extract_buffer_close(&record_buffer);
+    extract_trace_chrome_close(&trace_chrome);
+    extract_buffer_close(&trace_buffer);
 
     if (e) {
         printf("Failed (errno=%i): %s\n", errno, strerror(errno));
@@ -256,12 +497,26 @@ int main(int argc, char** argv)
 
     if (alloc_stats) {
         extract_alloc_stats_t* stats = extract_alloc_stats(alloc);
-        printf("Alloc stats: num_malloc=%i num_realloc=%i num_free=%i num_libc_realloc=%i\n",
-                stats->num_malloc,
-                stats->num_realloc,
-                stats->num_free,
-                stats->num_libc_realloc
+        printf("Alloc stats: num_malloc=%lu num_realloc=%lu num_free=%lu num_libc_realloc=%lu\n",
+                (unsigned long) stats->num_malloc,
+                (unsigned long) stats->num_realloc,
+                (unsigned long) stats->num_free,
+                (unsigned long) stats->num_libc_realloc
                 );
+        if (alloc_stats >= 2) {
+            int c;
+            for (c=0; c<=extract_alloc_category_NUM; ++c) {
+                const char *name = (c == extract_alloc_category_NUM)
+                        ? "all"
+                        : extract_alloc_category_name((extract_alloc_category_t) c);
+                printf("    %-10s current=%lu peak=%lu total=%lu\n",
+                        name,
+                        (unsigned long) stats->bytes[c].bytes_current,
+                        (unsigned long) stats->bytes[c].bytes_peak,
+                        (unsigned long) stats->bytes[c].bytes_total
+                        );
+            }
+        }
     }
 
     extract_alloc_destroy(&alloc);
@@ -6,11 +6,14 @@
 #include "docx.h"
 #include "docx_template.h"
 #include "html.h"
+#include "intermediate.h"
 #include "json.h"
 #include "mem.h"
 #include "odt.h"
 #include "odt_template.h"
 #include "outf.h"
+#include "spill.h"
+#include "stats.h"
 #include "xml.h"
 #include "zip.h"
 
@@ -23,6 +26,15 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Threads are only used if EXTRACT_THREADS is defined, so that builds do not
+depend on pthreads by default. If extract_PTHREADS is not defined,
+extract_set_threads() has no effect. */
+#undef extract_PTHREADS
+#if defined(EXTRACT_THREADS) && !defined(_WIN32)
+	#include <pthread.h>
+	#define extract_PTHREADS
+#endif
+
 
 
 const rect_t extract_rect_infinite = { { -DBL_MAX, -DBL_MAX }, {  DBL_MAX,  DBL_MAX } };
@@ -149,7 +161,7 @@ char_t *extract_span_append_c(extract_alloc_t *alloc, span_t *span, int c)
 {
 	char_t *item;
 
-	if (extract_realloc2(alloc,
+	if (extract_realloc2_category(alloc, extract_alloc_category_CHARS,
 			&span->chars,
 			sizeof(*span->chars) * span->chars_num,
 			sizeof(*span->chars) * (span->chars_num + 1)))
@@ -307,7 +319,7 @@ void content_append_block(content_root_t *root, block_t *block)
 
 int content_new_root(extract_alloc_t *alloc, content_root_t **proot)
 {
-	if (extract_malloc(alloc, proot, sizeof(**proot))) return -1;
+	if (extract_malloc_category(alloc, extract_alloc_category_CONTENT, proot, sizeof(**proot))) return -1;
 	content_init_root(*proot, NULL);
 
 	return 0;
@@ -315,7 +327,7 @@ int content_new_root(extract_alloc_t *alloc, content_root_t **proot)
 
 int content_new_span(extract_alloc_t *alloc, span_t **pspan, structure_t *structure)
 {
-	if (extract_malloc(alloc, pspan, sizeof(**pspan))) return -1;
+	if (extract_malloc_category(alloc, extract_alloc_category_CONTENT, pspan, sizeof(**pspan))) return -1;
 	extract_span_init(*pspan, structure);
 
 	return 0;
@@ -323,7 +335,7 @@ int content_new_span(extract_alloc_t *alloc, span_t **pspan, structure_t *struct
 
 int content_new_line(extract_alloc_t *alloc, line_t **pline)
 {
-	if (extract_malloc(alloc, pline, sizeof(**pline))) return -1;
+	if (extract_malloc_category(alloc, extract_alloc_category_CONTENT, pline, sizeof(**pline))) return -1;
 	extract_line_init(*pline);
 
 	return 0;
@@ -331,7 +343,7 @@ int content_new_line(extract_alloc_t *alloc, line_t **pline)
 
 int content_new_paragraph(extract_alloc_t *alloc, paragraph_t **pparagraph)
 {
-	if (extract_malloc(alloc, pparagraph, sizeof(**pparagraph))) return -1;
+	if (extract_malloc_category(alloc, extract_alloc_category_CONTENT, pparagraph, sizeof(**pparagraph))) return -1;
 	extract_paragraph_init(*pparagraph);
 
 	return 0;
@@ -339,7 +351,7 @@ int content_new_paragraph(extract_alloc_t *alloc, paragraph_t **pparagraph)
 
 int content_new_block(extract_alloc_t *alloc, block_t **pblock)
 {
-	if (extract_malloc(alloc, pblock, sizeof(**pblock))) return -1;
+	if (extract_malloc_category(alloc, extract_alloc_category_CONTENT, pblock, sizeof(**pblock))) return -1;
 	extract_block_init(*pblock);
 
 	return 0;
@@ -347,7 +359,7 @@ int content_new_block(extract_alloc_t *alloc, block_t **pblock)
 
 int content_new_table(extract_alloc_t *alloc, table_t **ptable)
 {
-	if (extract_malloc(alloc, ptable, sizeof(**ptable))) return -1;
+	if (extract_malloc_category(alloc, extract_alloc_category_CONTENT, ptable, sizeof(**ptable))) return -1;
 	extract_table_init(*ptable);
 
 	return 0;
@@ -401,7 +413,7 @@ int content_append_new_table(extract_alloc_t *alloc, content_root_t *root, table
 /* Appends new empty image content to a content_list_t; returns -1 with errno set on error. */
 int content_append_new_image(extract_alloc_t *alloc, content_root_t *root, image_t **pimage)
 {
-	if (extract_malloc(alloc, pimage, sizeof(**pimage))) return -1;
+	if (extract_malloc_category(alloc, extract_alloc_category_CONTENT, pimage, sizeof(**pimage))) return -1;
 	extract_image_init(*pimage);
 	content_append(root, &(*pimage)->base);
 
@@ -454,6 +466,45 @@ int content_replace_new_line(extract_alloc_t *alloc, content_t *current, line_t
 	return 0;
 }
 
+/* Content generated for one output format. */
+typedef struct
+{
+	extract_format_t    format;
+
+	/* List of strings that are the generated content for each
+	extract_process() call. When zip_* can handle appending of data, we will
+	be able to remove this list. */
+	extract_astring_t  *contentss;
+	int                 contentss_num;
+
+	/* contentss[0..contentss_spilled_num) have been moved to extract_t's
+	spill file at the offsets in contentss_spill_offsets[], with sizes in
+	contentss_spill_sizes[]; the astrings themselves are empty. */
+	uint64_t           *contentss_spill_offsets;
+	size_t             *contentss_spill_sizes;
+	int                 contentss_spilled_num;
+} extract_output_t;
+
+static void output_free(extract_alloc_t *alloc, extract_output_t *output)
+{
+	int i;
+	for (i=0; i<output->contentss_num; ++i) {
+		extract_astring_free(alloc, &output->contentss[i]);
+	}
+	extract_free(alloc, &output->contentss);
+	extract_free(alloc, &output->contentss_spill_offsets);
+	extract_free(alloc, &output->contentss_spill_sizes);
+	output->contentss_num = 0;
+	output->contentss_spilled_num = 0;
+}
+
+/* Entry in extract_t's images_hash[]. */
+typedef struct
+{
+	unsigned    hash;
+	image_t    *image;  /* NULL if entry is unused. */
+} image_hash_entry_t;
+
 static void extract_images_free(extract_alloc_t *alloc, images_t *images)
 {
 	int i;
@@ -468,7 +519,8 @@ static void extract_images_free(extract_alloc_t *alloc, images_t *images)
 }
 
 
-/* Move image_t's from document->subpage[] to *o_images.
+/* Move image_t's from document->subpage[] to *o_images, appending to any
+images already there.
 
 On return document->subpage[].images* will be NULL etc.
 */
@@ -477,7 +529,7 @@ extract_document_images(extract_alloc_t *alloc, document_t *document, images_t *
 {
 	int     e = -1;
 	int      p;
-	images_t images = {0};
+	images_t images = *o_images;
 
 	outf("extract_document_images(): images.images_num=%i", images.images_num);
 	for (p=0; p<document->pages_num; ++p)
@@ -493,7 +545,13 @@ extract_document_images(extract_alloc_t *alloc, document_t *document, images_t *
 
 			for (i = 0, image = content_image_iterator_init(&iit, &subpage->content); image != NULL; i++, image = content_image_iterator_next(&iit))
 			{
-				if (extract_realloc2(alloc,
+				if (image->repeat)
+				{
+					/* Repeat of an earlier image; leave it to be freed with
+					the page. */
+					continue;
+				}
+				if (extract_realloc2_category(alloc, extract_alloc_category_IMAGES,
 						 &images.images,
 						 sizeof(image_t) * images.images_num,
 						 sizeof(image_t) * (images.images_num + 1))) goto end;
@@ -518,8 +576,9 @@ extract_document_images(extract_alloc_t *alloc, document_t *document, images_t *
 					if (it == images.imagetypes_num)
 					{
 						/* We haven't seen this image type before. */
-						if (extract_realloc2(
+						if (extract_realloc2_category(
 								alloc,
+								extract_alloc_category_IMAGES,
 								&images.imagetypes,
 								sizeof(char*) * images.imagetypes_num,
 								sizeof(char*) * (images.imagetypes_num + 1)
@@ -537,14 +596,7 @@ extract_document_images(extract_alloc_t *alloc, document_t *document, images_t *
 	e = 0;
 end:
 
-	if (e)
-	{
-		extract_free(alloc, &images.images);
-	}
-	else
-	{
-		*o_images = images;
-	}
+	*o_images = images;
 
 	return e;
 }
@@ -693,10 +745,73 @@ struct extract_t
 	/* Used to generate unique ids for images. */
 	int                      image_n;
 
-	/* List of strings that are the generated docx content for each page. When
-	 * zip_* can handle appending of data, we will be able to remove this list. */
-	extract_astring_t       *contentss;
-	int                      contentss_num;
+	/* Open-addressing hash table of distinct images passed to
+	extract_add_image(), so that repeated images share a single payload and
+	archive member. Size is zero or a power of two. */
+	image_hash_entry_t      *images_hash;
+	int                      images_hash_size;
+	int                      images_hash_num;
+
+	/* Content for each output format. outputs[0] is for .format; others are
+	added by extract_set_formats(). */
+	extract_output_t        *outputs;
+	int                      outputs_num;
+
+	/* If not NULL, HTML/TEXT/JSON content for .format is written here by each
+	extract_process() call instead of being accumulated in contentss[]. See
+	extract_set_stream(). */
+	extract_buffer_t        *stream;
+	int                      stream_started;
+	int                      stream_json_first;
+
+	/* If not NULL, called with each page's content for .format by
+	extract_process(). See extract_set_page_content_fn(). */
+	extract_page_content_fn *page_content_fn;
+	void                    *page_content_handle;
+	int                      page_content_keep;
+
+	/* Number of pages processed so far by extract_process(). */
+	int                      page_index;
+
+	/* If not NULL, input calls are also written here in binary intermediate
+	format. See extract_set_record(). */
+	extract_binary_writer_t *record;
+
+	/* Number of threads used by extract_read_intermediate(). See
+	extract_set_threads(). */
+	int                      threads;
+
+	/* Where we gather statistics and send trace events. See
+	extract_set_stats() and extract_set_trace(). */
+	extract_probe_t          probe;
+
+	/* Set if content from the last extract_process() is still open; see
+	process(). */
+	int                      process_more;
+	int                      process_text_box_id;
+
+	/* Set by extract_read_intermediate_process(), to make extract_page_end()
+	process and free pages once there are .process_max_pages pages or
+	.process_max_chars chars. */
+	int                      process_bounded;
+	int                      process_spacing;
+	int                      process_rotation;
+	int                      process_images;
+	int                      process_max_pages;
+	size_t                   process_max_chars;
+	size_t                   process_chars;
+
+	/* If .spill_dir is not NULL, content and image data are moved to
+	temporary file .spill once more than .spill_threshold bytes are pending.
+	See extract_set_spill(). */
+	char                    *spill_dir;
+	size_t                   spill_threshold;
+	size_t                   spill_pending;
+	extract_spill_t         *spill;
+
+	/* images.images[0..images_spill_checked) have been moved to .spill or
+	cannot be. */
+	int                      images_spill_checked;
 
 	images_t                 images;
 
@@ -766,12 +881,21 @@ int extract_begin(extract_alloc_t  *alloc,
 	extract->alloc = alloc;
 	extract->master_space_guess = 0.5;
 	document_init(&extract->document);
+	extract->probe.page = -1;
 
 	/* FIXME: Start at 10 because template document might use some low-numbered IDs.
 	*/
 	extract->image_n = 10;
 
 	extract->format = format;
+	if (extract_malloc(alloc, &extract->outputs, sizeof(*extract->outputs)))
+	{
+		extract_free(alloc, &extract);
+		return -1;
+	}
+	extract_bzero(extract->outputs, sizeof(*extract->outputs));
+	extract->outputs[0].format = format;
+	extract->outputs_num = 1;
 	extract->tables_csv_format = NULL;
 	extract->tables_csv_i = 0;
 
@@ -793,6 +917,343 @@ int extract_set_layout_analysis(extract_t *extract, int enable)
 	return 0;
 }
 
+int extract_set_page_content_fn(
+		extract_t               *extract,
+		extract_page_content_fn *fn,
+		void                    *handle,
+		int                      keep)
+{
+	extract->page_content_fn = fn;
+	extract->page_content_handle = handle;
+	extract->page_content_keep = keep;
+	return 0;
+}
+
+int extract_set_spill(extract_t *extract, const char *dir, size_t threshold)
+{
+	extract_free(extract->alloc, &extract->spill_dir);
+	if (dir)
+	{
+		if (extract_strdup(extract->alloc, dir, &extract->spill_dir)) return -1;
+	}
+	extract->spill_threshold = threshold;
+	return 0;
+}
+
+int extract_set_record(extract_t *extract, extract_buffer_t *buffer)
+{
+	if (extract->record)
+	{
+		extract_binary_writer_free(extract->record);
+		extract_free(extract->alloc, &extract->record);
+	}
+	if (!buffer) return 0;
+
+	if (extract_malloc(extract->alloc, &extract->record, sizeof(*extract->record))) return -1;
+	if (extract_binary_writer_init(extract->alloc, buffer, extract->record))
+	{
+		extract_binary_writer_free(extract->record);
+		extract_free(extract->alloc, &extract->record);
+		return -1;
+	}
+	return 0;
+}
+
+int extract_set_threads(extract_t *extract, int threads)
+{
+	if (threads < 1)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	extract->threads = threads;
+	return 0;
+}
+
+int extract_set_stats(extract_t *extract, int enable)
+{
+	if (enable)
+	{
+		if (!extract->probe.stats && extract_malloc(extract->alloc, &extract->probe.stats, sizeof(*extract->probe.stats))) return -1;
+		extract_bzero(extract->probe.stats, sizeof(*extract->probe.stats));
+		extract->num_spans_split = 0;
+		extract->num_spans_autosplit = 0;
+	}
+	else
+	{
+		extract_free(extract->alloc, &extract->probe.stats);
+	}
+	return 0;
+}
+
+const extract_stats_t *extract_stats(extract_t *extract)
+{
+	if (extract->probe.stats)
+	{
+		extract->probe.stats->spans_split = extract->num_spans_split;
+		extract->probe.stats->spans_autosplit = extract->num_spans_autosplit;
+	}
+	return extract->probe.stats;
+}
+
+int extract_set_trace(extract_t *extract, extract_trace_fn *fn, void *handle)
+{
+	extract->probe.trace_fn = fn;
+	extract->probe.trace_handle = handle;
+	return 0;
+}
+
+/* Returns &extract->probe if stats or tracing are enabled, otherwise NULL so
+that we don't even look at the time. */
+static extract_probe_t *probe_get(extract_t *extract)
+{
+	if (extract->probe.stats || extract->probe.trace_fn) return &extract->probe;
+	return NULL;
+}
+
+/* Makes <buffer> record I/O times in extract->probe and sets *o_pos to its
+current position. Returns the buffer's previous probe for passing to
+probe_buffer_end(). Does nothing if stats and tracing are not enabled. */
+static extract_probe_t *probe_buffer_begin(extract_t *extract, extract_buffer_t *buffer, size_t *o_pos)
+{
+	if (!probe_get(extract)) return NULL;
+	*o_pos = extract_buffer_pos(buffer);
+	return extract_buffer_set_probe(buffer, &extract->probe);
+}
+
+/* Restores <buffer>'s previous probe and, if <written> is set, adds bytes
+written since probe_buffer_begin() to extract->probe.stats->bytes_written. */
+static void probe_buffer_end(extract_t *extract, extract_buffer_t *buffer, extract_probe_t *prev, size_t pos, int written)
+{
+	if (!probe_get(extract)) return;
+	if (written && extract->probe.stats) extract->probe.stats->bytes_written += extract_buffer_pos(buffer) - pos;
+	extract_buffer_set_probe(buffer, prev);
+}
+
+/* Adds counts of spans, lines etc in <root> to <stats>. */
+static void stats_count(extract_stats_t *stats, content_root_t *root)
+{
+	content_tree_iterator  it;
+	content_t             *content;
+
+	for (content = content_tree_iterator_init(&it, root); content; content = content_tree_iterator_next(&it))
+	{
+		switch (content->type)
+		{
+		case content_span:
+			stats->spans += 1;
+			stats->chars += ((span_t *) content)->chars_num;
+			break;
+		case content_line:
+			stats->lines += 1;
+			break;
+		case content_paragraph:
+			stats->paragraphs += 1;
+			break;
+		case content_image:
+			stats->images += 1;
+			break;
+		case content_table:
+		{
+			table_t *table = (table_t *) content;
+			int      i;
+			stats->tables += 1;
+			for (i=0; i<table->cells_num_x * table->cells_num_y; ++i)
+			{
+				stats_count(stats, &table->cells[i]->content);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
+/* Ensures extract->spill is open. */
+static int spill_open(extract_t *extract)
+{
+	if (extract->spill) return 0;
+	if (extract_spill_open(extract->alloc, extract->spill_dir, &extract->spill)) return -1;
+	extract->images.spill = extract->spill;
+	return 0;
+}
+
+/* Moves data of <image> to spill file if we own it. */
+static int image_spill(extract_t *extract, image_t *image)
+{
+	if (image->spilled || image->repeat || image->fetch || !image->data || !image->data_free) return 0;
+	if (spill_open(extract)) return -1;
+	if (extract_spill_write(extract->spill, image->data, image->data_size, &image->spill_offset)) return -1;
+	image->data_free(image->data_free_handle, image->data);
+	image->data = NULL;
+	image->data_free = NULL;
+	image->data_free_handle = NULL;
+	image->spilled = 1;
+	return 0;
+}
+
+/* Moves all content and image data to spill file. */
+static int spill_all(extract_t *extract)
+{
+	int o;
+
+	outf("spilling: spill_pending=%zu", extract->spill_pending);
+
+	if (spill_open(extract)) return -1;
+	for (o=0; o<extract->outputs_num; ++o)
+	{
+		extract_output_t *output = &extract->outputs[o];
+		if (extract_realloc_category(
+				extract->alloc,
+				extract_alloc_category_OUTPUT,
+				&output->contentss_spill_offsets,
+				sizeof(*output->contentss_spill_offsets) * output->contentss_num
+				)) return -1;
+		if (extract_realloc_category(
+				extract->alloc,
+				extract_alloc_category_OUTPUT,
+				&output->contentss_spill_sizes,
+				sizeof(*output->contentss_spill_sizes) * output->contentss_num
+				)) return -1;
+		for (; output->contentss_spilled_num < output->contentss_num; ++output->contentss_spilled_num)
+		{
+			extract_astring_t *content = &output->contentss[output->contentss_spilled_num];
+			if (extract_spill_write(
+					extract->spill,
+					content->chars,
+					content->chars_num,
+					&output->contentss_spill_offsets[output->contentss_spilled_num]
+					)) return -1;
+			output->contentss_spill_sizes[output->contentss_spilled_num] = content->chars_num;
+			extract_astring_free(extract->alloc, content);
+		}
+	}
+	for (; extract->images_spill_checked < extract->images.images_num; ++extract->images_spill_checked)
+	{
+		if (image_spill(extract, extract->images.images[extract->images_spill_checked])) return -1;
+	}
+	extract->spill_pending = 0;
+	return 0;
+}
+
+/* Returns size of output->contentss[i], which may have been spilled. */
+static size_t content_size(extract_output_t *output, int i)
+{
+	if (i < output->contentss_spilled_num) return output->contentss_spill_sizes[i];
+	return output->contentss[i].chars_num;
+}
+
+/* Writes output->contentss[i] to <buffer>, reading from spill file if
+necessary. */
+static int content_write(extract_t *extract, extract_output_t *output, int i, extract_buffer_t *buffer)
+{
+	extract_astring_t *content = &output->contentss[i];
+	char               data[64 * 1024];
+	uint64_t           offset;
+	size_t             size;
+	size_t             pos;
+
+	if (i >= output->contentss_spilled_num)
+	{
+		return extract_buffer_write(buffer, content->chars, content->chars_num, NULL /*o_actual*/);
+	}
+	offset = output->contentss_spill_offsets[i];
+	size = output->contentss_spill_sizes[i];
+	for (pos = 0; pos < size; )
+	{
+		size_t n = size - pos;
+		if (n > sizeof(data)) n = sizeof(data);
+		if (extract_spill_read(extract->spill, offset + pos, data, n)) return -1;
+		if (extract_buffer_write(buffer, data, n, NULL /*o_actual*/)) return -1;
+		pos += n;
+	}
+	return 0;
+}
+
+/* Reads any spilled output->contentss[] back into memory, for use by code
+that needs all content at once. */
+static int contentss_unspill(extract_t *extract, extract_output_t *output)
+{
+	for (; output->contentss_spilled_num > 0; --output->contentss_spilled_num)
+	{
+		int                i = output->contentss_spilled_num - 1;
+		extract_astring_t *content = &output->contentss[i];
+		size_t             size = output->contentss_spill_sizes[i];
+		if (extract_malloc_category(extract->alloc, extract_alloc_category_OUTPUT, &content->chars, size + 1)) return -1;
+		content->chars_max = size + 1;
+		if (extract_spill_read(
+				extract->spill,
+				output->contentss_spill_offsets[i],
+				content->chars,
+				size
+				)) return -1;
+		content->chars[size] = 0;
+		content->chars_num = size;
+	}
+	return 0;
+}
+
+int extract_set_stream(extract_t *extract, extract_buffer_t *buffer)
+{
+	if (1
+			&& extract->format != extract_format_HTML
+			&& extract->format != extract_format_TEXT
+			&& extract->format != extract_format_JSON
+			)
+	{
+		outf0("Streaming not supported for format=%i", extract->format);
+		errno = EINVAL;
+		return -1;
+	}
+	if (extract->stream_started)
+	{
+		/* Too late to change. */
+		errno = EINVAL;
+		return -1;
+	}
+	extract->stream = buffer;
+	return 0;
+}
+
+/* Writes anything that must precede all content to extract->stream. */
+static int stream_start(extract_t *extract)
+{
+	if (extract->stream_started) return 0;
+	extract->stream_started = 1;
+	extract->stream_json_first = 1;
+	if (extract->format == extract_format_JSON)
+	{
+		if (extract_buffer_cat(extract->stream, "{\n\"elements\" : [\n")) return -1;
+	}
+	return 0;
+}
+
+/* Writes the most recent item in extract->outputs[0].contentss[] to
+extract->stream and removes it from extract->outputs[0].contentss[]. */
+static int stream_content(extract_t *extract)
+{
+	int                e = -1;
+	extract_output_t  *output = &extract->outputs[0];
+	extract_astring_t *content = &output->contentss[output->contentss_num - 1];
+
+	if (stream_start(extract)) goto end;
+	if (extract->format == extract_format_JSON)
+	{
+		/* Same as extract_write(). */
+		if (!extract->stream_json_first && extract_buffer_cat(extract->stream, ",\n")) goto end;
+		if (content->chars_num > 0) extract->stream_json_first = 0;
+	}
+	if (extract_buffer_write(extract->stream, content->chars, content->chars_num, NULL)) goto end;
+
+	e = 0;
+end:
+
+	extract_astring_free(extract->alloc, content);
+	output->contentss_num -= 1;
+	return e;
+}
+
 int extract_tables_csv_format(extract_t *extract, const char *path_format)
 {
 	return extract_strdup(extract->alloc, path_format, &extract->tables_csv_format);
@@ -801,23 +1262,41 @@ int extract_tables_csv_format(extract_t *extract, const char *path_format)
 
 static void image_free_fn(void *handle, void *image_data)
 {
-	(void) handle;
-	free(image_data);
+	extract_free((extract_alloc_t *) handle, &image_data);
 }
 
-int extract_read_intermediate(extract_t *extract, extract_buffer_t *buffer)
-{
-	int                ret        = -1;
-	document_t        *document   = &extract->document;
-	char              *image_data = NULL;
-	int                num_spans  = 0;
-	extract_xml_tag_t  tag;
+/* Reads XML intermediate data from <buffer>, after <prefix>, which is data that
+has already been read from <buffer>.
 
-	extract_xml_tag_init(&tag);
-
-	if (extract_xml_pparse_init(extract->alloc, buffer, NULL /*first_line*/)) {
+If <writer> is NULL we make calls to extract_page_begin() etc on <extract>.
+Otherwise <extract> must be NULL and we write equivalent binary intermediate
+records to <writer>; this is used by worker threads in
+s_read_intermediate_threads(). */
+static int s_read_intermediate_xml(
+		extract_t               *extract,
+		extract_binary_writer_t *writer,
+		extract_buffer_t        *buffer,
+		const char              *prefix,
+		size_t                   prefix_size)
+{
+	int                      ret        = -1;
+	extract_alloc_t         *alloc      = (writer) ? writer->alloc : extract->alloc;
+	char                    *image_data = NULL;
+	int                      num_spans  = 0;
+	extract_xml_scanner_t    scanner;
+	extract_xml_slice_tag_t *tag = &scanner.tag;
+	extract_astring_t        value;
+	extract_xml_schema_t     span_schema;
+	extract_xml_schema_t     char_schema;
+	static const char *const span_names[] = { "ctm", "trm", "font_name", "wmode" };
+	static const char *const char_names[] = { "x", "y", "adv", "ucs" };
+
+	extract_astring_init(&value);
+	extract_xml_schema_init(&span_schema, span_names, sizeof(span_names) / sizeof(span_names[0]));
+	extract_xml_schema_init(&char_schema, char_names, sizeof(char_names) / sizeof(char_names[0]));
+	if (extract_xml_scanner_init(alloc, buffer, prefix, prefix_size, &scanner)) {
 		outf("Failed to read start of intermediate data: %s", strerror(errno));
-		goto end;
+		return -1;
 	}
 	/* Data read from <path> is expected to be XML looking like:
 
@@ -846,67 +1325,85 @@ int extract_read_intermediate(extract_t *extract, extract_buffer_t *buffer)
 		Split spans in two where there seem to be large gaps between glyphs.
 	*/
 	for(;;) {
-		extract_page_t *page;
-		subpage_t      *subpage;
+		subpage_t      *subpage = NULL;
 		rect_t          mediabox = extract_rect_infinite; /* Fake mediabox */
-		int             e = extract_xml_pparse_next(buffer, &tag);
+		int             e = extract_xml_scanner_next(&scanner);
 
 		if (e == 1) break; /* EOF. */
 		if (e) goto end;
-		if (!strcmp(tag.name, "?xml")) {
+		if (extract_xml_slice_is(&tag->name, "?xml")) {
 			/* We simply skip this if we find it. As of 2020-07-31, mutool adds
 			this header to mupdf raw output, but gs txtwrite does not include
 			it. */
 			continue;
 		}
-		if (strcmp(tag.name, "page")) {
-			outf("Expected <page> but tag.name='%s'", tag.name);
+		if (!extract_xml_slice_is(&tag->name, "page")) {
+			outf("Expected <page> but tag->name='%.*s'", (int) tag->name.chars_num, tag->name.chars);
 			errno = ESRCH;
 			goto end;
 		}
-		outfx("loading spans for page %i...", document->pages_num);
-		if (extract_page_begin(extract, mediabox.min.x, mediabox.min.y, mediabox.max.x, mediabox.max.y)) goto end;
-		page = extract->document.pages[extract->document.pages_num-1];
-		if (!page) goto end;
-		subpage = page->subpages[page->subpages_num-1];
-		if (!subpage) goto end;
+		if (writer)
+		{
+			if (extract_binary_write_doubles(
+					writer,
+					extract_binary_PAGE_BEGIN,
+					4,
+					mediabox.min.x,
+					mediabox.min.y,
+					mediabox.max.x,
+					mediabox.max.y
+					)) goto end;
+		}
+		else
+		{
+			extract_page_t *page;
+			outfx("loading spans for page %i...", extract->document.pages_num);
+			if (extract_page_begin(extract, mediabox.min.x, mediabox.min.y, mediabox.max.x, mediabox.max.y)) goto end;
+			page = extract->document.pages[extract->document.pages_num-1];
+			if (!page) goto end;
+			subpage = page->subpages[page->subpages_num-1];
+			if (!subpage) goto end;
+		}
 
 		for(;;) {
-			if (extract_xml_pparse_next(buffer, &tag)) goto end;
-			if (!strcmp(tag.name, "/page")) {
-				num_spans += content_count_spans(&subpage->content);
+			if (extract_xml_scanner_next(&scanner)) goto end;
+			if (extract_xml_slice_is(&tag->name, "/page")) {
+				if (subpage) num_spans += content_count_spans(&subpage->content);
 				break;
 			}
-			if (!strcmp(tag.name, "image")) {
-				const char* type = extract_xml_tag_attributes_find(&tag, "type");
-				if (!type) {
+			if (extract_xml_slice_is(&tag->name, "image")) {
+				const extract_xml_slice_t* type_slice = extract_xml_slice_tag_find(tag, "type");
+				const char*                type;
+				if (!type_slice) {
 					errno = EINVAL;
 					goto end;
 				}
+				if (extract_xml_slice_to_astring(alloc, type_slice, &value)) goto end;
+				type = value.chars;
 				outf("image type=%s", type);
 				if (!strcmp(type, "pixmap")) {
 					int w;
 					int h;
 					int y;
-					if (extract_xml_tag_attributes_find_int(&tag, "w", &w)) goto end;
-					if (extract_xml_tag_attributes_find_int(&tag, "h", &h)) goto end;
+					if (extract_xml_slice_tag_find_int(tag, "w", &w)) goto end;
+					if (extract_xml_slice_tag_find_int(tag, "h", &h)) goto end;
 					for (y=0; y<h; ++y) {
 						int yy;
-						if (extract_xml_pparse_next(buffer, &tag)) goto end;
-						if (strcmp(tag.name, "line")) {
-							outf("Expected <line> but tag.name='%s'", tag.name);
+						if (extract_xml_scanner_next(&scanner)) goto end;
+						if (!extract_xml_slice_is(&tag->name, "line")) {
+							outf("Expected <line> but tag->name='%.*s'", (int) tag->name.chars_num, tag->name.chars);
 							errno = ESRCH;
 							goto end;
 						}
-						if (extract_xml_tag_attributes_find_int(&tag, "y", &yy)) goto end;
+						if (extract_xml_slice_tag_find_int(tag, "y", &yy)) goto end;
 						if (yy != y) {
 							outf("Expected <line y=%i> but found <line y=%i>", y, yy);
 							errno = ESRCH;
 							goto end;
 						}
-						if (extract_xml_pparse_next(buffer, &tag)) goto end;
-						if (strcmp(tag.name, "/line")) {
-							outf("Expected </line> but tag.name='%s'", tag.name);
+						if (extract_xml_scanner_next(&scanner)) goto end;
+						if (!extract_xml_slice_is(&tag->name, "/line")) {
+							outf("Expected </line> but tag->name='%.*s'", (int) tag->name.chars_num, tag->name.chars);
 							errno = ESRCH;
 							goto end;
 						}
@@ -914,93 +1411,93 @@ int extract_read_intermediate(extract_t *extract, extract_buffer_t *buffer)
 				}
 				else {
 					/* Compressed. */
-					size_t      image_data_size;
-					const char *c;
-					size_t      i;
-					if (extract_xml_tag_attributes_find_size(&tag, "datasize", &image_data_size)) goto end;
-					if (extract_malloc(extract->alloc, &image_data, image_data_size)) goto end;
-					c = tag.text.chars;
-					for(i=0;;) {
-						int byte = 0;
-						int cc;
-						cc = *c;
-						c += 1;
-						if (cc == ' ' || cc == '\n') continue;
-						if (cc >= '0' && cc <= '9') byte += cc-'0';
-						else if (cc >= 'a' && cc <= 'f') byte += 10 + cc - 'a';
-						else goto compressed_error;
-						byte *= 16;
-
-						cc = *c;
-						c += 1;
-						if (cc >= '0' && cc <= '9') byte += cc-'0';
-						else if (cc >= 'a' && cc <= 'f') byte += 10 + cc - 'a';
-						else goto compressed_error;
-
-						image_data[i] = (char) byte;
-						i += 1;
-						if (i == image_data_size) {
-							break;
-						}
-						continue;
-
-						compressed_error:
-						outf("Unrecognised hex character '%x' at offset %lli in image data", cc, (long long) (c-tag.text.chars));
-						errno = EINVAL;
-						goto end;
+					size_t image_data_size;
+					if (extract_xml_slice_tag_find_size(tag, "datasize", &image_data_size)) goto end;
+					if (extract_malloc_category(alloc, extract_alloc_category_IMAGES, &image_data, image_data_size)) goto end;
+					if (extract_xml_slice_hex_decode(&tag->text, image_data, image_data_size)) goto end;
+					if (writer)
+					{
+						if (extract_binary_write_image(
+								writer,
+								type,
+								0 /*x*/,
+								0 /*y*/,
+								0 /*w*/,
+								0 /*h*/,
+								image_data,
+								image_data_size
+								)) goto end;
+						extract_free(alloc, &image_data);
 					}
-					if (extract_add_image(
-							extract,
-							type,
-							0 /*x*/,
-							0 /*y*/,
-							0 /*w*/,
-							0 /*h*/,
-							image_data,
-							image_data_size,
-							image_free_fn,
-							NULL
-							))
+					else
 					{
-						goto end;
+						if (extract_add_image(
+								extract,
+								type,
+								0 /*x*/,
+								0 /*y*/,
+								0 /*w*/,
+								0 /*h*/,
+								image_data,
+								image_data_size,
+								image_free_fn,
+								alloc
+								))
+						{
+							goto end;
+						}
+						image_data = NULL;
 					}
-					image_data = NULL;
 				}
-				if (extract_xml_pparse_next(buffer, &tag)) goto end;
-				if (strcmp(tag.name, "/image")) {
-					outf("Expected </image> but tag.name='%s'", tag.name);
+				if (extract_xml_scanner_next(&scanner)) goto end;
+				if (!extract_xml_slice_is(&tag->name, "/image")) {
+					outf("Expected </image> but tag->name='%.*s'", (int) tag->name.chars_num, tag->name.chars);
 					errno = ESRCH;
 					goto end;
 				}
 				continue;
 			}
-			if (strcmp(tag.name, "span")) {
-				outf("Expected <span> but tag.name='%s'", tag.name);
+			if (!extract_xml_slice_is(&tag->name, "span")) {
+				outf("Expected <span> but tag->name='%.*s'", (int) tag->name.chars_num, tag->name.chars);
 				errno = ESRCH;
 				goto end;
 			}
 
 			{
-				matrix_t  ctm;
-				matrix_t  trm;
-				char     *font_name;
-				char     *font_name2;
-				int       font_bold;
-				int       font_italic;
-				int       wmode;
-				if (s_matrix_read(extract_xml_tag_attributes_find(&tag, "ctm"), &ctm)) goto end;
-				if (s_matrix_read(extract_xml_tag_attributes_find(&tag, "trm"), &trm)) goto end;
-				font_name = extract_xml_tag_attributes_find(&tag, "font_name");
-				if (!font_name) {
-					outf("Failed to find attribute 'font_name'");
-					goto end;
-				}
+				matrix_t                   ctm;
+				matrix_t                   trm;
+				const extract_xml_slice_t *values[4];
+				char                      *font_name;
+				char                      *font_name2;
+				int                        font_bold;
+				int                        font_italic;
+				int                        wmode;
+				if (extract_xml_schema_find(&span_schema, tag, values)) goto end;
+				if (extract_xml_slice_to_astring(alloc, values[0], &value)) goto end;
+				if (s_matrix_read(value.chars, &ctm)) goto end;
+				if (extract_xml_slice_to_astring(alloc, values[1], &value)) goto end;
+				if (s_matrix_read(value.chars, &trm)) goto end;
+				if (extract_xml_slice_to_int(values[3], &wmode)) goto end;
+				if (extract_xml_slice_to_astring(alloc, values[2], &value)) goto end;
+				font_name = value.chars;
 				font_name2 = strchr(font_name, '+');
 				if (font_name2)  font_name = font_name2 + 1;
 				font_bold = strstr(font_name, "-Bold") ? 1 : 0;
 				font_italic = strstr(font_name, "-Oblique") ? 1 : 0;
-				if (extract_xml_tag_attributes_find_int(&tag, "wmode", &wmode)) goto end;
-				if (extract_span_begin(extract,
+				if (writer)
+				{
+					if (extract_binary_write_span_begin(writer,
+									   font_name,
+									   font_bold,
+									   font_italic,
+									   wmode,
+									   ctm.a,
+									   ctm.b,
+									   ctm.c,
+									   ctm.d,
+									   0,0,0,0)) goto end;
+				}
+				else if (extract_span_begin(extract,
 									   font_name,
 									   font_bold,
 									   font_italic,
@@ -1012,103 +1509,344 @@ int extract_read_intermediate(extract_t *extract, extract_buffer_t *buffer)
 									   0,0,0,0)) goto end;
 
 				for(;;) {
-					double       x;
-					double       y;
-					double       adv;
-					unsigned int ucs;
+					double                     x;
+					double                     y;
+					double                     adv;
+					unsigned int               ucs;
+					const extract_xml_slice_t *char_values[4];
 
-					if (extract_xml_pparse_next(buffer, &tag)) {
+					if (extract_xml_scanner_next(&scanner)) {
 						outf("Failed to find <char or </span");
 						goto end;
 					}
-					if (!strcmp(tag.name, "/span")) {
+					if (extract_xml_slice_is(&tag->name, "/span")) {
 						break;
 					}
-					if (strcmp(tag.name, "char")) {
+					if (!extract_xml_slice_is(&tag->name, "char")) {
 						errno = ESRCH;
-						outf("Expected <char> but tag.name='%s'", tag.name);
+						outf("Expected <char> but tag->name='%.*s'", (int) tag->name.chars_num, tag->name.chars);
 						goto end;
 					}
 
-					if (extract_xml_tag_attributes_find_double(&tag, "x", &x)) goto end;
-					if (extract_xml_tag_attributes_find_double(&tag, "y", &y)) goto end;
-					if (extract_xml_tag_attributes_find_double(&tag, "adv", &adv)) goto end;
-					if (extract_xml_tag_attributes_find_uint(&tag, "ucs", &ucs)) goto end;
+					if (extract_xml_schema_find(&char_schema, tag, char_values)) goto end;
+					if (extract_xml_slice_to_double(char_values[0], &x)) goto end;
+					if (extract_xml_slice_to_double(char_values[1], &y)) goto end;
+					if (extract_xml_slice_to_double(char_values[2], &adv)) goto end;
+					if (extract_xml_slice_to_uint(char_values[3], &ucs)) goto end;
 
 					/* BBox is bogus here. Analysis will fail. */
-					if (extract_add_char(extract, x, y, ucs, adv, x, y, x + adv, y + adv)) goto end;
+					if (writer)
+					{
+						if (extract_binary_write_char(writer, x, y, ucs, adv, x, y, x + adv, y + adv)) goto end;
+					}
+					else if (extract_add_char(extract, x, y, ucs, adv, x, y, x + adv, y + adv)) goto end;
 				}
-
-				extract_xml_tag_free(extract->alloc, &tag);
 			}
 		}
-		if (extract_page_end(extract)) goto end;
-		outf("page=%i subpage->num_spans=%i",
-				document->pages_num, content_count_spans(&subpage->content));
+		if (writer)
+		{
+			if (extract_binary_write_doubles(writer, extract_binary_PAGE_END, 0)) goto end;
+		}
+		else
+		{
+			if (extract_page_end(extract)) goto end;
+			outf("page=%i subpage->num_spans=%i",
+					extract->document.pages_num, content_count_spans(&subpage->content));
+		}
 	}
 
-	outf("num_spans=%i num_spans_split=%i num_spans_autosplit=%i",
-			num_spans,
-			extract->num_spans_split,
-			extract->num_spans_autosplit
-			);
+	if (extract)
+	{
+		outf("num_spans=%i num_spans_split=%i num_spans_autosplit=%i",
+				num_spans,
+				extract->num_spans_split,
+				extract->num_spans_autosplit
+				);
+	}
 
 	ret = 0;
 end:
 
-	extract_xml_tag_free(extract->alloc, &tag);
-	extract_free(extract->alloc, &image_data);
+	extract_xml_scanner_free(&scanner);
+	extract_astring_free(alloc, &value);
+	extract_free(alloc, &image_data);
 
 	return ret;
 }
 
-int
-extract_span_begin(
-		extract_t  *extract,
-		const char *font_name,
-		int         font_bold,
-		int         font_italic,
-		int         wmode,
-		double      ctm_a,
-		double      ctm_b,
-		double      ctm_c,
-		double      ctm_d,
-		double      bbox_x0,
-		double      bbox_y0,
-		double      bbox_x1,
-		double      bbox_y1)
+/* Reads intermediate data in either format. */
+static int s_read_intermediate(extract_t *extract, extract_buffer_t *buffer)
 {
-	int             e = -1;
-	extract_page_t *page;
-	subpage_t      *subpage;
-	span_t         *span;
-	document_t     *document = &extract->document;
+	char   magic[extract_binary_magic_size];
+	size_t magic_size;
 
-	/* FIXME: RJW: Should continue the last span if everything is the same. */
+	/* Look for binary intermediate format. */
+	if (extract_buffer_read(buffer, magic, sizeof(magic), &magic_size) < 0) return -1;
+	if (magic_size == sizeof(magic) && !memcmp(magic, extract_binary_magic, sizeof(magic)))
+	{
+		return extract_binary_read(extract, extract->alloc, buffer);
+	}
 
-	assert(document->pages_num > 0);
-	page = document->pages[document->pages_num-1];
-	subpage = page->subpages[page->subpages_num-1];
-	outf("extract_span_begin(): ctm=(%f %f %f %f) font_name=%s, wmode=%i",
-		 ctm_a,
-		 ctm_b,
-		 ctm_c,
-		 ctm_d,
-		 font_name,
-		 wmode);
-	if (content_append_new_span(extract->alloc, &subpage->content, &span, document->current)) goto end;
-	span->ctm.a = ctm_a;
-	span->ctm.b = ctm_b;
-	span->ctm.c = ctm_c;
-	span->ctm.d = ctm_d;
-	span->font_bbox.min.x = bbox_x0;
-	span->font_bbox.min.y = bbox_y0;
-	span->font_bbox.max.x = bbox_x1;
-	span->font_bbox.max.y = bbox_y1;
+	return s_read_intermediate_xml(extract, NULL /*writer*/, buffer, magic, magic_size);
+}
 
-	{
-		const char *ff = strchr(font_name, '+');
-		const char *f = (ff) ? ff+1 : font_name;
+#ifdef extract_PTHREADS
+
+/* Like s_read_intermediate() but for in-memory data. */
+static int s_read_intermediate_data(extract_t *extract, const void *data, size_t data_size)
+{
+	int               e;
+	extract_buffer_t *buffer;
+
+	if (extract_buffer_open_simple(extract->alloc, data, data_size, NULL, NULL, &buffer)) return -1;
+	e = s_read_intermediate(extract, buffer);
+	extract_buffer_close(&buffer);
+
+	return e;
+}
+
+/* A range of whole pages of XML intermediate data, for
+s_read_intermediate_threads(). */
+typedef struct
+{
+	const char                 *data;
+	size_t                      data_size;
+
+	/* Binary intermediate data, allocated with NULL allocator. */
+	extract_buffer_expanding_t  output;
+
+	int                         e;
+	int                         errno_;
+	pthread_t                   thread;
+	int                         thread_started;
+} page_range_t;
+
+/* Converts range->data to binary intermediate data in range->output. May be
+called on a worker thread, so uses NULL allocator because extract_alloc_t is
+not thread-safe. */
+static void *page_range_parse(void *handle)
+{
+	page_range_t            *range  = handle;
+	extract_buffer_t        *buffer = NULL;
+	extract_binary_writer_t  writer;
+
+	extract_bzero(&writer, sizeof(writer));
+	range->e = -1;
+	if (extract_buffer_open_simple(NULL /*alloc*/, range->data, range->data_size, NULL, NULL, &buffer)) goto end;
+	if (extract_buffer_expanding_create(NULL /*alloc*/, &range->output)) goto end;
+	if (extract_binary_writer_init(NULL /*alloc*/, range->output.buffer, &writer)) goto end;
+	if (s_read_intermediate_xml(NULL /*extract*/, &writer, buffer, NULL, 0)) goto end;
+	if (extract_buffer_close(&range->output.buffer)) goto end;
+
+	range->e = 0;
+end:
+
+	if (range->e) range->errno_ = errno;
+	extract_binary_writer_free(&writer);
+	extract_buffer_close(&buffer);
+	extract_buffer_close(&range->output.buffer);
+
+	return NULL;
+}
+
+/* Returns offset of first "<page" tag in data[pos..data_size), or
+<data_size> if there is none. This is a simple search, which works because
+'<' cannot appear in intermediate XML except at the start of tags. */
+static size_t s_find_page(const char *data, size_t data_size, size_t pos)
+{
+	while (pos + 6 <= data_size)
+	{
+		const char *c = memchr(data + pos, '<', data_size - pos);
+		if (!c) break;
+		pos = (size_t) (c - data);
+		if (pos + 6 > data_size) break;
+		if (!memcmp(c, "<page", 5) && c[5] && strchr(" \t\r\n/>", c[5])) return pos;
+		pos += 1;
+	}
+
+	return data_size;
+}
+
+/* Reads in-memory intermediate data by splitting it into ranges of pages,
+parsing each range to binary intermediate data on a separate thread, and
+replaying the results in order.
+
+Only the tokenising is parallel: pages, spans and images are created by the
+serial replay on this thread, because they are allocated with extract->alloc,
+which is not thread-safe. */
+static int s_read_intermediate_threads(extract_t *extract, const char *data, size_t data_size)
+{
+	int           e          = -1;
+	page_range_t *ranges     = NULL;
+	int           ranges_num = 0;
+	size_t        begin      = 0;
+	int           i;
+
+	if (data_size >= extract_binary_magic_size && !memcmp(data, extract_binary_magic, extract_binary_magic_size))
+	{
+		return s_read_intermediate_data(extract, data, data_size);
+	}
+
+	if (extract_malloc(extract->alloc, &ranges, sizeof(*ranges) * extract->threads)) return -1;
+	extract_bzero(ranges, sizeof(*ranges) * extract->threads);
+
+	/* Split into ranges of roughly equal size. The first range starts at the
+	beginning so that it includes any <?xml ...> header. */
+	while (begin < data_size && ranges_num < extract->threads)
+	{
+		size_t end = data_size / extract->threads * (ranges_num + 1);
+		if (ranges_num + 1 < extract->threads)
+		{
+			if (end <= begin) end = begin + 1;
+			end = s_find_page(data, data_size, end);
+		}
+		else
+		{
+			end = data_size;
+		}
+		ranges[ranges_num].data = data + begin;
+		ranges[ranges_num].data_size = end - begin;
+		ranges_num += 1;
+		begin = end;
+	}
+	outf("ranges_num=%i", ranges_num);
+	if (ranges_num < 2)
+	{
+		extract_free(extract->alloc, &ranges);
+		return s_read_intermediate_data(extract, data, data_size);
+	}
+
+	for (i=0; i<ranges_num; ++i)
+	{
+		/* If we fail to create a thread, we parse the range inline below. */
+		if (!pthread_create(&ranges[i].thread, NULL, page_range_parse, &ranges[i]))
+			ranges[i].thread_started = 1;
+	}
+
+	/* Replay the ranges in order, which adds their pages to the document in
+	the original order. */
+	e = 0;
+	for (i=0; i<ranges_num; ++i)
+	{
+		page_range_t *range = &ranges[i];
+		if (range->thread_started)
+			pthread_join(range->thread, NULL);
+		else if (!e)
+			page_range_parse(range);
+
+		if (!e)
+		{
+			if (range->e)
+			{
+				errno = range->errno_;
+				e = -1;
+			}
+			else if (s_read_intermediate_data(extract, range->output.data, range->output.data_size))
+			{
+				e = -1;
+			}
+		}
+		extract_free(NULL /*alloc*/, &range->output.data);
+	}
+
+	extract_free(extract->alloc, &ranges);
+
+	return e;
+}
+
+#endif
+
+int extract_read_intermediate(extract_t *extract, extract_buffer_t *buffer)
+{
+	int                    e;
+#ifdef extract_PTHREADS
+	const void            *data;
+	size_t                 data_size;
+#endif
+	size_t                 pos = 0;
+	extract_probe_t       *buffer_probe = probe_buffer_begin(extract, buffer, &pos);
+	extract_probe_timer_t  timer;
+
+	extract_probe_begin(probe_get(extract), extract_stage_INGEST, &timer);
+#ifdef extract_PTHREADS
+	if (extract->threads > 1 && !extract_buffer_read_remaining(buffer, &data, &data_size))
+	{
+		e = s_read_intermediate_threads(extract, data, data_size);
+	}
+	else
+#endif
+	{
+		e = s_read_intermediate(extract, buffer);
+	}
+	extract_probe_end(probe_get(extract), extract_stage_INGEST, &timer);
+	probe_buffer_end(extract, buffer, buffer_probe, pos, 0 /*written*/);
+
+	return e;
+}
+
+int
+extract_span_begin(
+		extract_t  *extract,
+		const char *font_name,
+		int         font_bold,
+		int         font_italic,
+		int         wmode,
+		double      ctm_a,
+		double      ctm_b,
+		double      ctm_c,
+		double      ctm_d,
+		double      bbox_x0,
+		double      bbox_y0,
+		double      bbox_x1,
+		double      bbox_y1)
+{
+	int             e = -1;
+	extract_page_t *page;
+	subpage_t      *subpage;
+	span_t         *span;
+	document_t     *document = &extract->document;
+
+	/* FIXME: RJW: Should continue the last span if everything is the same. */
+
+	if (extract->record && extract_binary_write_span_begin(
+			extract->record,
+			font_name,
+			font_bold,
+			font_italic,
+			wmode,
+			ctm_a,
+			ctm_b,
+			ctm_c,
+			ctm_d,
+			bbox_x0,
+			bbox_y0,
+			bbox_x1,
+			bbox_y1
+			)) return -1;
+
+	assert(document->pages_num > 0);
+	page = document->pages[document->pages_num-1];
+	subpage = page->subpages[page->subpages_num-1];
+	outf("extract_span_begin(): ctm=(%f %f %f %f) font_name=%s, wmode=%i",
+		 ctm_a,
+		 ctm_b,
+		 ctm_c,
+		 ctm_d,
+		 font_name,
+		 wmode);
+	if (content_append_new_span(extract->alloc, &subpage->content, &span, document->current)) goto end;
+	span->ctm.a = ctm_a;
+	span->ctm.b = ctm_b;
+	span->ctm.c = ctm_c;
+	span->ctm.d = ctm_d;
+	span->font_bbox.min.x = bbox_x0;
+	span->font_bbox.min.y = bbox_y0;
+	span->font_bbox.max.x = bbox_x1;
+	span->font_bbox.max.y = bbox_y1;
+
+	{
+		const char *ff = strchr(font_name, '+');
+		const char *f = (ff) ? ff+1 : font_name;
 		if (extract_strdup(extract->alloc, f, &span->font_name)) goto end;
 		span->flags.font_bold = font_bold ? 1 : 0;
 		span->flags.font_italic = font_italic ? 1 : 0;
@@ -1224,6 +1962,10 @@ int extract_add_char(
 	point_t         dir;
 	int             intervening_space;
 
+	if (extract->record && extract_binary_write_char(extract->record, x, y, ucs, adv, x0, y0, x1, y1))
+		return -1;
+	extract->process_chars += 1;
+
 	if (span->flags.wmode)
 	{
 		dir.x = 0;
@@ -1357,6 +2099,9 @@ int extract_span_end(extract_t *extract)
 	subpage_t      *subpage = page->subpages[page->subpages_num-1];
 	span_t         *span    = content_last_span(&subpage->content);
 
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_SPAN_END, 0))
+		return -1;
+
 	if (span->chars_num == 0) {
 		/* Calling code called extract_span_begin() then extract_span_end()
 		without any call to extract_add_char(). Our joining code assumes that
@@ -1368,7 +2113,121 @@ int extract_span_end(extract_t *extract)
 }
 
 
-int extract_add_image(
+/* Returns hash of image type <type> and data <data>..+<data_size>. */
+static unsigned image_hash(const char *type, const void *data, size_t data_size)
+{
+	/* FNV-1a. */
+	unsigned             hash = 2166136261u;
+	const unsigned char *p;
+	const unsigned char *end;
+
+	for (p = (const unsigned char*) type; *p; ++p)
+	{
+		hash = (hash ^ *p) * 16777619u;
+	}
+	p = (const unsigned char*) data;
+	end = p + data_size;
+	for (; p != end; ++p)
+	{
+		hash = (hash ^ *p) * 16777619u;
+	}
+	return hash;
+}
+
+/* Sets *o_same to true if earlier image <a> has type <type> and data
+<data>..+<data_size>. <a>'s data is fetched or read from the spill file if
+necessary. */
+static int image_same(
+		extract_t     *extract,
+		image_t       *a,
+		const char    *type,
+		const void    *data,
+		size_t         data_size,
+		int           *o_same)
+{
+	void *a_data;
+
+	*o_same = 0;
+	if (a->data_size != data_size) return 0;
+	if (strcmp(a->type, type)) return 0;
+	if (extract_image_data_get(extract->alloc, &extract->images, a, &a_data)) return -1;
+	*o_same = !memcmp(a_data, data, data_size);
+	extract_image_data_release(extract->alloc, a, a_data);
+	return 0;
+}
+
+/* Sets *o_original to earlier image with type <type> and data
+<data>..+<data_size>, or NULL if there is none. */
+static int images_hash_find(
+		extract_t     *extract,
+		unsigned       hash,
+		const char    *type,
+		const void    *data,
+		size_t         data_size,
+		image_t      **o_original)
+{
+	unsigned mask = (unsigned) extract->images_hash_size - 1;
+	unsigned h;
+
+	*o_original = NULL;
+	if (!extract->images_hash_size) return 0;
+	for (h = hash & mask; extract->images_hash[h].image; h = (h + 1) & mask)
+	{
+		if (extract->images_hash[h].hash == hash)
+		{
+			int same;
+			if (image_same(extract, extract->images_hash[h].image, type, data, data_size, &same)) return -1;
+			if (same)
+			{
+				*o_original = extract->images_hash[h].image;
+				return 0;
+			}
+		}
+	}
+	return 0;
+}
+
+static void images_hash_insert_(image_hash_entry_t *table, int size, unsigned hash, image_t *image)
+{
+	unsigned mask = (unsigned) size - 1;
+	unsigned h;
+
+	for (h = hash & mask; table[h].image; h = (h + 1) & mask)
+	{
+	}
+	table[h].hash = hash;
+	table[h].image = image;
+}
+
+static int images_hash_insert(extract_t *extract, unsigned hash, image_t *image)
+{
+	/* Keep table at most half full. */
+	if ((extract->images_hash_num + 1) * 2 > extract->images_hash_size)
+	{
+		int                 size = (extract->images_hash_size) ? extract->images_hash_size * 2 : 64;
+		image_hash_entry_t *table;
+		int                 i;
+
+		if (extract_malloc_category(extract->alloc, extract_alloc_category_IMAGES, &table, sizeof(*table) * size)) return -1;
+		extract_bzero(table, sizeof(*table) * size);
+		for (i=0; i<extract->images_hash_size; ++i)
+		{
+			if (extract->images_hash[i].image)
+			{
+				images_hash_insert_(table, size, extract->images_hash[i].hash, extract->images_hash[i].image);
+			}
+		}
+		extract_free(extract->alloc, &extract->images_hash);
+		extract->images_hash = table;
+		extract->images_hash_size = size;
+	}
+	images_hash_insert_(extract->images_hash, extract->images_hash_size, hash, image);
+	extract->images_hash_num += 1;
+	return 0;
+}
+
+/* Adds image to current page; <data> or <fetch> should be NULL. */
+static int add_image(
 		extract_t               *extract,
 		const char              *type,
 		double                   x,
@@ -1377,6 +2236,8 @@ int extract_add_image(
 		double                   h,
 		void                    *data,
 		size_t                   data_size,
+		extract_image_fetch     *fetch,
+		void                    *fetch_handle,
 		extract_image_data_free  data_free,
 		void                    *data_free_handle)
 {
@@ -1384,8 +2245,10 @@ int extract_add_image(
 	extract_page_t *page    = extract->document.pages[extract->document.pages_num-1];
 	subpage_t      *subpage = page->subpages[page->subpages_num-1];
 	image_t        *image;
+	image_t        *original;
+	unsigned        hash;
+	void           *fetched = NULL;
 
-	extract->image_n += 1;
 	if (content_append_new_image(extract->alloc, &subpage->content, &image)) goto end;
 	image->x = x;
 	image->y = y;
@@ -1393,11 +2256,58 @@ int extract_add_image(
 	image->h = h;
 	image->data = data;
 	image->data_size = data_size;
+	image->fetch = fetch;
+	image->fetch_handle = fetch_handle;
 	image->data_free = data_free;
 	image->data_free_handle = data_free_handle;
 	if (extract_strdup(extract->alloc, type, &image->type)) goto end;
-	if (extract_asprintf(extract->alloc, &image->id, "rId%i", extract->image_n) < 0) goto end;
-	if (extract_asprintf(extract->alloc, &image->name, "image%i.%s", extract->image_n, image->type) < 0) goto end;
+
+	/* Repeated images are found by comparing their data, so if <image> is
+	lazy we fetch its data temporarily. */
+	if (fetch)
+	{
+		if (fetch(fetch_handle, &fetched)) goto end;
+		hash = image_hash(type, fetched, data_size);
+		if (images_hash_find(extract, hash, type, fetched, data_size, &original)) goto end;
+	}
+	else
+	{
+		hash = image_hash(type, data, data_size);
+		if (images_hash_find(extract, hash, type, data, data_size, &original)) goto end;
+	}
+	if (original)
+	{
+		/* Refer to the earlier image's archive member, and free our copy of
+		the data immediately. */
+		outf("image is repeat of %s", original->name);
+		if (data && data_free) data_free(data_free_handle, data);
+		image->data = NULL;
+		image->fetch = NULL;
+		image->data_free = NULL;
+		image->repeat = 1;
+		if (extract_strdup(extract->alloc, original->id, &image->id)) goto end;
+		if (extract_strdup(extract->alloc, original->name, &image->name)) goto end;
+	}
+	else
+	{
+		extract->image_n += 1;
+		if (extract_asprintf(extract->alloc, &image->id, "rId%i", extract->image_n) < 0) goto end;
+		if (extract_asprintf(extract->alloc, &image->name, "image%i.%s", extract->image_n, image->type) < 0) goto end;
+		if (extract->spill_dir && data && data_free)
+		{
+			if (extract->spill_pending + data_size > extract->spill_threshold)
+			{
+				if (image_spill(extract, image)) goto end;
+			}
+			else
+			{
+				extract->spill_pending += data_size;
+			}
+		}
+		/* Do this last, so that on error we don't leave a dangling pointer
+		in the hash table. */
+		if (images_hash_insert(extract, hash, image)) goto end;
+	}
 
 	subpage->images_num += 1;
 	outf("subpage->images_num=%i", subpage->images_num);
@@ -1405,18 +2315,93 @@ int extract_add_image(
 	e = 0;
 end:
 
+	if (fetched && data_free) data_free(data_free_handle, fetched);
 	if (e) {
+		/* This also unlinks <image> from subpage->content. */
 		extract_image_free(extract->alloc, &image);
 	}
 
 	return e;
 }
 
+int extract_add_image(
+		extract_t               *extract,
+		const char              *type,
+		double                   x,
+		double                   y,
+		double                   w,
+		double                   h,
+		void                    *data,
+		size_t                   data_size,
+		extract_image_data_free  data_free,
+		void                    *data_free_handle)
+{
+	if (extract->record && extract_binary_write_image(extract->record, type, x, y, w, h, data, data_size))
+		return -1;
+
+	return add_image(
+			extract,
+			type,
+			x,
+			y,
+			w,
+			h,
+			data,
+			data_size,
+			NULL /*fetch*/,
+			NULL /*fetch_handle*/,
+			data_free,
+			data_free_handle
+			);
+}
+
+int extract_add_image_lazy(
+		extract_t               *extract,
+		const char              *type,
+		double                   x,
+		double                   y,
+		double                   w,
+		double                   h,
+		size_t                   data_size,
+		extract_image_fetch     *fetch,
+		void                    *fetch_handle,
+		extract_image_data_free *data_free,
+		void                    *data_free_handle)
+{
+	if (extract->record)
+	{
+		/* Binary intermediate format always contains the image data. */
+		void *data;
+		int   e;
+
+		if (fetch(fetch_handle, &data)) return -1;
+		e = extract_binary_write_image(extract->record, type, x, y, w, h, data, data_size);
+		if (data_free) data_free(data_free_handle, data);
+		if (e) return -1;
+	}
+
+	return add_image(
+			extract,
+			type,
+			x,
+			y,
+			w,
+			h,
+			NULL /*data*/,
+			data_size,
+			fetch,
+			fetch_handle,
+			data_free,
+			data_free_handle
+			);
+}
+
 
 static int tablelines_append(extract_alloc_t *alloc, tablelines_t *tablelines, rect_t *rect, double color)
 {
-	if (extract_realloc(
+	if (extract_realloc_category(
 			alloc,
+			extract_alloc_category_TABLELINES,
 			&tablelines->tablelines,
 			sizeof(*tablelines->tablelines) * (tablelines->tablelines_num + 1)
 			)) return -1;
@@ -1455,7 +2440,7 @@ static double s_max(double a, double b)
 	return (a > b) ? a : b;
 }
 
-int extract_add_path4(
+static int add_path4(
 		extract_t *extract,
 		double     ctm_a,
 		double     ctm_b,
@@ -1529,7 +2514,7 @@ int extract_add_path4(
 }
 
 
-int extract_add_line(
+static int add_line(
 		extract_t *extract,
 		double     ctm_a,
 		double     ctm_b,
@@ -1582,11 +2567,69 @@ int extract_add_line(
 	return 0;
 }
 
+int extract_add_path4(
+		extract_t *extract,
+		double     ctm_a,
+		double     ctm_b,
+		double     ctm_c,
+		double     ctm_d,
+		double     ctm_e,
+		double     ctm_f,
+		double     x0,
+		double     y0,
+		double     x1,
+		double     y1,
+		double     x2,
+		double     y2,
+		double     x3,
+		double     y3,
+		double     color)
+{
+	if (extract->record && extract_binary_write_doubles(
+			extract->record,
+			extract_binary_PATH4,
+			15,
+			ctm_a, ctm_b, ctm_c, ctm_d, ctm_e, ctm_f,
+			x0, y0, x1, y1, x2, y2, x3, y3,
+			color
+			)) return -1;
+
+	return add_path4(extract, ctm_a, ctm_b, ctm_c, ctm_d, ctm_e, ctm_f, x0, y0, x1, y1, x2, y2, x3, y3, color);
+}
+
+int extract_add_line(
+		extract_t *extract,
+		double     ctm_a,
+		double     ctm_b,
+		double     ctm_c,
+		double     ctm_d,
+		double     ctm_e,
+		double     ctm_f,
+		double     width,
+		double     x0,
+		double     y0,
+		double     x1,
+		double     y1,
+		double     color)
+{
+	if (extract->record && extract_binary_write_doubles(
+			extract->record,
+			extract_binary_LINE,
+			12,
+			ctm_a, ctm_b, ctm_c, ctm_d, ctm_e, ctm_f,
+			width,
+			x0, y0, x1, y1,
+			color
+			)) return -1;
+
+	return add_line(extract, ctm_a, ctm_b, ctm_c, ctm_d, ctm_e, ctm_f, width, x0, y0, x1, y1, color);
+}
+
 int extract_subpage_alloc(extract_alloc_t *alloc, rect_t mediabox, extract_page_t *page, subpage_t **psubpage)
 {
 	subpage_t *subpage;
 
-	if (extract_malloc(alloc, psubpage, sizeof(subpage_t)))
+	if (extract_malloc_category(alloc, extract_alloc_category_CONTENT, psubpage, sizeof(subpage_t)))
 	{
 		return -1;
 	}
@@ -1600,7 +2643,7 @@ int extract_subpage_alloc(extract_alloc_t *alloc, rect_t mediabox, extract_page_
 	subpage->tablelines_vertical.tablelines_num = 0;
 	content_init_root(&subpage->tables, NULL);
 
-	if (extract_realloc2(alloc,
+	if (extract_realloc2_category(alloc, extract_alloc_category_CONTENT,
 			&page->subpages,
 			sizeof(subpage_t*) * page->subpages_num,
 			sizeof(subpage_t*) * (page->subpages_num + 1)))
@@ -1636,7 +2679,10 @@ int extract_page_begin(extract_t *extract, double x0, double y0, double x1, doub
 {
 	extract_page_t *page;
 
-	if (extract_malloc(extract->alloc, &page, sizeof(*page))) return -1;
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_PAGE_BEGIN, 4, x0, y0, x1, y1))
+		return -1;
+
+	if (extract_malloc_category(extract->alloc, extract_alloc_category_CONTENT, &page, sizeof(*page))) return -1;
 	page->mediabox.min.x = x0;
 	page->mediabox.min.y = y0;
 	page->mediabox.max.x = x1;
@@ -1645,8 +2691,9 @@ int extract_page_begin(extract_t *extract, double x0, double y0, double x1, doub
 	page->subpages_num = 0;
 	page->split = NULL;
 
-	if (extract_realloc2(
+	if (extract_realloc2_category(
 			extract->alloc,
+			extract_alloc_category_CONTENT,
 			&extract->document.pages,
 			sizeof(subpage_t*) * extract->document.pages_num,
 			sizeof(subpage_t*) * (extract->document.pages_num + 1)
@@ -1677,6 +2724,14 @@ int extract_fill_begin(
 		double     ctm_f,
 		double     color)
 {
+	if (extract->record && extract_binary_write_doubles(
+			extract->record,
+			extract_binary_FILL_BEGIN,
+			7,
+			ctm_a, ctm_b, ctm_c, ctm_d, ctm_e, ctm_f,
+			color
+			)) return -1;
+
 	assert(extract->path_type == path_type_NONE);
 
 	extract->path_type = path_type_FILL;
@@ -1703,6 +2758,15 @@ int extract_stroke_begin(
 		double     line_width,
 		double     color)
 {
+	if (extract->record && extract_binary_write_doubles(
+			extract->record,
+			extract_binary_STROKE_BEGIN,
+			8,
+			ctm_a, ctm_b, ctm_c, ctm_d, ctm_e, ctm_f,
+			line_width,
+			color
+			)) return -1;
+
 	assert(extract->path_type == path_type_NONE);
 
 	extract->path_type = path_type_STROKE;
@@ -1722,6 +2786,9 @@ int extract_stroke_begin(
 
 int extract_moveto(extract_t *extract, double x, double y)
 {
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_MOVETO, 2, x, y))
+		return -1;
+
 	if (extract->path_type == path_type_FILL)
 	{
 		if (extract->path.fill.n == -1) return 0;
@@ -1757,6 +2824,9 @@ int extract_moveto(extract_t *extract, double x, double y)
 
 int extract_lineto(extract_t *extract, double x, double y)
 {
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_LINETO, 2, x, y))
+		return -1;
+
 	if (extract->path_type == path_type_FILL)
 	{
 		if (extract->path.fill.n == -1)	return 0;
@@ -1775,7 +2845,7 @@ int extract_lineto(extract_t *extract, double x, double y)
 	{
 		if (extract->path.stroke.point_set)
 		{
-			if (extract_add_line(
+			if (add_line(
 					extract,
 					extract->path.stroke.ctm.a,
 					extract->path.stroke.ctm.b,
@@ -1812,6 +2882,9 @@ int extract_lineto(extract_t *extract, double x, double y)
 
 int extract_closepath(extract_t *extract)
 {
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_CLOSEPATH, 0))
+		return -1;
+
 	if (extract->path_type == path_type_FILL)
 	{
 		if (extract->path.fill.n == 4)
@@ -1819,7 +2892,7 @@ int extract_closepath(extract_t *extract)
 			/* We are closing a four-element path, so this could be a thin
 			rectangle that defines a line in a table. */
 			int e;
-			e = extract_add_path4(
+			e = add_path4(
 					extract,
 					extract->path.fill.ctm.a,
 					extract->path.fill.ctm.b,
@@ -1845,7 +2918,7 @@ int extract_closepath(extract_t *extract)
 	{
 		if (extract->path.stroke.point0_set && extract->path.stroke.point_set)
 		{
-			if (extract_add_line(
+			if (add_line(
 					extract,
 					extract->path.stroke.ctm.a,
 					extract->path.stroke.ctm.b,
@@ -1877,6 +2950,9 @@ int extract_closepath(extract_t *extract)
 
 int extract_fill_end(extract_t *extract)
 {
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_FILL_END, 0))
+		return -1;
+
 	assert(extract->path_type == path_type_FILL);
 	extract->path_type = path_type_NONE;
 
@@ -1886,6 +2962,9 @@ int extract_fill_end(extract_t *extract)
 
 int extract_stroke_end(extract_t *extract)
 {
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_STROKE_END, 0))
+		return -1;
+
 	assert(extract->path_type == path_type_STROKE);
 	extract->path_type = path_type_NONE;
 
@@ -1901,11 +2980,32 @@ static int extract_subpage_end(extract_t *extract)
 }
 
 
+static int process(extract_t *extract, int spacing, int rotation, int images, int more);
+
 int extract_page_end(extract_t *extract)
 {
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_PAGE_END, 0))
+		return -1;
+
 	if (extract_subpage_end(extract))
 		return -1;
 
+	if (extract->process_bounded)
+	{
+		if ((extract->process_max_pages && extract->document.pages_num >= extract->process_max_pages)
+				|| (extract->process_max_chars && extract->process_chars >= extract->process_max_chars))
+		{
+			outf("processing %i pages, %zu chars", extract->document.pages_num, extract->process_chars);
+			if (process(
+					extract,
+					extract->process_spacing,
+					extract->process_rotation,
+					extract->process_images,
+					1 /*more*/
+					)) return -1;
+		}
+	}
+
 	return 0;
 }
 
@@ -1914,6 +3014,9 @@ int extract_begin_struct(extract_t *extract, extract_struct_t type, int uid, int
 	document_t  *document = &extract->document;
 	structure_t *structure;
 
+	if (extract->record && extract_binary_write_struct_begin(extract->record, type, uid, score))
+		return -1;
+
 	if (extract_malloc(extract->alloc, &structure, sizeof(*structure)))
 		return -1;
 
@@ -1947,6 +3050,9 @@ int extract_end_struct(extract_t *extract)
 {
 	document_t *document = &extract->document;
 
+	if (extract->record && extract_binary_write_doubles(extract->record, extract_binary_STRUCT_END, 0))
+		return -1;
+
 	assert(document->current != NULL);
 
 	document->current = document->current->parent;
@@ -2096,25 +3202,18 @@ paragraph_to_text(
 		span_t                *span;
 
 		for (span = content_span_iterator_init(&sit, &line->content); span != NULL; span = content_span_iterator_next(&sit))
-		{
-			int c;
-
-			for (c=0; c<span->chars_num; ++c)
-			{
-				/* We encode each character as utf8. */
-				char_t* char_ = &span->chars[c];
-				unsigned cc = char_->ucs;
-				if (extract_astring_catc_unicode(
-						alloc,
-						text,
-						cc,
-						0 /*xml*/,
-						1 /*ascii_ligatures*/,
-						1 /*ascii_dash*/,
-						1 /*ascii_apostrophe*/
-						)) return -1;
-			}
-		}
+		/* We encode each character as utf8. */
+		if (span->chars_num && extract_astring_cat_unicode_array(
+				alloc,
+				text,
+				&span->chars[0].ucs,
+				span->chars_num,
+				sizeof(span->chars[0]),
+				0 /*xml*/,
+				1 /*ascii_ligatures*/,
+				1 /*ascii_dash*/,
+				1 /*ascii_apostrophe*/
+				)) return -1;
 	}
 	if (extract_astring_catc(alloc, text, '\n')) return -1;
 
@@ -2158,7 +3257,7 @@ static int extract_write_tables_csv(extract_t *extract)
 	int                p;
 	char              *path = NULL;
 	FILE              *f = NULL;
-	extract_astring_t  text = {NULL, 0};
+	extract_astring_t  text = {NULL, 0, 0};
 
 	if (!extract->tables_csv_format) return 0;
 
@@ -2228,122 +3327,394 @@ end:
 }
 
 
-int extract_process(
-		extract_t *extract,
-		int        spacing,
-		int        rotation,
-		int        images)
+/* Appends content for <page> in <format> to <content>. */
+static int page_to_content(
+		extract_t         *extract,
+		extract_format_t   format,
+		extract_page_t    *page,
+		int                spacing,
+		int                rotation,
+		int                images,
+		int               *text_box_id,
+		extract_astring_t *content)
 {
-	int e = -1;
-
-	if (extract_realloc2(
-			extract->alloc,
-			&extract->contentss,
-			sizeof(*extract->contentss) * extract->contentss_num,
-			sizeof(*extract->contentss) * (extract->contentss_num + 1)
-			)) goto end;
-	extract_astring_init(&extract->contentss[extract->contentss_num]);
-	extract->contentss_num += 1;
-
-	if (extract_document_join(extract->alloc, &extract->document, extract->layout_analysis, extract->master_space_guess)) goto end;
-
-	switch (extract->format)
+	switch (format)
 	{
 	case extract_format_ODT:
-		if (extract_document_to_odt_content(
+		return extract_page_to_odt_content(
 				extract->alloc,
-				&extract->document,
+				page,
 				spacing,
 				rotation,
 				images,
-				&extract->contentss[extract->contentss_num - 1],
+				content,
 				&extract->odt_styles
-				)) goto end;
-		break;
+				);
 	case extract_format_DOCX:
-		if (extract_document_to_docx_content(
+		return extract_page_to_docx_content(
 				extract->alloc,
-				&extract->document,
+				page,
 				spacing,
 				rotation,
 				images,
-				&extract->contentss[extract->contentss_num - 1]
-				)) goto end;
-		break;
+				text_box_id,
+				content
+				);
 	case extract_format_HTML:
-		if (extract_document_to_html_content(
+		return extract_page_to_html_content(
 				extract->alloc,
-				&extract->document,
+				page,
 				rotation,
 				images,
-				&extract->contentss[extract->contentss_num - 1]
-				)) goto end;
-		break;
+				content
+				);
 	case extract_format_JSON:
-		if (extract_document_to_json_content(
+		return extract_page_to_json_content(
 				extract->alloc,
-				&extract->document,
+				page,
 				rotation,
 				images,
-				&extract->contentss[extract->contentss_num - 1]
-				)) goto end;
-		break;
+				content
+				);
 	case extract_format_TEXT:
 	{
-		int p;
+		int c;
+		for (c=0; c<page->subpages_num; ++c)
+		{
+			subpage_t* subpage = page->subpages[c];
+			if (paragraphs_to_text_content(
+					extract->alloc,
+					&subpage->content,
+					content
+				)) return -1;
+		}
+		return 0;
+	}
+	default:
+		outf0("Invalid format=%i", format);
+		assert(0);
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+/* Implementation of extract_process().
+
+If <more> is true, we leave the content open so that the next call appends to
+it, giving the same output as if all of the pages had been passed to a single
+call. This is used by extract_read_intermediate_process(). */
+static int process(
+		extract_t *extract,
+		int        spacing,
+		int        rotation,
+		int        images,
+		int        more)
+{
+	int                    e = -1;
+	int                    e2;
+	int                    p;
+	int                    o;
+	extract_astring_t     *content;
+	extract_probe_timer_t  timer;
+
+	extract_probe_event(probe_get(extract), "process", 1);
+
+	if (!extract->process_more)
+	{
+		for (o=0; o<extract->outputs_num; ++o)
+		{
+			extract_output_t *output = &extract->outputs[o];
+			if (extract_realloc2_category(
+					extract->alloc,
+					extract_alloc_category_OUTPUT,
+					&output->contentss,
+					sizeof(*output->contentss) * output->contentss_num,
+					sizeof(*output->contentss) * (output->contentss_num + 1)
+					)) goto end;
+			extract_astring_init(&output->contentss[output->contentss_num]);
+			output->contentss_num += 1;
+		}
+		extract->process_text_box_id = 0;
+	}
+
+	/* Joining is independent of output format, so is only done once however
+	many formats we are generating. */
+	extract->probe.page_first = extract->page_index;
+	if (extract_document_join(extract->alloc, probe_get(extract), &extract->document, extract->layout_analysis, extract->master_space_guess)) goto end;
+
+	if (extract->probe.stats)
+	{
 		for (p=0; p<extract->document.pages_num; ++p)
 		{
-			extract_page_t* page = extract->document.pages[p];
-			int c;
+			extract_page_t *page = extract->document.pages[p];
+			int             c;
 			for (c=0; c<page->subpages_num; ++c)
 			{
-				subpage_t* subpage = page->subpages[c];
-				if (paragraphs_to_text_content(
-						extract->alloc,
-						&subpage->content,
-						&extract->contentss[extract->contentss_num - 1]
-					)) goto end;
+				stats_count(extract->probe.stats, &page->subpages[c]->content);
+				stats_count(extract->probe.stats, &page->subpages[c]->tables);
 			}
 		}
-		break;
 	}
-	default:
-		outf0("Invalid format=%i", extract->format);
-		assert(0);
-		errno = EINVAL;
-		return 1;
+
+	for (o=0; o<extract->outputs_num; ++o)
+	{
+		extract_output_t *output = &extract->outputs[o];
+		content = &output->contentss[output->contentss_num - 1];
+		if (output->format == extract_format_HTML && !extract->process_more)
+		{
+			if (extract_html_content_begin(extract->alloc, content)) goto end;
+		}
 	}
+	extract->process_more = more;
+	for (p=0; p<extract->document.pages_num; ++p)
+	{
+		extract->probe.page = extract->page_index;
+		for (o=0; o<extract->outputs_num; ++o)
+		{
+			extract_output_t *output = &extract->outputs[o];
+			size_t            begin;
+			int               separator = 0;
+			content = &output->contentss[output->contentss_num - 1];
+			if (output->format == extract_format_JSON && content->chars_num)
+			{
+				/* Separate this page's json elements from earlier ones. We
+				remove the separator below if the page has no elements, and
+				don't include it in what we pass to page_content_fn(). */
+				if (extract_astring_cat(extract->alloc, content, ",\n")) goto end;
+				separator = 2;
+			}
+			begin = content->chars_num;
+			extract_probe_begin(probe_get(extract), extract_stage_FORMAT, &timer);
+			e2 = page_to_content(extract, output->format, extract->document.pages[p], spacing, rotation, images, &extract->process_text_box_id, content);
+			extract_probe_end(probe_get(extract), extract_stage_FORMAT, &timer);
+			if (e2) goto end;
+			if (separator && content->chars_num == begin)
+			{
+				extract_astring_truncate(content, separator);
+				begin = content->chars_num;
+			}
+			if (o == 0 && extract->page_content_fn)
+			{
+				if (extract->page_content_fn(
+						extract->page_content_handle,
+						extract->page_index,
+						content->chars + begin,
+						content->chars_num - begin
+						))
+				{
+					outf("page_content_fn() failed for page_index=%i", extract->page_index);
+					goto end;
+				}
+			}
+		}
+		extract->page_index += 1;
+	}
+	extract->probe.page = -1;
 
-	if (extract_document_images(extract->alloc, &extract->document, &extract->images)) goto end;
+	extract_probe_begin(probe_get(extract), extract_stage_IMAGES, &timer);
+	e2 = extract_document_images(extract->alloc, &extract->document, &extract->images);
+	extract_probe_end(probe_get(extract), extract_stage_IMAGES, &timer);
+	if (e2) goto end;
 
 	if (extract->tables_csv_format)
 	{
 		extract_write_tables_csv(extract);
 	}
 
+	for (p=0; p<extract->document.pages_num; ++p) {
+		page_free(extract->alloc, &extract->document.pages[p]);
+	}
+	extract_free(extract->alloc, &extract->document.pages);
+	extract->document.pages_num = 0;
+	extract->process_chars = 0;
+
+	if (more)
+	{
+		e = 0;
+		goto end;
+	}
+
+	for (o=0; o<extract->outputs_num; ++o)
+	{
+		extract_output_t *output = &extract->outputs[o];
+		content = &output->contentss[output->contentss_num - 1];
+		if (output->format == extract_format_HTML)
+		{
+			if (extract_html_content_end(extract->alloc, content)) goto end;
+		}
+	}
+
+	if (extract->stream)
 	{
-		int p;
-		for (p=0; p<extract->document.pages_num; ++p) {
-			page_free(extract->alloc, &extract->document.pages[p]);
+		size_t            pos = 0;
+		extract_probe_t  *buffer_probe = probe_buffer_begin(extract, extract->stream, &pos);
+		e2 = stream_content(extract);
+		probe_buffer_end(extract, extract->stream, buffer_probe, pos, 1 /*written*/);
+		if (e2) goto end;
+	}
+	else if (extract->page_content_fn && !extract->page_content_keep)
+	{
+		extract_output_t *output = &extract->outputs[0];
+		extract_astring_free(extract->alloc, &output->contentss[output->contentss_num - 1]);
+		output->contentss_num -= 1;
+	}
+
+	if (extract->spill_dir)
+	{
+		for (o=0; o<extract->outputs_num; ++o)
+		{
+			extract_output_t *output = &extract->outputs[o];
+			if (output->contentss_num > output->contentss_spilled_num)
+			{
+				extract->spill_pending += output->contentss[output->contentss_num - 1].chars_num;
+			}
+		}
+		if (extract->spill_pending > extract->spill_threshold)
+		{
+			if (spill_all(extract)) goto end;
 		}
-		extract_free(extract->alloc, &extract->document.pages);
-		extract->document.pages_num = 0;
 	}
 
 	e = 0;
 end:
 
+	extract_probe_event(probe_get(extract), "process", 0);
+
+	return e;
+}
+
+int extract_process(
+		extract_t *extract,
+		int        spacing,
+		int        rotation,
+		int        images)
+{
+	return process(extract, spacing, rotation, images, 0 /*more*/);
+}
+
+int extract_read_intermediate_process(
+		extract_t        *extract,
+		extract_buffer_t *buffer,
+		int               spacing,
+		int               rotation,
+		int               images,
+		int               max_pages,
+		size_t            max_chars)
+{
+	int e = -1;
+
+	extract->process_bounded = 1;
+	extract->process_spacing = spacing;
+	extract->process_rotation = rotation;
+	extract->process_images = images;
+	extract->process_max_pages = max_pages;
+	extract->process_max_chars = max_chars;
+	extract->process_chars = 0;
+
+	if (extract_read_intermediate(extract, buffer)) goto end;
+	if (process(extract, spacing, rotation, images, 0 /*more*/)) goto end;
+
+	e = 0;
+end:
+
+	extract->process_bounded = 0;
+
 	return e;
 }
 
+/* Returns the output for <format>, or NULL with errno=EINVAL if <format> is
+not one of the formats we are generating. */
+static extract_output_t *output_find(extract_t *extract, extract_format_t format)
+{
+	int o;
+	for (o=0; o<extract->outputs_num; ++o)
+	{
+		if (extract->outputs[o].format == format) return &extract->outputs[o];
+	}
+	outf0("Not generating format=%i", format);
+	errno = EINVAL;
+	return NULL;
+}
+
+int extract_set_formats(extract_t *extract, const extract_format_t *formats, int formats_num)
+{
+	int i;
+
+	if (extract->page_index || extract->outputs[0].contentss_num)
+	{
+		/* Outputs must all see the same extract_process() calls. */
+		outf0("Cannot add formats after extract_process()");
+		errno = EINVAL;
+		return -1;
+	}
+	for (i=0; i<formats_num; ++i)
+	{
+		extract_output_t *output;
+		int               o;
+		if (formats[i] != extract_format_ODT
+				&& formats[i] != extract_format_DOCX
+				&& formats[i] != extract_format_HTML
+				&& formats[i] != extract_format_TEXT
+				&& formats[i] != extract_format_JSON
+				)
+		{
+			outf0("Invalid format=%i", formats[i]);
+			errno = EINVAL;
+			return -1;
+		}
+		for (o=0; o<extract->outputs_num; ++o)
+		{
+			if (extract->outputs[o].format == formats[i]) break;
+		}
+		if (o < extract->outputs_num) continue;
+		if (extract_realloc2(
+				extract->alloc,
+				&extract->outputs,
+				sizeof(*extract->outputs) * extract->outputs_num,
+				sizeof(*extract->outputs) * (extract->outputs_num + 1)
+				)) return -1;
+		output = &extract->outputs[extract->outputs_num];
+		extract_bzero(output, sizeof(*output));
+		output->format = formats[i];
+		extract->outputs_num += 1;
+	}
+	return 0;
+}
+
 int extract_write(extract_t *extract, extract_buffer_t *buffer)
 {
-	int            e = -1;
-	extract_zip_t *zip = NULL;
-	char          *text2 = NULL;
-	int            i;
+	return extract_write_format(extract, extract->format, buffer);
+}
+
+static int write_format(extract_t *extract, extract_format_t format, extract_buffer_t *buffer)
+{
+	int               e = -1;
+	extract_zip_t    *zip = NULL;
+	char             *text2 = NULL;
+	int               i;
+	extract_output_t *output = output_find(extract, format);
 
-	switch (extract->format)
+	if (!output) return -1;
+
+	if (extract->stream && output == &extract->outputs[0])
+	{
+		/* Content has already been written; we just finish things off. */
+		if (stream_start(extract)) goto end;
+		if (extract->format == extract_format_JSON)
+		{
+			if (extract_buffer_cat(extract->stream, "\n]\n}\n")) goto end;
+		}
+		e = 0;
+		goto end;
+	}
+
+	if (format == extract_format_ODT || format == extract_format_DOCX)
+	{
+		/* The content item is generated in memory. */
+		if (contentss_unspill(extract, output)) goto end;
+	}
+
+	switch (format)
 	{
 	case extract_format_ODT:
 	{
@@ -2354,8 +3725,8 @@ int extract_write(extract_t *extract, extract_buffer_t *buffer)
 			outf("i=%i item->name=%s", i, item->name);
 			if (extract_odt_content_item(
 					extract->alloc,
-					extract->contentss,
-					extract->contentss_num,
+					output->contentss,
+					output->contentss_num,
 					&extract->odt_styles,
 					&extract->images,
 					item->name,
@@ -2365,17 +3736,37 @@ int extract_write(extract_t *extract, extract_buffer_t *buffer)
 			{
 				goto end;
 			}
+			if (text2)
+			{
+				if (extract_zip_write_file(zip, text2, strlen(text2), item->name)) goto end;
+			}
+			else if (item->compressed)
+			{
+				if (extract_zip_write_file_precompressed(
+						zip,
+						item->compressed,
+						item->compressed_length,
+						item->text_length,
+						item->crc,
+						item->name
+						)) goto end;
+			}
+			else
 			{
-				const char* text3 = (text2) ? text2 : item->text;
-				if (extract_zip_write_file(zip, text3, strlen(text3), item->name)) goto end;
+				if (extract_zip_write_file(zip, item->text, strlen(item->text), item->name)) goto end;
 			}
 		}
 		outf0("extract->images.images_num=%i", extract->images.images_num);
 		for (i=0; i<extract->images.images_num; ++i) {
-			image_t* image = extract->images.images[i];
+			image_t *image = extract->images.images[i];
+			void    *data;
+			int      e2;
 			extract_free(extract->alloc, &text2);
 			if (extract_asprintf(extract->alloc, &text2, "Pictures/%s", image->name) < 0) goto end;
-			if (extract_zip_write_file(zip, image->data, image->data_size, text2)) goto end;
+			if (extract_image_data_get(extract->alloc, &extract->images, image, &data)) goto end;
+			e2 = extract_zip_write_file_method(zip, data, image->data_size, text2, extract_zip_method_for_type(image->type));
+			extract_image_data_release(extract->alloc, image, data);
+			if (e2) goto end;
 		}
 		if (extract_zip_close(&zip)) goto end;
 		break;
@@ -2389,8 +3780,8 @@ int extract_write(extract_t *extract, extract_buffer_t *buffer)
 			outf("i=%i item->name=%s", i, item->name);
 			if (extract_docx_content_item(
 					extract->alloc,
-					extract->contentss,
-					extract->contentss_num,
+					output->contentss,
+					output->contentss_num,
 					&extract->images,
 					item->name,
 					item->text,
@@ -2400,46 +3791,66 @@ int extract_write(extract_t *extract, extract_buffer_t *buffer)
 				goto end;
 			}
 
+			if (text2)
+			{
+				if (extract_zip_write_file(zip, text2, strlen(text2), item->name)) goto end;
+			}
+			else if (item->compressed)
 			{
-				const char* text3 = (text2) ? text2 : item->text;
-				if (extract_zip_write_file(zip, text3, strlen(text3), item->name)) goto end;
+				if (extract_zip_write_file_precompressed(
+						zip,
+						item->compressed,
+						item->compressed_length,
+						item->text_length,
+						item->crc,
+						item->name
+						)) goto end;
+			}
+			else
+			{
+				if (extract_zip_write_file(zip, item->text, strlen(item->text), item->name)) goto end;
 			}
 		}
 		for (i=0; i<extract->images.images_num; ++i) {
-			image_t* image = extract->images.images[i];
+			image_t *image = extract->images.images[i];
+			void    *data;
+			int      e2;
 			extract_free(extract->alloc, &text2);
 			if (extract_asprintf(extract->alloc, &text2, "word/media/%s", image->name) < 0) goto end;
-			if (extract_zip_write_file(zip, image->data, image->data_size, text2)) goto end;
+			if (extract_image_data_get(extract->alloc, &extract->images, image, &data)) goto end;
+			e2 = extract_zip_write_file_method(zip, data, image->data_size, text2, extract_zip_method_for_type(image->type));
+			extract_image_data_release(extract->alloc, image, data);
+			if (e2) goto end;
 		}
 		if (extract_zip_close(&zip)) goto end;
 		break;
 	}
 	case extract_format_HTML:
 	case extract_format_TEXT:
-		for (i=0; i<extract->contentss_num; ++i)
+		for (i=0; i<output->contentss_num; ++i)
 		{
-			if (extract_buffer_write(buffer, extract->contentss[i].chars, extract->contentss[i].chars_num, NULL)) goto end;
+			if (content_write(extract, output, i, buffer)) goto end;
 		}
 		break;
 	case extract_format_JSON:
 	{
 		int first = 1;
-		if (extract_buffer_cat(buffer, "{\n\"elements\" : "))
+		if (extract_buffer_cat(buffer, "{\n\"elements\" : [\n"))
 			goto end;
-		for (i=0; i<extract->contentss_num; ++i)
+		for (i=0; i<output->contentss_num; ++i)
 		{
 			if (!first && extract_buffer_cat(buffer, ",\n"))
 				goto end;
-			if (extract->contentss[i].chars_num > 0)
+			if (content_size(output, i) > 0)
 				first = 0;
-			if (extract_buffer_write(buffer, extract->contentss[i].chars, extract->contentss[i].chars_num, NULL)) goto end;
+			if (content_write(extract, output, i, buffer)) goto end;
 		}
-		if (extract_buffer_cat(buffer, "\n}\n"))
+		if (extract_buffer_cat(buffer, "\n]\n}\n"))
 			goto end;
 		break;
 	}
 	default:
-		outf0("Invalid format=%i", extract->format);
+		outf0("Invalid format=%i", format);
 		assert(0);
 		errno = EINVAL;
 		return 1;
@@ -2458,20 +3869,37 @@ end:
 	return e;
 }
 
+int extract_write_format(extract_t *extract, extract_format_t format, extract_buffer_t *buffer)
+{
+	size_t            pos = 0;
+	extract_probe_t  *buffer_probe = probe_buffer_begin(extract, buffer, &pos);
+	int               e;
+
+	extract_probe_event(probe_get(extract), "write", 1);
+	e = write_format(extract, format, buffer);
+	extract_probe_event(probe_get(extract), "write", 0);
+	probe_buffer_end(extract, buffer, buffer_probe, pos, 1 /*written*/);
+
+	return e;
+}
+
 int extract_write_content(extract_t *extract, extract_buffer_t *buffer)
 {
-	int i;
+	int               e = 0;
+	int               i;
+	size_t            pos = 0;
+	extract_probe_t  *buffer_probe = probe_buffer_begin(extract, buffer, &pos);
 
-	for (i=0; i<extract->contentss_num; ++i) {
-		if (extract_buffer_write(
-				buffer,
-				extract->contentss[i].chars,
-				extract->contentss[i].chars_num,
-				NULL /*o_actual*/
-				)) return -1;
+	for (i=0; i<extract->outputs[0].contentss_num; ++i) {
+		if (content_write(extract, &extract->outputs[0], i, buffer))
+		{
+			e = -1;
+			break;
+		}
 	}
+	probe_buffer_end(extract, buffer, buffer_probe, pos, 1 /*written*/);
 
-	return 0;
+	return e;
 }
 
 static int string_ends_with(const char *string, const char *end)
@@ -2490,12 +3918,26 @@ int extract_write_template(
 		const char *path_out,
 		int         preserve_dir)
 {
-	if (string_ends_with(path_out, ".odt"))
+	int               odt = string_ends_with(path_out, ".odt");
+	extract_output_t *output = &extract->outputs[0];
+	int               o;
+
+	/* Prefer the output whose format matches <path_out>. */
+	for (o=0; o<extract->outputs_num; ++o)
+	{
+		if (extract->outputs[o].format == (odt ? extract_format_ODT : extract_format_DOCX))
+		{
+			output = &extract->outputs[o];
+			break;
+		}
+	}
+	if (contentss_unspill(extract, output)) return -1;
+	if (odt)
 	{
 		return extract_odt_write_template(
 				extract->alloc,
-				extract->contentss,
-				extract->contentss_num,
+				output->contentss,
+				output->contentss_num,
 				&extract->odt_styles,
 				&extract->images,
 				path_template,
@@ -2506,8 +3948,8 @@ int extract_write_template(
 	{
 		return extract_docx_write_template(
 				extract->alloc,
-				extract->contentss,
-				extract->contentss_num,
+				output->contentss,
+				output->contentss_num,
 				&extract->images,
 				path_template,
 				path_out,
@@ -2524,11 +3966,16 @@ void extract_end(extract_t **pextract)
 	if (!extract) return;
 
 	extract_document_free(extract->alloc, &extract->document);
-	for (i=0; i<extract->contentss_num; ++i) {
-		extract_astring_free(extract->alloc, &extract->contentss[i]);
+	for (i=0; i<extract->outputs_num; ++i) {
+		output_free(extract->alloc, &extract->outputs[i]);
 	}
-	extract_free(extract->alloc, &extract->contentss);
+	extract_free(extract->alloc, &extract->outputs);
 	extract_images_free(extract->alloc, &extract->images);
+	extract_free(extract->alloc, &extract->images_hash);
+	extract_spill_close(&extract->spill);
+	extract_free(extract->alloc, &extract->spill_dir);
+	(void) extract_set_record(extract, NULL);
+	extract_free(extract->alloc, &extract->probe.stats);
 	extract_odt_styles_free(extract->alloc, &extract->odt_styles);
 
 	extract_free(extract->alloc, pextract);
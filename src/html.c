@@ -5,6 +5,9 @@ Caller must call things in a sensible order to create valid content -
 e.g. don't call docx_paragraph_start() twice without intervening call to
 docx_paragraph_finish(). */
 
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_OUTPUT
+
 #include "extract/extract.h"
 
 #include "astring.h"
@@ -81,8 +84,6 @@ paragraph_to_html_content(
 
 		for (span = content_span_iterator_init(&sit, &line->content); span != NULL; span = content_span_iterator_next(&sit))
 		{
-			int c;
-
 			content_state->ctm_prev = &span->ctm;
 			if (span->flags.font_bold != content_state->font.bold)
 			{
@@ -99,11 +100,13 @@ paragraph_to_html_content(
 				content_state->font.italic = span->flags.font_italic;
 			}
 
-			for (c=0; c<span->chars_num; ++c)
-			{
-				char_t* char_ = &span->chars[c];
-				if (extract_astring_catc_unicode_xml(alloc, content, char_->ucs)) goto end;
-			}
+			if (span->chars_num && extract_astring_cat_unicode_array_xml(
+					alloc,
+					content,
+					&span->chars[0].ucs,
+					span->chars_num,
+					sizeof(span->chars[0])
+					)) goto end;
 		}
 
 		if (content->chars_num && lit.next->type != content_root)
@@ -257,7 +260,9 @@ split_to_html(extract_alloc_t *alloc, split_t *split, subpage_t ***ppsubpage, ex
 				}
 				else
 				{
-					extract_astring_catf(alloc, output, "<div style=\"width:%g%%;\">\n", 100.0*split->split[s]->weight/total);
+					extract_astring_cat(alloc, output, "<div style=\"width:");
+					extract_astring_cat_double_g(alloc, output, 100.0*split->split[s]->weight/total);
+					extract_astring_cat(alloc, output, "%;\">\n");
 				}
 			}
 			ret = split_to_html(alloc, split->split[s], ppsubpage, output);
@@ -343,45 +348,58 @@ end:
 	return -1;
 }
 
-int extract_document_to_html_content(
+int extract_html_content_begin(extract_alloc_t *alloc, extract_astring_t *content)
+{
+	if (extract_astring_cat(alloc, content, "<html>\n")) return -1;
+	if (extract_astring_cat(alloc, content, "<body>\n")) return -1;
+	return 0;
+}
+
+int extract_html_content_end(extract_alloc_t *alloc, extract_astring_t *content)
+{
+	if (extract_astring_cat(alloc, content, "</body>\n")) return -1;
+	if (extract_astring_cat(alloc, content, "</html>\n")) return -1;
+	return 0;
+}
+
+int extract_page_to_html_content(
 		extract_alloc_t   *alloc,
-		document_t        *document,
+		extract_page_t    *page,
 		int                rotation,
 		int                images,
 		extract_astring_t *content)
 {
-	int ret = -1;
-	int n;
-	paragraph_t **paragraphs = NULL;
+	subpage_t **psubpage = page->subpages;
 
 	(void) rotation;
 	(void) images;
 
-	extract_astring_cat(alloc, content, "<html>\n");
-	extract_astring_cat(alloc, content, "<body>\n");
+	/* Every page gets its own div. */
+	if (extract_astring_cat(alloc, content, "<div>\n")) return -1;
+	if (split_to_html(alloc, page->split, &psubpage, content)) return -1;
+	if (extract_astring_cat(alloc, content, "</div>\n")) return -1;
 
-	/* Write paragraphs into <content>. */
-	for (n=0; n<document->pages_num; ++n)
-	{
-		extract_page_t  *page     = document->pages[n];
-		subpage_t      **psubpage = page->subpages;
+	return 0;
+}
 
-		/* Every page gets its own div. */
-		extract_astring_cat(alloc, content, "<div>\n");
+int extract_document_to_html_content(
+		extract_alloc_t   *alloc,
+		document_t        *document,
+		int                rotation,
+		int                images,
+		extract_astring_t *content)
+{
+	int n;
 
-		ret = split_to_html(alloc, page->split, &psubpage, content);
-		if (ret)
-			goto end;
+	if (extract_html_content_begin(alloc, content)) return -1;
 
-		extract_astring_cat(alloc, content, "</div>\n");
+	/* Write paragraphs into <content>. */
+	for (n=0; n<document->pages_num; ++n)
+	{
+		if (extract_page_to_html_content(alloc, document->pages[n], rotation, images, content)) return -1;
 	}
-	extract_astring_cat(alloc, content, "</body>\n");
-	extract_astring_cat(alloc, content, "</html>\n");
 
-	ret = 0;
-end:
-
-	extract_free(alloc, &paragraphs);
+	if (extract_html_content_end(alloc, content)) return -1;
 
-	return ret;
+	return 0;
 }
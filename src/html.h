@@ -21,5 +21,23 @@ This string can be passed to extract_docx_content_item() or
 extract_docx_write_template() to be inserted into a docx archive's
 word/document.xml. */
 
+int extract_html_content_begin(extract_alloc_t *alloc, extract_astring_t *content);
+/* Appends the text that extract_document_to_html_content() writes before all
+pages. */
+
+int extract_html_content_end(extract_alloc_t *alloc, extract_astring_t *content);
+/* Appends the text that extract_document_to_html_content() writes after all
+pages. */
+
+int extract_page_to_html_content(
+		extract_alloc_t   *alloc,
+		extract_page_t    *page,
+		int                rotation,
+		int                images,
+		extract_astring_t *content
+		);
+/* Appends html for a single page to <content>, i.e. what
+extract_document_to_html_content() writes for each page. */
+
 
 #endif
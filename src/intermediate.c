@@ -0,0 +1,728 @@
+#include "extract/alloc.h"
+
+#include "intermediate.h"
+#include "mem.h"
+#include "outf.h"
+
+#include "compat_stdint.h"
+
+#include <errno.h>
+#include <stdarg.h>
+#include <string.h>
+
+
+/* Writes encoding of <value> to buffer[], which must have space for 10
+bytes, and returns the number of bytes written. */
+static size_t s_encode_uint(char *buffer, uint64_t value)
+{
+	size_t n = 0;
+
+	for(;;)
+	{
+		unsigned char c = (unsigned char) (value & 0x7f);
+		value >>= 7;
+		if (value) c |= 0x80;
+		buffer[n++] = (char) c;
+		if (!value) break;
+	}
+
+	return n;
+}
+
+/* Appends encoding of <value> to <payload>. */
+static int s_put_uint(extract_alloc_t *alloc, extract_astring_t *payload, uint64_t value)
+{
+	char   buffer[10];
+	size_t n = s_encode_uint(buffer, value);
+
+	return extract_astring_catl(alloc, payload, buffer, n);
+}
+
+static int s_put_int(extract_alloc_t *alloc, extract_astring_t *payload, int value)
+{
+	/* Zig-zag encoding, so small negative values are small. */
+	uint64_t v = (value < 0) ? ((uint64_t) (-(int64_t) value) * 2 - 1) : (uint64_t) value * 2;
+
+	return s_put_uint(alloc, payload, v);
+}
+
+static int s_put_double(extract_alloc_t *alloc, extract_astring_t *payload, double value)
+{
+	char     buffer[8];
+	uint64_t bits;
+	int      i;
+
+	memcpy(&bits, &value, sizeof(bits));
+	for (i=0; i<8; ++i)
+	{
+		buffer[i] = (char) (bits & 0xff);
+		bits >>= 8;
+	}
+
+	return extract_astring_catl(alloc, payload, buffer, sizeof(buffer));
+}
+
+static int s_put_string(extract_alloc_t *alloc, extract_astring_t *payload, const char *text)
+{
+	size_t len = strlen(text);
+
+	if (s_put_uint(alloc, payload, len)) return -1;
+
+	return extract_astring_catl(alloc, payload, text, len);
+}
+
+/* Starts a new record; the payload is accumulated in writer->payload. */
+static void s_record_begin(extract_binary_writer_t *writer)
+{
+	writer->payload.chars_num = 0;
+}
+
+/* Writes record header and writer->payload, followed by <extra_size> bytes
+at <extra>, which are counted as part of the payload. */
+static int s_record_end(
+		extract_binary_writer_t *writer,
+		extract_binary_record_t  type,
+		const void              *extra,
+		size_t                   extra_size)
+{
+	char   header[11];
+	size_t header_size;
+
+	header[0] = (char) type;
+	header_size = 1 + s_encode_uint(header + 1, writer->payload.chars_num + extra_size);
+	if (extract_buffer_write(writer->buffer, header, header_size, NULL)) return -1;
+	if (writer->payload.chars_num
+			&& extract_buffer_write(writer->buffer, writer->payload.chars, writer->payload.chars_num, NULL)
+			) return -1;
+	if (extra_size && extract_buffer_write(writer->buffer, extra, extra_size, NULL)) return -1;
+
+	return 0;
+}
+
+int extract_binary_writer_init(
+		extract_alloc_t         *alloc,
+		extract_buffer_t        *buffer,
+		extract_binary_writer_t *writer)
+{
+	writer->alloc = alloc;
+	writer->buffer = buffer;
+	extract_astring_init(&writer->payload);
+	writer->char_y = 0;
+	writer->char_adv = 0;
+
+	return extract_buffer_write(buffer, extract_binary_magic, extract_binary_magic_size, NULL);
+}
+
+void extract_binary_writer_free(extract_binary_writer_t *writer)
+{
+	extract_astring_free(writer->alloc, &writer->payload);
+}
+
+int extract_binary_write_doubles(
+		extract_binary_writer_t *writer,
+		extract_binary_record_t  type,
+		int                      doubles_num,
+		...)
+{
+	va_list va;
+	int     i;
+	int     e = 0;
+
+	s_record_begin(writer);
+	va_start(va, doubles_num);
+	for (i=0; i<doubles_num; ++i)
+	{
+		double d = va_arg(va, double);
+		if (!e) e = s_put_double(writer->alloc, &writer->payload, d);
+	}
+	va_end(va);
+	if (e) return -1;
+
+	return s_record_end(writer, type, NULL, 0);
+}
+
+int extract_binary_write_span_begin(
+		extract_binary_writer_t *writer,
+		const char              *font_name,
+		int                      font_bold,
+		int                      font_italic,
+		int                      wmode,
+		double                   ctm_a,
+		double                   ctm_b,
+		double                   ctm_c,
+		double                   ctm_d,
+		double                   bbox_x0,
+		double                   bbox_y0,
+		double                   bbox_x1,
+		double                   bbox_y1)
+{
+	extract_alloc_t   *alloc = writer->alloc;
+	extract_astring_t *payload = &writer->payload;
+
+	s_record_begin(writer);
+	if (s_put_string(alloc, payload, font_name)) return -1;
+	if (s_put_uint(alloc, payload, (unsigned) font_bold)) return -1;
+	if (s_put_uint(alloc, payload, (unsigned) font_italic)) return -1;
+	if (s_put_uint(alloc, payload, (unsigned) wmode)) return -1;
+	if (s_put_double(alloc, payload, ctm_a)) return -1;
+	if (s_put_double(alloc, payload, ctm_b)) return -1;
+	if (s_put_double(alloc, payload, ctm_c)) return -1;
+	if (s_put_double(alloc, payload, ctm_d)) return -1;
+	if (s_put_double(alloc, payload, bbox_x0)) return -1;
+	if (s_put_double(alloc, payload, bbox_y0)) return -1;
+	if (s_put_double(alloc, payload, bbox_x1)) return -1;
+	if (s_put_double(alloc, payload, bbox_y1)) return -1;
+
+	return s_record_end(writer, extract_binary_SPAN_BEGIN, NULL, 0);
+}
+
+int extract_binary_write_char(
+		extract_binary_writer_t *writer,
+		double                   x,
+		double                   y,
+		unsigned                 ucs,
+		double                   adv,
+		double                   x0,
+		double                   y0,
+		double                   x1,
+		double                   y1)
+{
+	extract_alloc_t   *alloc = writer->alloc;
+	extract_astring_t *payload = &writer->payload;
+	unsigned           flags = 0;
+
+	if (y == writer->char_y)        flags |= extract_binary_CHAR_SAME_Y;
+	if (adv == writer->char_adv)    flags |= extract_binary_CHAR_SAME_ADV;
+	if (x0 == x && y0 == y && x1 == x + adv && y1 == y + adv)
+		flags |= extract_binary_CHAR_BBOX_ADV;
+	writer->char_y = y;
+	writer->char_adv = adv;
+
+	s_record_begin(writer);
+	if (s_put_uint(alloc, payload, flags)) return -1;
+	if (s_put_double(alloc, payload, x)) return -1;
+	if (!(flags & extract_binary_CHAR_SAME_Y))
+	{
+		if (s_put_double(alloc, payload, y)) return -1;
+	}
+	if (!(flags & extract_binary_CHAR_SAME_ADV))
+	{
+		if (s_put_double(alloc, payload, adv)) return -1;
+	}
+	if (s_put_uint(alloc, payload, ucs)) return -1;
+	if (!(flags & extract_binary_CHAR_BBOX_ADV))
+	{
+		if (s_put_double(alloc, payload, x0)) return -1;
+		if (s_put_double(alloc, payload, y0)) return -1;
+		if (s_put_double(alloc, payload, x1)) return -1;
+		if (s_put_double(alloc, payload, y1)) return -1;
+	}
+
+	return s_record_end(writer, extract_binary_CHAR, NULL, 0);
+}
+
+int extract_binary_write_image(
+		extract_binary_writer_t *writer,
+		const char              *type,
+		double                   x,
+		double                   y,
+		double                   w,
+		double                   h,
+		const void              *data,
+		size_t                   data_size)
+{
+	extract_alloc_t   *alloc = writer->alloc;
+	extract_astring_t *payload = &writer->payload;
+
+	s_record_begin(writer);
+	if (s_put_string(alloc, payload, type)) return -1;
+	if (s_put_double(alloc, payload, x)) return -1;
+	if (s_put_double(alloc, payload, y)) return -1;
+	if (s_put_double(alloc, payload, w)) return -1;
+	if (s_put_double(alloc, payload, h)) return -1;
+	if (s_put_uint(alloc, payload, data_size)) return -1;
+
+	/* Image data is written directly rather than copied into payload. */
+	return s_record_end(writer, extract_binary_IMAGE, data, data_size);
+}
+
+int extract_binary_write_struct_begin(
+		extract_binary_writer_t *writer,
+		int                      type,
+		int                      uid,
+		int                      score)
+{
+	s_record_begin(writer);
+	if (s_put_int(writer->alloc, &writer->payload, type)) return -1;
+	if (s_put_int(writer->alloc, &writer->payload, uid)) return -1;
+	if (s_put_int(writer->alloc, &writer->payload, score)) return -1;
+
+	return s_record_end(writer, extract_binary_STRUCT_BEGIN, NULL, 0);
+}
+
+
+/* Reading. */
+
+/* Position within a record's payload. */
+typedef struct
+{
+	const unsigned char *pos;
+	const unsigned char *end;
+} s_payload_t;
+
+static int s_get_uint(s_payload_t *payload, uint64_t *o_value)
+{
+	uint64_t value = 0;
+	int      shift = 0;
+
+	for(;;)
+	{
+		unsigned char c;
+		if (payload->pos == payload->end || shift > 63)
+		{
+			errno = EINVAL;
+			return -1;
+		}
+		c = *payload->pos;
+		payload->pos += 1;
+		value |= (uint64_t) (c & 0x7f) << shift;
+		shift += 7;
+		if (!(c & 0x80)) break;
+	}
+	*o_value = value;
+
+	return 0;
+}
+
+static int s_get_int(s_payload_t *payload, int *o_value)
+{
+	uint64_t v;
+
+	if (s_get_uint(payload, &v)) return -1;
+	*o_value = (v & 1) ? (int) -(int64_t) ((v + 1) / 2) : (int) (v / 2);
+
+	return 0;
+}
+
+static int s_get_double(s_payload_t *payload, double *o_value)
+{
+	uint64_t bits = 0;
+	int      i;
+
+	if (payload->end - payload->pos < 8)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	for (i=7; i>=0; --i)
+	{
+		bits = (bits << 8) | payload->pos[i];
+	}
+	payload->pos += 8;
+	memcpy(o_value, &bits, sizeof(*o_value));
+
+	return 0;
+}
+
+/* Reads <n> doubles into values[]. */
+static int s_get_doubles(s_payload_t *payload, double *values, int n)
+{
+	int i;
+
+	for (i=0; i<n; ++i)
+	{
+		if (s_get_double(payload, &values[i])) return -1;
+	}
+
+	return 0;
+}
+
+/* Sets *o_data to point to next <size> bytes in payload. */
+static int s_get_bytes(s_payload_t *payload, size_t size, const void **o_data)
+{
+	if ((size_t) (payload->end - payload->pos) < size)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	*o_data = payload->pos;
+	payload->pos += size;
+
+	return 0;
+}
+
+/* Reads string into <string>, so that it is zero-terminated. */
+static int s_get_string(extract_alloc_t *alloc, s_payload_t *payload, extract_astring_t *string)
+{
+	uint64_t    len;
+	const void *data;
+
+	if (s_get_uint(payload, &len)) return -1;
+	if (s_get_bytes(payload, (size_t) len, &data)) return -1;
+	string->chars_num = 0;
+
+	return extract_astring_catl(alloc, string, data, (size_t) len);
+}
+
+/* Reads uint encoding from <buffer>. Returns +1 if EOF before first byte. */
+static int s_read_uint(extract_buffer_t *buffer, uint64_t *o_value)
+{
+	uint64_t value = 0;
+	int      shift = 0;
+
+	for(;;)
+	{
+		unsigned char c;
+		int           e = extract_buffer_read(buffer, &c, 1, NULL);
+		if (e)
+		{
+			if (e == 1 && shift)
+			{
+				errno = EINVAL;
+				return -1;
+			}
+			return e;
+		}
+		if (shift > 63)
+		{
+			errno = EINVAL;
+			return -1;
+		}
+		value |= (uint64_t) (c & 0x7f) << shift;
+		shift += 7;
+		if (!(c & 0x80)) break;
+	}
+	*o_value = value;
+
+	return 0;
+}
+
+static void s_image_free(void *handle, void *data)
+{
+	extract_free((extract_alloc_t *) handle, &data);
+}
+
+/* Which records we have started but not yet ended, so that we can reject
+records that are out of order instead of passing them on to extract_add_char()
+etc. */
+typedef struct
+{
+	int in_page;
+	int in_span;    /* Whether CHAR records are allowed. */
+	int path;       /* 0, extract_binary_FILL_BEGIN or extract_binary_STROKE_BEGIN. */
+	int structs;    /* Number of unended STRUCT_BEGIN records. */
+} s_state_t;
+
+/* Updates <state> for record <type>. Returns -1 with errno=EINVAL if <type>
+is not valid in <state>. */
+static int s_state_update(s_state_t *state, unsigned char type)
+{
+	int ok = 1;
+
+	switch (type)
+	{
+	case extract_binary_PAGE_BEGIN:
+		ok = !state->in_page;
+		state->in_page = 1;
+		break;
+
+	case extract_binary_PAGE_END:
+		ok = state->in_page && !state->path;
+		state->in_page = 0;
+		state->in_span = 0;
+		break;
+
+	case extract_binary_SPAN_BEGIN:
+		/* SPAN_END is optional; a span also ends at the next SPAN_BEGIN or
+		PAGE_END. */
+		ok = state->in_page && !state->path;
+		state->in_span = 1;
+		break;
+
+	case extract_binary_SPAN_END:
+		ok = state->in_span;
+		state->in_span = 0;
+		break;
+
+	case extract_binary_CHAR:
+		ok = state->in_span;
+		break;
+
+	case extract_binary_IMAGE:
+	case extract_binary_PATH4:
+	case extract_binary_LINE:
+		ok = state->in_page && !state->path;
+		break;
+
+	case extract_binary_FILL_BEGIN:
+	case extract_binary_STROKE_BEGIN:
+		ok = state->in_page && !state->path;
+		state->path = type;
+		break;
+
+	case extract_binary_MOVETO:
+	case extract_binary_LINETO:
+	case extract_binary_CLOSEPATH:
+		ok = state->path != 0;
+		break;
+
+	case extract_binary_FILL_END:
+		ok = state->path == extract_binary_FILL_BEGIN;
+		state->path = 0;
+		break;
+
+	case extract_binary_STROKE_END:
+		ok = state->path == extract_binary_STROKE_BEGIN;
+		state->path = 0;
+		break;
+
+	case extract_binary_STRUCT_BEGIN:
+		state->structs += 1;
+		break;
+
+	case extract_binary_STRUCT_END:
+		ok = state->structs > 0;
+		state->structs -= 1;
+		break;
+	}
+
+	if (!ok)
+	{
+		outf0("Binary intermediate record type=%i is out of order", type);
+		errno = EINVAL;
+		return -1;
+	}
+
+	return 0;
+}
+
+int extract_binary_read(extract_t *extract, extract_alloc_t *alloc, extract_buffer_t *buffer)
+{
+	int                ret = -1;
+	char              *record = NULL;
+	size_t             record_max = 0;
+	extract_astring_t  string;
+	char              *image_data = NULL;
+	double             char_y = 0;
+	double             char_adv = 0;
+	s_state_t          state = {0};
+
+	extract_astring_init(&string);
+
+	for(;;)
+	{
+		unsigned char type;
+		uint64_t      size;
+		s_payload_t   payload;
+		double        d[15];
+		int           e = extract_buffer_read(buffer, &type, 1, NULL);
+
+		if (e == 1)
+		{
+			/* EOF. */
+			if (state.in_page)
+			{
+				outf0("Binary intermediate data ends within a page");
+				errno = EINVAL;
+				goto end;
+			}
+			break;
+		}
+		if (e) goto end;
+		if (s_state_update(&state, type)) goto end;
+		if (s_read_uint(buffer, &size))
+		{
+			outf0("Failed to read size of binary intermediate record");
+			errno = EINVAL;
+			goto end;
+		}
+		if (size > record_max)
+		{
+			if (extract_realloc(alloc, &record, (size_t) size)) goto end;
+			record_max = (size_t) size;
+		}
+		if (size && extract_buffer_read(buffer, record, (size_t) size, NULL))
+		{
+			outf0("Short binary intermediate record");
+			errno = EINVAL;
+			goto end;
+		}
+		payload.pos = (unsigned char *) record;
+		payload.end = payload.pos + size;
+
+		switch (type)
+		{
+		case extract_binary_PAGE_BEGIN:
+			if (s_get_doubles(&payload, d, 4)) goto end;
+			if (extract_page_begin(extract, d[0], d[1], d[2], d[3])) goto end;
+			break;
+
+		case extract_binary_PAGE_END:
+			if (extract_page_end(extract)) goto end;
+			break;
+
+		case extract_binary_SPAN_BEGIN:
+		{
+			uint64_t font_bold;
+			uint64_t font_italic;
+			uint64_t wmode;
+			if (s_get_string(alloc, &payload, &string)) goto end;
+			if (s_get_uint(&payload, &font_bold)) goto end;
+			if (s_get_uint(&payload, &font_italic)) goto end;
+			if (s_get_uint(&payload, &wmode)) goto end;
+			if (s_get_doubles(&payload, d, 8)) goto end;
+			if (extract_span_begin(
+					extract,
+					string.chars,
+					(int) font_bold,
+					(int) font_italic,
+					(int) wmode,
+					d[0], d[1], d[2], d[3],
+					d[4], d[5], d[6], d[7]
+					)) goto end;
+			break;
+		}
+
+		case extract_binary_SPAN_END:
+			if (extract_span_end(extract)) goto end;
+			break;
+
+		case extract_binary_CHAR:
+		{
+			uint64_t flags;
+			uint64_t ucs;
+			double   x;
+			if (s_get_uint(&payload, &flags)) goto end;
+			if (s_get_double(&payload, &x)) goto end;
+			if (!(flags & extract_binary_CHAR_SAME_Y))
+			{
+				if (s_get_double(&payload, &char_y)) goto end;
+			}
+			if (!(flags & extract_binary_CHAR_SAME_ADV))
+			{
+				if (s_get_double(&payload, &char_adv)) goto end;
+			}
+			if (s_get_uint(&payload, &ucs)) goto end;
+			if (flags & extract_binary_CHAR_BBOX_ADV)
+			{
+				d[0] = x;
+				d[1] = char_y;
+				d[2] = x + char_adv;
+				d[3] = char_y + char_adv;
+			}
+			else
+			{
+				if (s_get_doubles(&payload, d, 4)) goto end;
+			}
+			if (extract_add_char(extract, x, char_y, (unsigned) ucs, char_adv, d[0], d[1], d[2], d[3])) goto end;
+			break;
+		}
+
+		case extract_binary_IMAGE:
+		{
+			uint64_t    data_size;
+			const void *data;
+			if (s_get_string(alloc, &payload, &string)) goto end;
+			if (s_get_doubles(&payload, d, 4)) goto end;
+			if (s_get_uint(&payload, &data_size)) goto end;
+			if (s_get_bytes(&payload, (size_t) data_size, &data)) goto end;
+			if (extract_malloc_category(alloc, extract_alloc_category_IMAGES, &image_data, (size_t) data_size)) goto end;
+			memcpy(image_data, data, (size_t) data_size);
+			if (extract_add_image(
+					extract,
+					string.chars,
+					d[0], d[1], d[2], d[3],
+					image_data,
+					(size_t) data_size,
+					s_image_free,
+					alloc
+					)) goto end;
+			image_data = NULL;
+			break;
+		}
+
+		case extract_binary_PATH4:
+			if (s_get_doubles(&payload, d, 15)) goto end;
+			if (extract_add_path4(
+					extract,
+					d[0], d[1], d[2], d[3], d[4], d[5],
+					d[6], d[7], d[8], d[9], d[10], d[11], d[12], d[13],
+					d[14]
+					)) goto end;
+			break;
+
+		case extract_binary_LINE:
+			if (s_get_doubles(&payload, d, 12)) goto end;
+			if (extract_add_line(
+					extract,
+					d[0], d[1], d[2], d[3], d[4], d[5],
+					d[6],
+					d[7], d[8], d[9], d[10],
+					d[11]
+					)) goto end;
+			break;
+
+		case extract_binary_FILL_BEGIN:
+			if (s_get_doubles(&payload, d, 7)) goto end;
+			if (extract_fill_begin(extract, d[0], d[1], d[2], d[3], d[4], d[5], d[6])) goto end;
+			break;
+
+		case extract_binary_STROKE_BEGIN:
+			if (s_get_doubles(&payload, d, 8)) goto end;
+			if (extract_stroke_begin(extract, d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7])) goto end;
+			break;
+
+		case extract_binary_MOVETO:
+			if (s_get_doubles(&payload, d, 2)) goto end;
+			if (extract_moveto(extract, d[0], d[1])) goto end;
+			break;
+
+		case extract_binary_LINETO:
+			if (s_get_doubles(&payload, d, 2)) goto end;
+			if (extract_lineto(extract, d[0], d[1])) goto end;
+			break;
+
+		case extract_binary_CLOSEPATH:
+			if (extract_closepath(extract)) goto end;
+			break;
+
+		case extract_binary_FILL_END:
+			if (extract_fill_end(extract)) goto end;
+			break;
+
+		case extract_binary_STROKE_END:
+			if (extract_stroke_end(extract)) goto end;
+			break;
+
+		case extract_binary_STRUCT_BEGIN:
+		{
+			int struct_type;
+			int uid;
+			int score;
+			if (s_get_int(&payload, &struct_type)) goto end;
+			if (s_get_int(&payload, &uid)) goto end;
+			if (s_get_int(&payload, &score)) goto end;
+			if (extract_begin_struct(extract, (extract_struct_t) struct_type, uid, score)) goto end;
+			break;
+		}
+
+		case extract_binary_STRUCT_END:
+			if (extract_end_struct(extract)) goto end;
+			break;
+
+		default:
+			outf("Ignoring binary intermediate record type=%i", type);
+			break;
+		}
+	}
+
+	ret = 0;
+end:
+
+	if (ret) outf0("Failed to read binary intermediate data: %s", strerror(errno));
+	extract_free(alloc, &record);
+	extract_free(alloc, &image_data);
+	extract_astring_free(alloc, &string);
+
+	return ret;
+}
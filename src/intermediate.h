@@ -0,0 +1,174 @@
+#ifndef ARTIFEX_EXTRACT_INTERMEDIATE
+#define ARTIFEX_EXTRACT_INTERMEDIATE
+
+/* Only for internal use by extract code.  */
+
+#include "extract/extract.h"
+#include "extract/buffer.h"
+
+#include "astring.h"
+
+
+/*
+	Binary intermediate format.
+
+	This is a compact alternative to the XML intermediate format that records
+	the calls made to extract_page_begin(), extract_span_begin(),
+	extract_add_char() etc, so that they can be replayed without parsing text.
+
+	Data starts with the 8 bytes in extract_binary_magic, followed by a
+	sequence of records. Each record is:
+
+		type        1 byte, one of extract_binary_record_t.
+		size        uint, the number of bytes in payload.
+		payload     <size> bytes.
+
+	Within payloads, values are encoded as:
+
+		uint        Unsigned LEB128, i.e. 7 bits per byte, least significant
+					first, with top bit set on all but the last byte.
+		int         Zig-zag encoded then written as uint.
+		double      8 bytes, IEEE-754, little-endian.
+		string      uint length followed by that number of bytes.
+
+	Readers ignore any data at the end of a payload and skip records of
+	unknown type, so later versions can add fields and record types.
+
+	Records and their payloads are:
+
+		PAGE_BEGIN      double minx miny maxx maxy
+		PAGE_END
+		SPAN_BEGIN      string font_name; uint font_bold font_italic wmode;
+						double ctm_a ctm_b ctm_c ctm_d bbox_x0 bbox_y0 bbox_x1
+						bbox_y1
+		SPAN_END
+		CHAR            uint flags; double x; double y unless flags has
+						CHAR_SAME_Y; double adv unless flags has CHAR_SAME_ADV;
+						uint ucs; double minx miny maxx maxy unless flags has
+						CHAR_BBOX_ADV.
+		IMAGE           string type; double x y w h; uint data_size; data.
+		PATH4           double ctm_a..ctm_f x0 y0 x1 y1 x2 y2 x3 y3 color
+		LINE            double ctm_a..ctm_f width x0 y0 x1 y1 color
+		FILL_BEGIN      double ctm_a..ctm_f color
+		STROKE_BEGIN    double ctm_a..ctm_f line_width color
+		MOVETO          double x y
+		LINETO          double x y
+		CLOSEPATH
+		FILL_END
+		STROKE_END
+		STRUCT_BEGIN    int type uid score
+		STRUCT_END
+
+	CHAR_SAME_Y and CHAR_SAME_ADV refer to the previous CHAR record;
+	CHAR_BBOX_ADV means that the glyph bbox is (x, y, x+adv, y+adv).
+*/
+
+#define extract_binary_magic "extractB"
+#define extract_binary_magic_size 8
+
+typedef enum
+{
+	extract_binary_PAGE_BEGIN = 1,
+	extract_binary_PAGE_END,
+	extract_binary_SPAN_BEGIN,
+	extract_binary_SPAN_END,
+	extract_binary_CHAR,
+	extract_binary_IMAGE,
+	extract_binary_PATH4,
+	extract_binary_LINE,
+	extract_binary_FILL_BEGIN,
+	extract_binary_STROKE_BEGIN,
+	extract_binary_MOVETO,
+	extract_binary_LINETO,
+	extract_binary_CLOSEPATH,
+	extract_binary_FILL_END,
+	extract_binary_STROKE_END,
+	extract_binary_STRUCT_BEGIN,
+	extract_binary_STRUCT_END
+} extract_binary_record_t;
+
+/* Flags in CHAR records. */
+#define extract_binary_CHAR_SAME_Y      1
+#define extract_binary_CHAR_SAME_ADV    2
+#define extract_binary_CHAR_BBOX_ADV    4
+
+
+/* State for writing binary intermediate data. */
+typedef struct
+{
+	extract_alloc_t   *alloc;
+	extract_buffer_t  *buffer;
+	extract_astring_t  payload;
+	double             char_y;
+	double             char_adv;
+} extract_binary_writer_t;
+
+/* Initialises <writer> and writes extract_binary_magic to <buffer>. */
+int extract_binary_writer_init(
+		extract_alloc_t         *alloc,
+		extract_buffer_t        *buffer,
+		extract_binary_writer_t *writer);
+
+/* Frees internal data. Does not close writer->buffer. */
+void extract_binary_writer_free(extract_binary_writer_t *writer);
+
+/* Writes a record whose payload is <doubles_num> doubles, passed as varargs,
+e.g. for PAGE_BEGIN or PATH4. */
+int extract_binary_write_doubles(
+		extract_binary_writer_t *writer,
+		extract_binary_record_t  type,
+		int                      doubles_num,
+		...);
+
+int extract_binary_write_span_begin(
+		extract_binary_writer_t *writer,
+		const char              *font_name,
+		int                      font_bold,
+		int                      font_italic,
+		int                      wmode,
+		double                   ctm_a,
+		double                   ctm_b,
+		double                   ctm_c,
+		double                   ctm_d,
+		double                   bbox_x0,
+		double                   bbox_y0,
+		double                   bbox_x1,
+		double                   bbox_y1);
+
+int extract_binary_write_char(
+		extract_binary_writer_t *writer,
+		double                   x,
+		double                   y,
+		unsigned                 ucs,
+		double                   adv,
+		double                   x0,
+		double                   y0,
+		double                   x1,
+		double                   y1);
+
+int extract_binary_write_image(
+		extract_binary_writer_t *writer,
+		const char              *type,
+		double                   x,
+		double                   y,
+		double                   w,
+		double                   h,
+		const void              *data,
+		size_t                   data_size);
+
+int extract_binary_write_struct_begin(
+		extract_binary_writer_t *writer,
+		int                      type,
+		int                      uid,
+		int                      score);
+
+
+/* Reads binary intermediate records from <buffer>, which must be positioned
+just after extract_binary_magic, and makes corresponding calls to
+extract_page_begin() etc. <alloc> should be the allocator used by <extract>.
+
+Returns -1 with errno=EINVAL if records are out of order, e.g. CHAR without a
+preceding SPAN_BEGIN in the same page, or if data ends within a page. */
+int extract_binary_read(extract_t *extract, extract_alloc_t *alloc, extract_buffer_t *buffer);
+
+#endif
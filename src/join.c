@@ -1,3 +1,6 @@
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_CONTENT
+
 #include "extract/extract.h"
 #include "extract/alloc.h"
 
@@ -5,6 +8,7 @@
 #include "document.h"
 #include "mem.h"
 #include "outf.h"
+#include "stats.h"
 
 #include <assert.h>
 #include <float.h>
@@ -998,19 +1002,41 @@ spans_within_rect(
 static int
 join_content(
 	extract_alloc_t *alloc,
+	extract_probe_t *probe,
 	content_root_t  *lines,
 	double master_space_guess)
 {
-	if (make_lines(alloc, lines, master_space_guess))
-		return -1;
-	if (make_paragraphs(alloc, lines))
-		return -1;
-	if (analyse_paragraphs(lines))
-		return -1;
-	if (spot_rotated_blocks(alloc, lines))
-		return -1;
+	int                   e = -1;
+	extract_stage_t       stage;
+	extract_probe_timer_t timer;
+
+	/* If we fail, <stage> is the stage whose extract_probe_end() is pending. */
+	stage = extract_stage_MAKE_LINES;
+	extract_probe_begin(probe, stage, &timer);
+	if (make_lines(alloc, lines, master_space_guess)) goto end;
+	extract_probe_end(probe, stage, &timer);
+
+	stage = extract_stage_MAKE_PARAGRAPHS;
+	extract_probe_begin(probe, stage, &timer);
+	if (make_paragraphs(alloc, lines)) goto end;
+	extract_probe_end(probe, stage, &timer);
+
+	stage = extract_stage_ANALYSE_PARAGRAPHS;
+	extract_probe_begin(probe, stage, &timer);
+	if (analyse_paragraphs(lines)) goto end;
+	extract_probe_end(probe, stage, &timer);
+
+	stage = extract_stage_ROTATED_BLOCKS;
+	extract_probe_begin(probe, stage, &timer);
+	if (spot_rotated_blocks(alloc, lines)) goto end;
+	extract_probe_end(probe, stage, &timer);
 
-	return 0;
+	e = 0;
+end:
+
+	if (e) extract_probe_end(probe, stage, &timer);
+
+	return e;
 }
 
 
@@ -1058,7 +1084,7 @@ table_find_y_range(
 	{
 		if (all->tablelines[i].rect.min.y >= y_min && all->tablelines[i].rect.min.y < y_max)
 		{
-			if (extract_realloc(alloc, &out->tablelines, sizeof(*out->tablelines) * (out->tablelines_num + 1))) return -1;
+			if (extract_realloc_category(alloc, extract_alloc_category_TABLELINES, &out->tablelines, sizeof(*out->tablelines) * (out->tablelines_num + 1))) return -1;
 			out->tablelines[out->tablelines_num] = all->tablelines[i];
 			out->tablelines_num += 1;
 		}
@@ -1198,6 +1224,7 @@ remove any found text from the page. */
 static int
 table_find_cells_text(
 		extract_alloc_t  *alloc,
+		extract_probe_t  *probe,
 		subpage_t        *subpage,
 		cell_t          **cells,
 		int               cells_num_x,
@@ -1218,7 +1245,7 @@ table_find_cells_text(
 
 		if (spans_within_rect(alloc, &subpage->content, &cell->rect, &cell->content))
 			return -1;
-		if (join_content(alloc, &cell->content, master_space_guess))
+		if (join_content(alloc, probe, &cell->content, master_space_guess))
 			return -1;
 	}
 
@@ -1265,12 +1292,14 @@ end:
 /* Finds single table made from lines whose y coordinates are in the range
 y_min..y_max. */
 static int
-table_find(extract_alloc_t *alloc, subpage_t *subpage, double y_min, double y_max, double master_space_guess)
+table_find(extract_alloc_t *alloc, extract_probe_t *probe, subpage_t *subpage, double y_min, double y_max, double master_space_guess)
 {
 	tablelines_t *all_h = &subpage->tablelines_horizontal;
 	tablelines_t *all_v = &subpage->tablelines_vertical;
 	int e = -1;
 	int i;
+	extract_probe_timer_t timer;
+	int filling = 0;
 
 	/* Find subset of vertical and horizontal lines that are within range
 	y_min..y_max, and sort by y coordinate. */
@@ -1290,7 +1319,9 @@ table_find(extract_alloc_t *alloc, subpage_t *subpage, double y_min, double y_ma
 	/* Suppress false coverity warning - qsort() does not dereference null
 	pointer if nmemb is zero. */
 	/* coverity[var_deref_model] */
+	extract_probe_begin(probe, extract_stage_TABLE_SORT, &timer);
 	qsort(tl_v.tablelines, tl_v.tablelines_num, sizeof(*tl_v.tablelines), tablelines_compare_x);
+	extract_probe_end(probe, extract_stage_TABLE_SORT, &timer);
 
 	if (0)
 	{
@@ -1447,11 +1478,15 @@ table_find(extract_alloc_t *alloc, subpage_t *subpage, double y_min, double y_ma
 
 	if (table_find_extend(cells, cells_num_x, cells_num_y)) goto end;
 
-	if (table_find_cells_text(alloc, subpage, cells, cells_num_x, cells_num_y, master_space_guess)) goto end;
+	extract_probe_begin(probe, extract_stage_TABLE_FILL, &timer);
+	filling = 1;
+	if (table_find_cells_text(alloc, probe, subpage, cells, cells_num_x, cells_num_y, master_space_guess)) goto end;
 
 	e = 0;
 end:
 
+	if (filling) extract_probe_end(probe, extract_stage_TABLE_FILL, &timer);
+
 	extract_free(alloc, &tl_h.tablelines);
 	extract_free(alloc, &tl_v.tablelines);
 	if (e)
@@ -1474,6 +1509,7 @@ Any text found inside tables is removed from page->spans[].
 */
 static int extract_subpage_tables_find_lines(
 		extract_alloc_t *alloc,
+		extract_probe_t *probe,
 		subpage_t       *subpage,
 		double           master_space_guess)
 {
@@ -1482,10 +1518,12 @@ static int extract_subpage_tables_find_lines(
 	double margin = 1;
 	int iv;
 	int ih;
+	extract_probe_timer_t timer;
 	outf("page->tablelines_horizontal.tablelines_num=%i", subpage->tablelines_horizontal.tablelines_num);
 	outf("page->tablelines_vertical.tablelines_num=%i", subpage->tablelines_vertical.tablelines_num);
 
 	/* Sort all lines by y coordinate. */
+	extract_probe_begin(probe, extract_stage_TABLE_SORT, &timer);
 	qsort(subpage->tablelines_horizontal.tablelines,
 		  subpage->tablelines_horizontal.tablelines_num,
 		  sizeof(*subpage->tablelines_horizontal.tablelines),
@@ -1494,6 +1532,7 @@ static int extract_subpage_tables_find_lines(
 		  subpage->tablelines_vertical.tablelines_num,
 		  sizeof(*subpage->tablelines_vertical.tablelines),
 		  tablelines_compare_y);
+	extract_probe_end(probe, extract_stage_TABLE_SORT, &timer);
 
 	if (0)
 	{
@@ -1563,7 +1602,7 @@ static int extract_subpage_tables_find_lines(
 			{
 				outf("New table. maxy=%f miny=%f", maxy, miny);
 				/* Find table. */
-				table_find(alloc, subpage, miny - margin, maxy + margin, master_space_guess);
+				table_find(alloc, probe, subpage, miny - margin, maxy + margin, master_space_guess);
 			}
 			miny = tl->rect.min.y;
 		}
@@ -1571,7 +1610,7 @@ static int extract_subpage_tables_find_lines(
 	}
 
 	/* Find last table. */
-	table_find(alloc, subpage, miny - margin, maxy + margin, master_space_guess);
+	table_find(alloc, probe, subpage, miny - margin, maxy + margin, master_space_guess);
 
 	return 0;
 }
@@ -1610,10 +1649,11 @@ text. */
 static int
 extract_subpage_tables_find(
 		extract_alloc_t *alloc,
+		extract_probe_t *probe,
 		subpage_t       *subpage,
 		double           master_space_guess)
 {
-	if (extract_subpage_tables_find_lines(alloc, subpage, master_space_guess)) return -1;
+	if (extract_subpage_tables_find_lines(alloc, probe, subpage, master_space_guess)) return -1;
 
 	if (0)
 	{
@@ -1628,19 +1668,28 @@ extract_subpage_tables_find(
 static int
 extract_join_subpage(
 		extract_alloc_t *alloc,
+		extract_probe_t *probe,
 		subpage_t       *subpage,
 		double           master_space_guess)
 {
+	int e = -1;
+
+	extract_probe_event(probe, "join_subpage", 1);
+
 	/* Find tables on this page first. This will remove text that is within
 	tables from page->spans, so that text doesn't appear more than once in
 	the final output. */
-	if (extract_subpage_tables_find(alloc, subpage, master_space_guess)) return -1;
+	if (extract_subpage_tables_find(alloc, probe, subpage, master_space_guess)) goto end;
 
 	/* Now join remaining spans into lines and paragraphs. */
-	if (join_content(alloc, &subpage->content, master_space_guess))
-		return -1;
+	if (join_content(alloc, probe, &subpage->content, master_space_guess)) goto end;
 
-	return 0;
+	e = 0;
+end:
+
+	extract_probe_event(probe, "join_subpage", 0);
+
+	return e;
 }
 
 
@@ -1650,25 +1699,52 @@ A line is a list of spans that are at the same angle and on the same
 line. A paragraph is a list of lines that are at the same angle and close
 together.
 */
-int extract_document_join(extract_alloc_t *alloc, document_t *document, int layout_analysis, double master_space_guess)
+int extract_document_join(extract_alloc_t *alloc, extract_probe_t *probe, document_t *document, int layout_analysis, double master_space_guess)
 {
-	int p;
+	int                   e = -1;
+	int                   p;
+	int                   in_page = 0;
+	int                   in_boxer = 0;
+	extract_probe_timer_t timer;
 
+	extract_probe_event(probe, "join", 1);
 	for (p=0; p<document->pages_num; ++p) {
 		extract_page_t* page = document->pages[p];
 		int c;
 
+		if (probe) probe->page = probe->page_first + p;
+		extract_probe_event(probe, "page", 1);
+		in_page = 1;
+
 		/* If we have layout analysis enabled, then we do our 'boxer' analysis to
 		 * try to spot subdivisions and subpages. */
-		if (layout_analysis && extract_page_analyse(alloc, page)) return -1;
+		if (layout_analysis)
+		{
+			extract_probe_begin(probe, extract_stage_BOXER, &timer);
+			in_boxer = 1;
+			if (extract_page_analyse(alloc, page)) goto end;
+			extract_probe_end(probe, extract_stage_BOXER, &timer);
+			in_boxer = 0;
+		}
 
 		for (c=0; c<page->subpages_num; ++c) {
 			subpage_t* subpage = page->subpages[c];
 
 			outf("processing page %i, subpage %i: num_spans=%i", p, c, content_count_spans(&subpage->content));
-			if (extract_join_subpage(alloc, subpage, master_space_guess)) return -1;
+			if (extract_join_subpage(alloc, probe, subpage, master_space_guess)) goto end;
 		}
+
+		extract_probe_event(probe, "page", 0);
+		in_page = 0;
 	}
 
-	return 0;
+	e = 0;
+end:
+
+	if (in_boxer) extract_probe_end(probe, extract_stage_BOXER, &timer);
+	if (in_page) extract_probe_event(probe, "page", 0);
+	if (probe) probe->page = -1;
+	extract_probe_event(probe, "join", 0);
+
+	return e;
 }
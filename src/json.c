@@ -1,10 +1,13 @@
 /* These extract_json_*() functions generate json content data. */
 
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_OUTPUT
+
 #include "extract/extract.h"
 
 #include "astring.h"
 #include "document.h"
-#include "html.h"
+#include "json.h"
 #include "mem.h"
 #include "memento.h"
 #include "outf.h"
@@ -59,16 +62,27 @@ static int output_structure_path(extract_alloc_t *alloc, extract_astring_t *cont
 	return 0;
 }
 
-static int flush(extract_alloc_t *alloc, extract_astring_t *content, span_t *span, structure_t *structure, extract_astring_t *text, rect_t *bbox)
+/* Appends element for <text> to <content>, preceded by a separator if this
+is not the first element since content->chars[begin]. */
+static int flush(extract_alloc_t *alloc, extract_astring_t *content, size_t begin, span_t *span, structure_t *structure, extract_astring_t *text, rect_t *bbox)
 {
 	if (span == NULL)
 		return 0;
-	if (content->chars_num)
+	if (content->chars_num > begin)
 		if (extract_astring_cat(alloc, content, ",\n"))
 			return -1;
-	if (extract_astring_catf(alloc, content, "{\n\"Bounds\": [ %f, %f, %f, %f ],\n\"Text\": \"", bbox->min.x, bbox->min.y, bbox->max.x, bbox->max.y) ||
+	if (extract_astring_cat(alloc, content, "{\n\"Bounds\": [ ") ||
+		extract_astring_cat_double_f(alloc, content, bbox->min.x, 6) ||
+		extract_astring_cat(alloc, content, ", ") ||
+		extract_astring_cat_double_f(alloc, content, bbox->min.y, 6) ||
+		extract_astring_cat(alloc, content, ", ") ||
+		extract_astring_cat_double_f(alloc, content, bbox->max.x, 6) ||
+		extract_astring_cat(alloc, content, ", ") ||
+		extract_astring_cat_double_f(alloc, content, bbox->max.y, 6) ||
+		extract_astring_cat(alloc, content, " ],\n\"Text\": \"") ||
 		extract_astring_catl(alloc, content, text->chars, text->chars_num) ||
-		extract_astring_catf(alloc, content, "\",\n\"Font\": { \"family_name\": \"%s\" },\n\"TextSize\": %g", span->font_name, extract_font_size(&span->ctm)))
+		extract_astring_catf(alloc, content, "\",\n\"Font\": { \"family_name\": \"%s\" },\n\"TextSize\": ", span->font_name) ||
+		extract_astring_cat_double_g(alloc, content, extract_font_size(&span->ctm)))
 		return -1;
 	if (output_structure_path(alloc, content, structure))
 		return -1;
@@ -80,84 +94,87 @@ static int flush(extract_alloc_t *alloc, extract_astring_t *content, span_t *spa
 	return 0;
 }
 
-int extract_document_to_json_content(
+int extract_page_to_json_content(
 		extract_alloc_t   *alloc,
-		document_t        *document,
+		extract_page_t    *page,
 		int                rotation,
 		int                images,
 		extract_astring_t *content)
 {
 	int ret = -1;
-	int n;
+	int i;
+	subpage_t **psubpage = page->subpages;
 	content_tree_iterator cti;
 	extract_astring_t text;
+	size_t begin = content->chars_num;
 
 	(void) rotation;
 	(void) images;
 
 	extract_astring_init(&text);
-	//extract_astring_cat(alloc, content, "<html>\n");
-	//extract_astring_cat(alloc, content, "<body>\n");
 
-	/* Write paragraphs into <content>. */
-	for (n=0; n<document->pages_num; ++n)
+	for (i=0; i<page->subpages_num; ++i)
 	{
-		int              i;
-		extract_page_t  *page     = document->pages[n];
-		subpage_t      **psubpage = page->subpages;
+		content_t *cont;
+		structure_t *structure = NULL;
+		span_t *last_span = NULL;
+		rect_t bbox = extract_rect_empty;
 
-		for (i=0; i<page->subpages_num; ++i)
+		for (cont = content_tree_iterator_init(&cti, &psubpage[i]->content); cont != NULL; cont = content_tree_iterator_next(&cti))
 		{
-			content_t *cont;
-			structure_t *structure = NULL;
-			span_t *last_span = NULL;
-			rect_t bbox = extract_rect_empty;
-
-			for (cont = content_tree_iterator_init(&cti, &psubpage[i]->content); cont != NULL; cont = content_tree_iterator_next(&cti))
+			switch (cont->type)
+			{
+			case content_span:
 			{
-				switch (cont->type)
+				int j;
+				span_t *span = (span_t *)cont;
+				if (last_span &&
+					(structure != span->structure ||
+					 last_span->flags.font_bold != span->flags.font_bold ||
+					 last_span->flags.font_italic != span->flags.font_italic ||
+					 last_span->flags.wmode != span->flags.wmode ||
+					 strcmp(last_span->font_name, span->font_name)))
 				{
-				case content_span:
+					// flush stored text.
+					flush(alloc, content, begin, last_span, structure, &text, &bbox);
+				}
+				last_span = span;
+				structure = span->structure;
+				for (j = 0; j < span->chars_num; j++)
 				{
-					int j;
-					span_t *span = (span_t *)cont;
-					if (last_span &&
-						(structure != span->structure ||
-						 last_span->flags.font_bold != span->flags.font_bold ||
-						 last_span->flags.font_italic != span->flags.font_italic ||
-						 last_span->flags.wmode != span->flags.wmode ||
-						 strcmp(last_span->font_name, span->font_name)))
-					{
-						// flush stored text.
-						flush(alloc, content, last_span, structure, &text, &bbox);
-					}
-					last_span = span;
-					structure = span->structure;
-					for (j = 0; j < span->chars_num; j++)
-					{
-						if (span->chars[j].ucs == (unsigned int)-1)
-							continue;
-						if (extract_astring_catc_unicode(alloc, &text, span->chars[j].ucs, 1, 0, 0, 0))
-							goto end;
+					/* Append run of chars up to next ucs=-1 in one go. */
+					int j0 = j;
+					for (; j < span->chars_num && span->chars[j].ucs != (unsigned int)-1; j++)
 						bbox = extract_rect_union(bbox, span->chars[j].bbox);
-					}
-					break;
-				}
-				case content_image:
-				case content_table:
-				case content_block:
-				case content_line:
-				case content_paragraph:
-					 // Nothing to do for lines and paragraphs as they just enclose spans.
-					 // Nothing to do for the others for now.
-					 break;
-				default:
-					 assert("This should never happen\n" == NULL);
-					 break;
+					if (j > j0 && extract_astring_cat_unicode_array(
+							alloc,
+							&text,
+							&span->chars[j0].ucs,
+							j - j0,
+							sizeof(span->chars[0]),
+							1 /*xml*/,
+							0 /*ascii_ligatures*/,
+							0 /*ascii_dash*/,
+							0 /*ascii_apostrophe*/
+							))
+						goto end;
 				}
+				break;
+			}
+			case content_image:
+			case content_table:
+			case content_block:
+			case content_line:
+			case content_paragraph:
+				 // Nothing to do for lines and paragraphs as they just enclose spans.
+				 // Nothing to do for the others for now.
+				 break;
+			default:
+				 assert("This should never happen\n" == NULL);
+				 break;
 			}
-			flush(alloc, content, last_span, structure, &text, &bbox);
 		}
+		flush(alloc, content, begin, last_span, structure, &text, &bbox);
 	}
 
 	ret = 0;
@@ -167,3 +184,28 @@ end:
 
 	return ret;
 }
+
+int extract_document_to_json_content(
+		extract_alloc_t   *alloc,
+		document_t        *document,
+		int                rotation,
+		int                images,
+		extract_astring_t *content)
+{
+	int n;
+
+	/* Write paragraphs into <content>. */
+	for (n=0; n<document->pages_num; ++n)
+	{
+		size_t begin = content->chars_num;
+		if (begin && extract_astring_cat(alloc, content, ",\n")) return -1;
+		if (extract_page_to_json_content(alloc, document->pages[n], rotation, images, content)) return -1;
+		if (begin && content->chars_num == begin + 2)
+		{
+			/* Page had no elements, so remove separator. */
+			extract_astring_truncate(content, 2);
+		}
+	}
+
+	return 0;
+}
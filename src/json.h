@@ -21,4 +21,15 @@ This string can be passed to extract_docx_content_item() or
 extract_docx_write_template() to be inserted into a docx archive's
 word/document.xml. */
 
+int extract_page_to_json_content(
+		extract_alloc_t   *alloc,
+		extract_page_t    *page,
+		int                rotation,
+		int                images,
+		extract_astring_t *content
+		);
+/* Appends json elements for a single page to <content>, separated by ",\n"
+but without any leading or trailing separator, i.e. what
+extract_document_to_json_content() writes for each page. */
+
 #endif
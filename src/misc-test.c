@@ -1,8 +1,15 @@
+#include "extract/buffer.h"
+#include "extract/extract.h"
+
+#include "astring.h"
 #include "memento.h"
 #include "xml.h"
+#include "zip.h"
 
 #include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 
 static int s_num_fails = 0;
@@ -117,6 +124,854 @@ static void s_check_xml_parse()
 	}
 }
 
+/* Read buffer that returns at most <step> bytes at a time, either from its
+cache or from fn_read, so that tags span chunks. */
+typedef struct
+{
+	const char *data;
+	size_t      data_size;
+	size_t      pos;
+	size_t      step;
+} s_step_buffer_t;
+
+static int s_step_read(void *handle, void *destination, size_t numbytes, size_t *o_actual)
+{
+	s_step_buffer_t *sb = handle;
+	size_t           n = sb->data_size - sb->pos;
+	if (n > sb->step) n = sb->step;
+	if (n > numbytes) n = numbytes;
+	memcpy(destination, sb->data + sb->pos, n);
+	sb->pos += n;
+	*o_actual = n;
+	return 0;
+}
+
+static int s_step_cache(void *handle, void **o_cache, size_t *o_numbytes)
+{
+	s_step_buffer_t *sb = handle;
+	size_t           n = sb->data_size - sb->pos;
+	if (n > sb->step) n = sb->step;
+	*o_cache = (void*) (sb->data + sb->pos);
+	*o_numbytes = n;
+	sb->pos += n;
+	return 0;
+}
+
+static int s_slice_eq(const extract_xml_slice_t *slice, const char *text)
+{
+	return slice->chars_num == strlen(text) && !memcmp(slice->chars, text, slice->chars_num);
+}
+
+static void s_check_xml_scan(void)
+{
+	const char* texts[] = {
+			"<foo a=1>text</foo>",
+			"< >",
+			"<foo bar=>",
+			"< bar=>",
+			"< =>",
+			"<?xml version=\"1.0\"?>\n<page>\n<span a=\"x y\" b='p>q' c=\"r\\\"s\"/>\n"
+				"<char x=\"1.5\" y=\"-2\" ucs=\"60\"/>  <image  d e=f/g h>0123456789abcdef</image>\n",
+			"<a x=\"\\'\" y=\"\\\\\">long trailing text without end",
+			};
+	size_t steps[] = { 1, 2, 3, 7, 1000 };
+	unsigned i;
+
+	printf("testing extract_xml_scanner_*():\n");
+	for (i=0; i<sizeof(texts) / sizeof(texts[0]); ++i)
+	{
+		unsigned s;
+		for (s=0; s<2*sizeof(steps) / sizeof(steps[0]); ++s)
+		{
+			const char*           text = texts[i];
+			s_step_buffer_t       sb;
+			extract_buffer_t*     buffer;
+			extract_buffer_t*     buffer_expected;
+			extract_xml_scanner_t scanner;
+			extract_xml_tag_t     tag;
+			int                   e;
+			sb.data = text;
+			sb.data_size = strlen(text);
+			sb.pos = 0;
+			sb.step = steps[s / 2];
+			/* Alternate between cache and fn_read. */
+			e = extract_buffer_open(
+					NULL /*alloc*/,
+					&sb,
+					(s % 2) ? s_step_read : NULL,
+					NULL /*fn_write*/,
+					(s % 2) ? NULL : s_step_cache,
+					NULL /*fn_close*/,
+					&buffer
+					);
+			s_check_e(e, "extract_buffer_open()");
+			e = extract_buffer_open_simple(NULL /*alloc*/, text, strlen(text), NULL /*handle*/, NULL /*fn_close*/, &buffer_expected);
+			s_check_e(e, "extract_buffer_open_simple()");
+
+			extract_xml_tag_init(&tag);
+			s_check_e(extract_xml_pparse_init(NULL /*alloc*/, buffer_expected, NULL /*first_line*/), "extract_xml_pparse_init()");
+			s_check_e(extract_xml_scanner_init(NULL /*alloc*/, buffer, NULL /*prefix*/, 0 /*prefix_size*/, &scanner), "extract_xml_scanner_init()");
+			for(;;)
+			{
+				int e_expected = extract_xml_pparse_next(buffer_expected, &tag);
+				int j;
+				e = extract_xml_scanner_next(&scanner);
+				s_check_e(e != e_expected, "extract_xml_scanner_next() return");
+				if (e || e_expected) break;
+				s_check_e(!s_slice_eq(&scanner.tag.name, tag.name), "extract_xml_scanner_next() name");
+				s_check_e(!s_slice_eq(&scanner.tag.text, tag.text.chars ? tag.text.chars : ""), "extract_xml_scanner_next() text");
+				s_check_e(scanner.tag.attributes_num != tag.attributes_num, "extract_xml_scanner_next() attributes_num");
+				if (scanner.tag.attributes_num != tag.attributes_num) break;
+				for (j=0; j<tag.attributes_num; ++j)
+				{
+					s_check_e(!s_slice_eq(&scanner.tag.attributes[j].name, tag.attributes[j].name), "extract_xml_scanner_next() attribute name");
+					s_check_e(!s_slice_eq(&scanner.tag.attributes[j].value, tag.attributes[j].value), "extract_xml_scanner_next() attribute value");
+				}
+			}
+			extract_xml_tag_free(NULL /*alloc*/, &tag);
+			extract_xml_scanner_free(&scanner);
+			extract_buffer_close(&buffer);
+			extract_buffer_close(&buffer_expected);
+		}
+	}
+}
+
+/* Checks that extract_xml_slice_to_*() give same results as
+extract_xml_str_to_*(). */
+static void s_check_slice_number(const char *text)
+{
+	extract_xml_slice_t slice;
+	double              d;
+	double              d_expected;
+	int                 i;
+	int                 i_expected;
+	unsigned            u;
+	unsigned            u_expected;
+	int                 e;
+	int                 e_expected;
+	int                 errno_expected;
+
+	slice.chars = text;
+	slice.chars_num = strlen(text);
+
+	e_expected = extract_xml_str_to_double(text, &d_expected);
+	errno_expected = errno;
+	e = extract_xml_slice_to_double(&slice, &d);
+	if (e != e_expected || (e && errno != errno_expected) || (!e && memcmp(&d, &d_expected, sizeof(d))))
+	{
+		printf("extract_xml_slice_to_double() fail: text=%s e=%i d=%.17g e_expected=%i d_expected=%.17g\n",
+				text, e, d, e_expected, d_expected);
+		s_num_fails += 1;
+	}
+
+	e_expected = extract_xml_str_to_int(text, &i_expected);
+	errno_expected = errno;
+	e = extract_xml_slice_to_int(&slice, &i);
+	if (e != e_expected || (e && errno != errno_expected) || (!e && i != i_expected))
+	{
+		printf("extract_xml_slice_to_int() fail: text=%s\n", text);
+		s_num_fails += 1;
+	}
+
+	e_expected = extract_xml_str_to_uint(text, &u_expected);
+	errno_expected = errno;
+	e = extract_xml_slice_to_uint(&slice, &u);
+	if (e != e_expected || (e && errno != errno_expected) || (!e && u != u_expected))
+	{
+		printf("extract_xml_slice_to_uint() fail: text=%s\n", text);
+		s_num_fails += 1;
+	}
+}
+
+static void s_check_slice_numbers(void)
+{
+	const char *texts[] = {
+			"", "-", ".", "-.", "0", "-0", "1.", ".5", "-.5", "00012.50", "1e5",
+			"1.5x", " 1", "+1", "1..2", "0.1", "0.3", "-123.456",
+			"2147483647", "2147483648", "-2147483648", "-2147483649",
+			"4294967295", "4294967296", "-1",
+			"9007199254740992", "9007199254740993", "1234567890123456789",
+			"12345678901234567890", "0.00000000000000000000001",
+			"0.0000000000000000000001", "123.4567890123456789",
+			};
+	unsigned    i;
+	char        buffer[64];
+	unsigned    seed = 1;
+
+	printf("testing extract_xml_slice_to_*():\n");
+	for (i=0; i<sizeof(texts) / sizeof(texts[0]); ++i)
+	{
+		s_check_slice_number(texts[i]);
+	}
+	for (i=0; i<100000; ++i)
+	{
+		double x;
+		seed = seed * 1103515245 + 12345;
+		x = (seed % 2000000) / 7.0 - 100000;
+		snprintf(buffer, sizeof(buffer), "%.3f", x);
+		s_check_slice_number(buffer);
+		snprintf(buffer, sizeof(buffer), "%.6f", x / 1000);
+		s_check_slice_number(buffer);
+		snprintf(buffer, sizeof(buffer), "%g", x);
+		s_check_slice_number(buffer);
+		snprintf(buffer, sizeof(buffer), "%.17g", x);
+		s_check_slice_number(buffer);
+		snprintf(buffer, sizeof(buffer), "%i", (int) x);
+		s_check_slice_number(buffer);
+	}
+}
+
+/* Straightforward version of extract_xml_slice_hex_decode(). */
+static int s_hex_decode_simple(const char *text, size_t text_num, char *data, size_t data_size)
+{
+	size_t i;
+	size_t j = 0;
+
+	for (i=0; i<data_size; ++i)
+	{
+		int byte = 0;
+		int k;
+		while (j < text_num && (text[j] == ' ' || text[j] == '\n'))
+			j += 1;
+		for (k=0; k<2; ++k)
+		{
+			int c = (j < text_num) ? text[j] : 0;
+			j += 1;
+			if (c >= '0' && c <= '9') byte = byte * 16 + c - '0';
+			else if (c >= 'a' && c <= 'f') byte = byte * 16 + 10 + c - 'a';
+			else return -1;
+		}
+		data[i] = (char) byte;
+	}
+	return 0;
+}
+
+static void s_check_hex_decode(void)
+{
+	const char         *hex = "0123456789abcdef";
+	const char         *bad = "AF g/:`\n\x80";
+	char                text[1000];
+	char                data[300];
+	char                data_expected[300];
+	unsigned            seed = 1;
+	int                 i;
+	extract_xml_slice_t slice;
+
+	printf("testing extract_xml_slice_hex_decode():\n");
+	for (i=0; i<20000; ++i)
+	{
+		size_t data_size;
+		size_t text_num = 0;
+		size_t j;
+		int    e;
+		int    e_expected;
+
+		seed = seed * 1103515245 + 12345;
+		data_size = (seed >> 8) % 200;
+		for (j=0; j<data_size; ++j)
+		{
+			seed = seed * 1103515245 + 12345;
+			if ((seed >> 16) % 10 == 0) text[text_num++] = ((seed >> 8) % 2) ? ' ' : '\n';
+			if (j % 32 == 31) text[text_num++] = '\n';
+			seed = seed * 1103515245 + 12345;
+			text[text_num++] = hex[(seed >> 8) % 16];
+			text[text_num++] = hex[(seed >> 12) % 16];
+		}
+		seed = seed * 1103515245 + 12345;
+		if (i % 2 && text_num)
+		{
+			/* Insert a bad character somewhere. */
+			text[(seed >> 8) % text_num] = bad[(seed >> 16) % strlen(bad)];
+		}
+		else if (i % 3 == 0 && text_num)
+		{
+			/* Truncate. */
+			text_num -= 1 + (seed >> 8) % text_num;
+		}
+
+		slice.chars = text;
+		slice.chars_num = text_num;
+		e_expected = s_hex_decode_simple(text, text_num, data_expected, data_size);
+		errno = 0;
+		e = extract_xml_slice_hex_decode(&slice, data, data_size);
+		if (e != e_expected || (e && errno != EINVAL) || (!e && memcmp(data, data_expected, data_size)))
+		{
+			printf("extract_xml_slice_hex_decode() fail: i=%i e=%i e_expected=%i text=%.*s\n",
+					i, e, e_expected, (int) text_num, text);
+			s_num_fails += 1;
+		}
+	}
+}
+
+static void s_check_astring(void)
+{
+	extract_astring_t string;
+	int               i;
+	char              expected[64];
+
+	printf("testing extract_astring_*():\n");
+	extract_astring_init(&string);
+	for (i=0; i<1000; ++i)
+	{
+		size_t len = string.chars_num;
+		snprintf(expected, sizeof(expected), "%i:%f,", i, i * 1.5);
+		s_check_e(extract_astring_catf(NULL, &string, "%i:%f,", i, i * 1.5), "extract_astring_catf()");
+		s_check_e(string.chars_num != len + strlen(expected), "extract_astring_catf() length");
+		s_check_e(strcmp(string.chars + len, expected), "extract_astring_catf() content");
+		s_check_e(string.chars_max <= string.chars_num, "extract_astring_t capacity");
+		s_check_e(extract_astring_cat(NULL, &string, "x"), "extract_astring_cat()");
+		s_check_e(string.chars[string.chars_num-1] != 'x' || string.chars[string.chars_num] != 0, "extract_astring_cat() content");
+	}
+	extract_astring_free(NULL, &string);
+	s_check_e(string.chars || string.chars_num || string.chars_max, "extract_astring_free()");
+}
+
+static void s_check_trace_chrome(void)
+{
+	extract_buffer_expanding_t  ebe;
+	extract_trace_chrome_t     *chrome = NULL;
+	const char                 *expected =
+			"[\n"
+			"{\"name\":\"process\",\"ph\":\"B\",\"ts\":0.000,\"pid\":1,\"tid\":1},\n"
+			"{\"name\":\"format\",\"ph\":\"B\",\"ts\":500000.000,\"pid\":1,\"tid\":1,\"args\":{\"page\":3}},\n"
+			"{\"name\":\"format\",\"ph\":\"E\",\"ts\":750000.000,\"pid\":1,\"tid\":1,\"args\":{\"page\":3}},\n"
+			"{\"name\":\"process\",\"ph\":\"E\",\"ts\":1000000.000,\"pid\":1,\"tid\":1},\n"
+			"{\"name\":\"a\\\"b\\\\c\\u000ad\",\"ph\":\"B\",\"ts\":2000000.000,\"pid\":1,\"tid\":1}\n"
+			"]\n";
+
+	printf("testing extract_trace_chrome():\n");
+	s_check_e(extract_buffer_expanding_create(NULL, &ebe), "extract_buffer_expanding_create()");
+	s_check_e(extract_trace_chrome_open(ebe.buffer, &chrome), "extract_trace_chrome_open()");
+	extract_trace_chrome(chrome, "process", 1, -1, 10);
+	extract_trace_chrome(chrome, "format", 1, 3, 10.5);
+	extract_trace_chrome(chrome, "format", 0, 3, 10.75);
+	extract_trace_chrome(chrome, "process", 0, -1, 11);
+	/* Names are escaped. */
+	extract_trace_chrome(chrome, "a\"b\\c\nd", 1, -1, 12);
+	s_check_e(extract_trace_chrome_close(&chrome), "extract_trace_chrome_close()");
+	s_check_e(extract_buffer_close(&ebe.buffer), "extract_buffer_close()");
+	s_check_e(ebe.data_size != strlen(expected) || memcmp(ebe.data, expected, ebe.data_size), "extract_trace_chrome() output");
+	extract_free(NULL, &ebe.data);
+}
+
+static void *s_realloc(void *state, void *prev, size_t size)
+{
+	(void) state;
+	return realloc(prev, size);
+}
+
+static void s_check_alloc_accounting(void)
+{
+	extract_alloc_t       *alloc = NULL;
+	extract_alloc_stats_t *stats;
+	extract_alloc_bytes_t *chars;
+	extract_alloc_bytes_t *all;
+	char                  *a = NULL;
+	char                  *b = NULL;
+
+	printf("testing extract_alloc_accounting():\n");
+	s_check_e(extract_alloc_create(s_realloc, NULL, &alloc), "extract_alloc_create()");
+	s_check_e(extract_alloc_accounting(alloc), "extract_alloc_accounting()");
+	stats = extract_alloc_stats(alloc);
+	chars = &stats->bytes[extract_alloc_category_CHARS];
+	all = &stats->bytes[extract_alloc_category_NUM];
+
+	s_check_e(extract_malloc_category(alloc, extract_alloc_category_CHARS, &a, 100), "extract_malloc_category()");
+	s_check_e(extract_realloc2_category(alloc, extract_alloc_category_OTHER, &a, 100, 300), "extract_realloc2_category()");
+	s_check_e(extract_realloc(alloc, &a, 200), "extract_realloc()");
+	s_check_e(extract_malloc(alloc, &b, 50), "extract_malloc()");
+	s_check_e(chars->bytes_current != 200 || chars->bytes_peak != 300 || chars->bytes_total != 300,
+			"category kept after realloc");
+	s_check_e(stats->bytes[extract_alloc_category_OTHER].bytes_current != 50, "default category");
+	s_check_e(all->bytes_current != 250 || all->bytes_peak != 300, "all categories");
+	memset(a, 'x', 200);
+
+	extract_free(alloc, &a);
+	extract_free(alloc, &b);
+	s_check_e(a || b, "extract_free()");
+	s_check_e(all->bytes_current != 0 || all->bytes_total != 350, "all categories after free");
+
+	/* Enabling accounting after allocations is not allowed. */
+	errno = 0;
+	s_check_e(extract_alloc_accounting(alloc) != -1 || errno != EINVAL, "extract_alloc_accounting() after allocations");
+	extract_alloc_destroy(&alloc);
+}
+
+/* Checks that strings allocated while parsing XML are accounted as
+extract_alloc_category_XML. */
+static void s_check_xml_accounting(void)
+{
+	const char            *text = "<a x=\"\\'\" y=\"long value in several chunks\">some text</a><b/>";
+	extract_alloc_t       *alloc = NULL;
+	extract_alloc_stats_t *stats;
+	extract_buffer_t      *buffer = NULL;
+	extract_xml_scanner_t  scanner;
+	extract_xml_tag_t      tag;
+	s_step_buffer_t        sb;
+	int                    e;
+
+	printf("testing accounting of XML parsing:\n");
+	s_check_e(extract_alloc_create(s_realloc, NULL, &alloc), "extract_alloc_create()");
+	s_check_e(extract_alloc_accounting(alloc), "extract_alloc_accounting()");
+	stats = extract_alloc_stats(alloc);
+
+	/* Small steps make the scanner carry tags between chunks. */
+	sb.data = text;
+	sb.data_size = strlen(text);
+	sb.pos = 0;
+	sb.step = 3;
+	s_check_e(extract_buffer_open(alloc, &sb, NULL /*fn_read*/, NULL /*fn_write*/, s_step_cache, NULL /*fn_close*/, &buffer),
+			"extract_buffer_open()");
+	s_check_e(extract_xml_scanner_init(alloc, buffer, NULL /*prefix*/, 0 /*prefix_size*/, &scanner), "extract_xml_scanner_init()");
+	for(;;)
+	{
+		e = extract_xml_scanner_next(&scanner);
+		if (e) break;
+	}
+	s_check_e(e != 1, "extract_xml_scanner_next() EOF");
+	s_check_e(scanner.carry.chars == NULL || scanner.unescaped.chars == NULL, "scanner strings used");
+	s_check_e(stats->bytes[extract_alloc_category_OUTPUT].bytes_total != 0, "scanner allocations not accounted as output");
+	extract_xml_scanner_free(&scanner);
+	extract_buffer_close(&buffer);
+
+	s_check_e(extract_buffer_open_simple(alloc, text, strlen(text), NULL /*handle*/, NULL /*fn_close*/, &buffer),
+			"extract_buffer_open_simple()");
+	extract_xml_tag_init(&tag);
+	s_check_e(extract_xml_pparse_init(alloc, buffer, NULL /*first_line*/), "extract_xml_pparse_init()");
+	s_check_e(extract_xml_pparse_next(buffer, &tag), "extract_xml_pparse_next()");
+	s_check_e(tag.text.chars == NULL, "extract_xml_pparse_next() text");
+	s_check_e(stats->bytes[extract_alloc_category_OUTPUT].bytes_total != 0, "tag text not accounted as output");
+	s_check_e(stats->bytes[extract_alloc_category_XML].bytes_total == 0, "XML parsing accounted as XML");
+	extract_xml_tag_free(alloc, &tag);
+	extract_buffer_close(&buffer);
+	extract_alloc_destroy(&alloc);
+}
+
+/* Writes <data>..+<data_size> to file <path>. */
+static void s_write_path(const char *path, const void *data, size_t data_size)
+{
+	FILE *f = fopen(path, "wb");
+	s_check_e(!f, path);
+	if (!f) return;
+	s_check_e(fwrite(data, 1, data_size, f) != data_size, path);
+	s_check_e(fclose(f), path);
+}
+
+/* Writes zip files test/generated/zip64.zip and test/generated/zip64-copy.zip
+with low Zip64 limits, so that all Zip64 code paths are used; the Makefile
+checks the files with unzip -t. We also read them back ourselves. */
+static void s_check_zip64(void)
+{
+	extract_buffer_expanding_t  ebe;
+	extract_buffer_expanding_t  ebe_copy;
+	extract_zip_t              *zip = NULL;
+	extract_zip_reader_t       *reader = NULL;
+	char                        compressible[10000];
+	char                        incompressible[2000];
+	const char                 *small = "hello world\n";
+	unsigned                    seed = 1;
+	int                         i;
+
+	printf("testing Zip64:\n");
+	for (i=0; i<(int) sizeof(compressible); ++i)
+	{
+		compressible[i] = (char) ('a' + i % 26);
+	}
+	for (i=0; i<(int) sizeof(incompressible); ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		incompressible[i] = (char) (seed >> 16);
+	}
+
+	/* <compressible> is predicted to need Zip64 but compresses to much less
+	than the limit; <incompressible> is stored with sizes above the limit;
+	<small> does not need Zip64 sizes but has offset above the limit; and we
+	write more files than zip64_limit_num. */
+	s_check_e(extract_buffer_expanding_create(NULL, &ebe), "extract_buffer_expanding_create()");
+	s_check_e(extract_zip_open(ebe.buffer, &zip), "extract_zip_open()");
+	extract_zip_set_zip64_limits(zip, 1000, 3);
+	s_check_e(extract_zip_write_file(zip, compressible, sizeof(compressible), "compressible.txt"), "extract_zip_write_file()");
+	s_check_e(extract_zip_write_file_method(zip, incompressible, sizeof(incompressible), "incompressible.bin",
+			extract_zip_method_STORE), "extract_zip_write_file_method()");
+	s_check_e(extract_zip_write_file(zip, small, strlen(small), "small.txt"), "extract_zip_write_file()");
+	s_check_e(extract_zip_write_file(zip, small, strlen(small), "small2.txt"), "extract_zip_write_file()");
+	s_check_e(extract_zip_close(&zip), "extract_zip_close()");
+	s_check_e(extract_buffer_close(&ebe.buffer), "extract_buffer_close()");
+
+	/* Read back, and copy into another zip file. */
+	s_check_e(extract_zip_reader_open(NULL, ebe.data, ebe.data_size, &reader), "extract_zip_reader_open()");
+	s_check_e(extract_zip_reader_files_num(reader) != 4, "extract_zip_reader_files_num()");
+	s_check_e(extract_buffer_expanding_create(NULL, &ebe_copy), "extract_buffer_expanding_create()");
+	s_check_e(extract_zip_open(ebe_copy.buffer, &zip), "extract_zip_open()");
+	extract_zip_set_zip64_limits(zip, 1000, 3);
+	for (i=0; i<extract_zip_reader_files_num(reader); ++i)
+	{
+		const char *name = extract_zip_reader_file_name(reader, i);
+		const char *expected = (i == 0) ? compressible : (i == 1) ? incompressible : small;
+		size_t      expected_size = (i == 0) ? sizeof(compressible) : (i == 1) ? sizeof(incompressible) : strlen(small);
+		char       *data = NULL;
+		size_t      data_size;
+		s_check_e(extract_zip_reader_read_file(reader, i, &data, &data_size), name);
+		s_check_e(!data || data_size != expected_size || memcmp(data, expected, expected_size), name);
+		extract_free(NULL, &data);
+		s_check_e(extract_zip_copy_file(zip, reader, i), "extract_zip_copy_file()");
+	}
+	s_check_e(extract_zip_close(&zip), "extract_zip_close()");
+	s_check_e(extract_buffer_close(&ebe_copy.buffer), "extract_buffer_close()");
+	extract_zip_reader_close(&reader);
+
+	s_write_path("test/generated/zip64.zip", ebe.data, ebe.data_size);
+	s_write_path("test/generated/zip64-copy.zip", ebe_copy.data, ebe_copy.data_size);
+	extract_free(NULL, &ebe.data);
+	extract_free(NULL, &ebe_copy.data);
+}
+
+/* Data for lazy images. Different images share this as their fetch handle,
+with different fetch functions. */
+typedef struct
+{
+	const char *one;
+	const char *two;
+	int         fetches;
+} s_lazy_t;
+
+static int s_lazy_fetch_one(void *handle, void **o_data)
+{
+	s_lazy_t *lazy = handle;
+	lazy->fetches += 1;
+	*o_data = (void*) lazy->one;
+	return 0;
+}
+
+static int s_lazy_fetch_two(void *handle, void **o_data)
+{
+	s_lazy_t *lazy = handle;
+	lazy->fetches += 1;
+	*o_data = (void*) lazy->two;
+	return 0;
+}
+
+static int s_lazy_fetch_fail(void *handle, void **o_data)
+{
+	(void) handle;
+	*o_data = NULL;
+	errno = EIO;
+	return -1;
+}
+
+static void s_lazy_free(void *handle, void *data)
+{
+	s_lazy_t *lazy = handle;
+	(void) data;
+	lazy->fetches -= 1;
+}
+
+/* Checks that images are shared in docx output if and only if they have the
+same data, whether or not they are lazy or share a fetch handle. */
+static void s_check_image_repeats(void)
+{
+	extract_t                  *extract = NULL;
+	extract_buffer_expanding_t  ebe;
+	extract_zip_reader_t       *reader = NULL;
+	s_lazy_t                    lazy = { "image data one", "image data two", 0};
+	s_lazy_t                    lazy2 = { "image data one", "image data two", 0};
+	int                         media = 0;
+	int                         i;
+
+	printf("testing repeated images:\n");
+	s_check_e(extract_begin(NULL, extract_format_DOCX, &extract), "extract_begin()");
+	s_check_e(extract_page_begin(extract, 0, 0, 100, 100), "extract_page_begin()");
+
+	/* Two different images with the same handle. */
+	s_check_e(extract_add_image_lazy(extract, "png", 0, 0, 10, 10, strlen(lazy.one), s_lazy_fetch_one, &lazy, s_lazy_free, &lazy),
+			"extract_add_image_lazy()");
+	s_check_e(extract_add_image_lazy(extract, "png", 0, 20, 10, 10, strlen(lazy.two), s_lazy_fetch_two, &lazy, s_lazy_free, &lazy),
+			"extract_add_image_lazy()");
+
+	/* Images with the same data as the above but with a different handle,
+	or not lazy. */
+	s_check_e(extract_add_image_lazy(extract, "png", 0, 40, 10, 10, strlen(lazy2.one), s_lazy_fetch_one, &lazy2, s_lazy_free, &lazy2),
+			"extract_add_image_lazy()");
+	s_check_e(extract_add_image(extract, "png", 0, 60, 10, 10, (void*) lazy.two, strlen(lazy.two), NULL, NULL),
+			"extract_add_image()");
+
+	/* Errors from fetching data to look for repeats are returned. */
+	errno = 0;
+	s_check_e(extract_add_image_lazy(extract, "png", 0, 80, 10, 10, strlen(lazy.one), s_lazy_fetch_fail, NULL, NULL, NULL) != -1
+			|| errno != EIO, "extract_add_image_lazy() with failing fetch");
+
+	s_check_e(extract_page_end(extract), "extract_page_end()");
+	s_check_e(extract_process(extract, 0 /*spacing*/, 0 /*rotation*/, 1 /*images*/), "extract_process()");
+	s_check_e(extract_buffer_expanding_create(NULL, &ebe), "extract_buffer_expanding_create()");
+	s_check_e(extract_write(extract, ebe.buffer), "extract_write()");
+	s_check_e(extract_buffer_close(&ebe.buffer), "extract_buffer_close()");
+	extract_end(&extract);
+	s_check_e(lazy.fetches || lazy2.fetches, "lazy image data released");
+
+	s_check_e(extract_zip_reader_open(NULL, ebe.data, ebe.data_size, &reader), "extract_zip_reader_open()");
+	for (i=0; i<extract_zip_reader_files_num(reader); ++i)
+	{
+		const char *name = extract_zip_reader_file_name(reader, i);
+		char       *data = NULL;
+		if (strncmp(name, "word/media/", 11)) continue;
+		media += 1;
+		s_check_e(extract_zip_reader_read_file(reader, i, &data, NULL), name);
+		s_check_e(!data || (strcmp(data, lazy.one) && strcmp(data, lazy.two)), name);
+		extract_free(NULL, &data);
+	}
+	if (media != 2)
+	{
+		printf("    fail: expected 2 media files, found %i\n", media);
+		s_num_fails += 1;
+	}
+	extract_zip_reader_close(&reader);
+	extract_free(NULL, &ebe.data);
+}
+
+/* Checks that trace events nest, including when processing fails. */
+typedef struct
+{
+	const char *names[32];
+	int         depth;
+	int         errors;
+} s_trace_t;
+
+static void s_trace(void *handle, const char *name, int begin, int page, double time)
+{
+	s_trace_t *trace = handle;
+	(void) page;
+	(void) time;
+	if (begin)
+	{
+		if (trace->depth < 32) trace->names[trace->depth] = name;
+		trace->depth += 1;
+	}
+	else if (trace->depth == 0)
+	{
+		trace->errors += 1;
+	}
+	else
+	{
+		trace->depth -= 1;
+		if (trace->depth < 32 && strcmp(trace->names[trace->depth], name)) trace->errors += 1;
+	}
+}
+
+/* Allocator that fails once <allocs> reaches <fail_at>, if <fail_at> is not
+-1. */
+typedef struct
+{
+	int allocs;
+	int fail_at;
+} s_failing_t;
+
+static void *s_failing_realloc(void *state, void *prev, size_t size)
+{
+	s_failing_t *failing = state;
+	if (size)
+	{
+		if (failing->fail_at != -1 && failing->allocs >= failing->fail_at) return NULL;
+		failing->allocs += 1;
+	}
+	return realloc(prev, size);
+}
+
+/* Adds two pages each with two lines of one word. */
+static int s_add_pages(extract_t *extract)
+{
+	const char *text = "hello";
+	int         p;
+	int         l;
+	int         i;
+
+	for (p=0; p<2; ++p)
+	{
+		if (extract_page_begin(extract, 0, 0, 600, 800)) return -1;
+		for (l=0; l<2; ++l)
+		{
+			double y = 100 + 200 * l;
+			if (extract_span_begin(extract, "Times-Roman", 0, 0, 0, 10, 0, 0, 10, 0, y, 100, y + 10)) return -1;
+			for (i=0; text[i]; ++i)
+			{
+				double x = 100 + 6 * i;
+				if (extract_add_char(extract, x, y, text[i], 6, x, y, x + 6, y + 10)) return -1;
+			}
+			if (extract_span_end(extract)) return -1;
+		}
+		if (extract_page_end(extract)) return -1;
+	}
+	return 0;
+}
+
+static void s_check_probes(void)
+{
+	extract_t             *extract = NULL;
+	extract_alloc_t       *alloc = NULL;
+	const extract_stats_t *stats;
+	s_trace_t              trace = {{NULL}, 0, 0};
+	s_failing_t            failing;
+	int                    fail_at;
+
+	printf("testing stats and trace events:\n");
+	s_check_e(extract_begin(NULL, extract_format_HTML, &extract), "extract_begin()");
+	s_check_e(extract_set_stats(extract, 1), "extract_set_stats()");
+	s_check_e(extract_set_trace(extract, s_trace, &trace), "extract_set_trace()");
+	s_check_e(s_add_pages(extract), "s_add_pages()");
+	s_check_e(extract_process(extract, 0 /*spacing*/, 0 /*rotation*/, 1 /*images*/), "extract_process()");
+	stats = extract_stats(extract);
+	s_check_e(!stats, "extract_stats()");
+	if (stats)
+	{
+		/* Joining the two lines of each paragraph adds a space. */
+		s_check_e(stats->chars != 22 || stats->spans != 4 || stats->lines != 4 || stats->paragraphs != 2,
+				"stats counts");
+		s_check_e(stats->tables || stats->images, "stats counts of tables and images");
+		s_check_e(stats->times[extract_stage_MAKE_LINES].calls != 2
+				|| stats->times[extract_stage_ROTATED_BLOCKS].calls != 2
+				|| stats->times[extract_stage_FORMAT].calls != 2
+				|| stats->times[extract_stage_IMAGES].calls != 1
+				|| stats->times[extract_stage_INGEST].calls != 0,
+				"stats stage calls");
+	}
+	s_check_e(trace.depth || trace.errors, "trace events nest");
+	extract_end(&extract);
+
+	/* Make extract_process() fail at each allocation in turn. */
+	for (fail_at=0; ; ++fail_at)
+	{
+		int e;
+		failing.allocs = 0;
+		failing.fail_at = -1;
+		trace.depth = 0;
+		trace.errors = 0;
+		s_check_e(extract_alloc_create(s_failing_realloc, &failing, &alloc), "extract_alloc_create()");
+		s_check_e(extract_begin(alloc, extract_format_HTML, &extract), "extract_begin()");
+		s_check_e(extract_set_stats(extract, 1), "extract_set_stats()");
+		s_check_e(extract_set_trace(extract, s_trace, &trace), "extract_set_trace()");
+		s_check_e(s_add_pages(extract), "s_add_pages()");
+		failing.fail_at = failing.allocs + fail_at;
+		e = extract_process(extract, 0 /*spacing*/, 0 /*rotation*/, 1 /*images*/);
+		if (trace.depth || trace.errors)
+		{
+			printf("    fail: trace events do not nest when allocation %i fails\n", fail_at);
+			s_num_fails += 1;
+		}
+		extract_end(&extract);
+		extract_alloc_destroy(&alloc);
+		if (!e) break;
+	}
+	s_check_e(fail_at == 0, "extract_process() with failing allocations");
+}
+
+static void s_check_double(double d)
+{
+	extract_astring_t string;
+	char              expected[512];
+	int               precision;
+
+	extract_astring_init(&string);
+	for (precision=0; precision<8; ++precision)
+	{
+		snprintf(expected, sizeof(expected), "%.*f", precision, d);
+		extract_astring_free(NULL, &string);
+		s_check_e(extract_astring_cat_double_f(NULL, &string, d, precision), "extract_astring_cat_double_f()");
+		if (strcmp(string.chars, expected))
+		{
+			printf("    fail: extract_astring_cat_double_f(): precision=%i expected=%s result=%s\n", precision, expected, string.chars);
+			s_num_fails += 1;
+		}
+	}
+	snprintf(expected, sizeof(expected), "%g", d);
+	extract_astring_free(NULL, &string);
+	s_check_e(extract_astring_cat_double_g(NULL, &string, d), "extract_astring_cat_double_g()");
+	if (strcmp(string.chars, expected))
+	{
+		printf("    fail: extract_astring_cat_double_g(): expected=%s result=%s\n", expected, string.chars);
+		s_num_fails += 1;
+	}
+	extract_astring_free(NULL, &string);
+}
+
+static void s_check_doubles(void)
+{
+	static const double ds[] =
+	{
+		0, -0.0, 1, -1, 0.5, 1.5, 2.5, 0.125, 0.0001, 0.00001, 0.000123456789,
+		999999.5, 999999.4, 99999.95, 123456.7, 1e6, 1e15, 1e300, -1e-300,
+		12.345, 0.045, 1.0/3, 2.0/3, 595.276, 841.89, 72.0/72.0
+	};
+	unsigned i;
+	unsigned seed = 1;
+
+	printf("testing extract_astring_cat_double_*():\n");
+	for (i=0; i<sizeof(ds) / sizeof(ds[0]); ++i)
+	{
+		s_check_double(ds[i]);
+	}
+	for (i=0; i<100000; ++i)
+	{
+		/* Simple LCG so that results are reproducible. */
+		double d;
+		seed = seed * 1103515245 + 12345;
+		d = (seed >> 8) / 16384.0 - 512;
+		s_check_double(d);
+		s_check_double(d / 1000);
+		s_check_double(d * 1000);
+		s_check_double((int) (d * 100) / 100.0);
+	}
+}
+
+static void s_check_unicode_array(void)
+{
+	/* Characters with a dummy member so that stride is not sizeof(unsigned). */
+	struct
+	{
+		unsigned    ucs;
+		double      x;
+	} chars[300];
+	int     flags;
+	int     i;
+
+	printf("testing extract_astring_cat_unicode_array():\n");
+	for (i=0; i<300; ++i)
+	{
+		chars[i].ucs = (unsigned) i;
+		chars[i].x = 0;
+	}
+	chars[200].ucs = 0xFB00;
+	chars[201].ucs = 0xFB03;
+	chars[202].ucs = 0x2212;
+	chars[203].ucs = 0x2019;
+	chars[204].ucs = 0x10000;
+	chars[205].ucs = 0x110000;
+	chars[206].ucs = (unsigned) -1;
+	chars[207].ucs = 0x800;
+
+	for (flags=0; flags<16; ++flags)
+	{
+		extract_astring_t expected;
+		extract_astring_t result;
+		extract_astring_init(&expected);
+		extract_astring_init(&result);
+		for (i=0; i<300; ++i)
+		{
+			s_check_e(extract_astring_catc_unicode(NULL, &expected, (int) chars[i].ucs,
+					flags & 1, flags & 2, flags & 4, flags & 8), "extract_astring_catc_unicode()");
+		}
+		s_check_e(extract_astring_cat_unicode_array(NULL, &result, &chars[0].ucs, 300, sizeof(chars[0]),
+				flags & 1, flags & 2, flags & 4, flags & 8), "extract_astring_cat_unicode_array()");
+		if (result.chars_num != expected.chars_num
+				|| memcmp(result.chars, expected.chars, expected.chars_num)
+				|| result.chars[result.chars_num] != 0)
+		{
+			printf("    fail: extract_astring_cat_unicode_array(): flags=%i\n", flags);
+			s_num_fails += 1;
+		}
+		extract_astring_free(NULL, &expected);
+		extract_astring_free(NULL, &result);
+	}
+}
+
 int main(void)
 {
 	printf("testing extract_xml_str_to_int():\n");
@@ -133,6 +988,30 @@ int main(void)
 
 	s_check_xml_parse();
 
+	s_check_xml_scan();
+
+	s_check_slice_numbers();
+
+	s_check_hex_decode();
+
+	s_check_astring();
+
+	s_check_trace_chrome();
+
+	s_check_alloc_accounting();
+
+	s_check_xml_accounting();
+
+	s_check_zip64();
+
+	s_check_image_repeats();
+
+	s_check_probes();
+
+	s_check_doubles();
+
+	s_check_unicode_array();
+
 	printf("s_num_fails=%i\n", s_num_fails);
 
 	if (s_num_fails) {
@@ -5,6 +5,9 @@ Caller must call things in a sensible order to create valid content -
 e.g. don't call odt_paragraph_start() twice without intervening call to
 odt_paragraph_finish(). */
 
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_OUTPUT
+
 #include "extract/extract.h"
 
 #include "odt_template.h"
@@ -53,21 +56,15 @@ extract_odt_styles_t struct. */
 
 struct extract_odt_style_t
 {
-	int     id; /* A unique id for this style. */
-	font_t  font;
-};
-
-struct extract_odt_styles_t
-{
-	/* Styles are stored sorted. */
-	extract_odt_style_t *styles;
-	int                  styles_num;
+	int         id; /* A unique id for this style. */
+	font_t      font;
+	unsigned    hash;
 };
 
 static int
 odt_style_compare(
-		extract_odt_style_t *a,
-		extract_odt_style_t *b)
+		const extract_odt_style_t *a,
+		const extract_odt_style_t *b)
 {
 	int d;
 	double dd;
@@ -80,6 +77,39 @@ odt_style_compare(
 	return 0;
 }
 
+/* For qsort(); sorts into descending order. */
+static int
+odt_style_compare_qsort(const void *a, const void *b)
+{
+	return odt_style_compare(
+			*(const extract_odt_style_t* const*) b,
+			*(const extract_odt_style_t* const*) a
+			);
+}
+
+/* FNV-1a hash of the fields compared by odt_style_compare(). */
+static unsigned
+odt_font_hash(const font_t *font)
+{
+	unsigned             hash = 2166136261u;
+	const unsigned char *p;
+	double               size = (font->size == 0) ? 0 : font->size; /* Normalise -0. */
+	size_t               i;
+
+	for (p = (const unsigned char*) font->name; *p; ++p)
+	{
+		hash = (hash ^ *p) * 16777619u;
+	}
+	p = (const unsigned char*) &size;
+	for (i=0; i<sizeof(size); ++i)
+	{
+		hash = (hash ^ p[i]) * 16777619u;
+	}
+	hash = (hash ^ (font->bold ? 1u : 0u)) * 16777619u;
+	hash = (hash ^ (font->italic ? 1u : 0u)) * 16777619u;
+	return hash;
+}
+
 static int
 odt_style_append_definition(
 		extract_alloc_t     *alloc,
@@ -96,7 +126,9 @@ odt_style_append_definition(
 	outf("style->font_name=%s font_name=%s", style->font.name, font_name);
 	if (extract_astring_catf(alloc, text, "<style:style style:name=\"T%i\" style:family=\"text\">", style->id)) return -1;
 	if (extract_astring_catf(alloc, text, "<style:text-properties style:font-name=\"%s\"", font_name)) return -1;
-	if (extract_astring_catf(alloc, text, " fo:font-size=\"%.2fpt\"", style->font.size)) return -1;
+	if (extract_astring_cat(alloc, text, " fo:font-size=\"")) return -1;
+	if (extract_astring_cat_double_f(alloc, text, style->font.size, 2)) return -1;
+	if (extract_astring_cat(alloc, text, "pt\"")) return -1;
 	if (extract_astring_catf(alloc, text, " fo:font-weight=\"%s\"", style->font.bold ? "bold" : "normal")) return -1;
 	if (extract_astring_catf(alloc, text, " fo:font-style=\"%s\"", style->font.italic ? "italic" : "normal")) return -1;
 	if (extract_astring_cat(alloc, text, " /></style:style>")) return -1;
@@ -117,6 +149,10 @@ extract_odt_styles_free(
 		extract_free(alloc, &style->font.name);
 	}
 	extract_free(alloc, &styles->styles);
+	extract_free(alloc, &styles->hash_table);
+	styles->styles_num = 0;
+	styles->styles_max = 0;
+	styles->hash_table_size = 0;
 }
 
 static int
@@ -125,12 +161,26 @@ odt_styles_definitions(
 		extract_odt_styles_t *styles,
 		extract_astring_t    *out)
 {
-	int i;
+	int                   e = -1;
+	int                   i;
+	extract_odt_style_t **sorted = NULL;
+
+	/* Write style definitions in descending order of font, independent of
+	the order in which styles were first used. */
+	if (extract_malloc(alloc, &sorted, sizeof(*sorted) * styles->styles_num)) goto end;
+	for (i=0; i<styles->styles_num; ++i)
+	{
+		sorted[i] = &styles->styles[i];
+	}
+	if (styles->styles_num)
+	{
+		qsort(sorted, styles->styles_num, sizeof(*sorted), odt_style_compare_qsort);
+	}
 
-	if (extract_astring_cat(alloc, out, "<office:automatic-styles>")) return -1;
+	if (extract_astring_cat(alloc, out, "<office:automatic-styles>")) goto end;
 	for (i=0; i<styles->styles_num; ++i)
 	{
-		if (odt_style_append_definition(alloc, &styles->styles[i], out)) return -1;
+		if (odt_style_append_definition(alloc, sorted[i], out)) goto end;
 	}
 	extract_astring_cat(alloc, out, "<style:style style:name=\"gr1\" style:family=\"graphic\">\n");
 	extract_astring_cat(alloc, out, "<style:graphic-properties"
@@ -179,9 +229,27 @@ odt_styles_definitions(
 			"/>\n");
 	extract_astring_cat(alloc, out, "</style:style>\n");
 
-	if (extract_astring_cat(alloc, out, "</office:automatic-styles>")) return -1;
+	if (extract_astring_cat(alloc, out, "</office:automatic-styles>")) goto end;
 
-	return 0;
+	e = 0;
+end:
+
+	extract_free(alloc, &sorted);
+	return e;
+}
+
+/* Inserts styles->styles[i] into styles->hash_table, which must have a free
+slot. */
+static void
+odt_styles_hash_insert(extract_odt_styles_t *styles, int i)
+{
+	unsigned mask = (unsigned) styles->hash_table_size - 1;
+	unsigned h;
+
+	for (h = styles->styles[i].hash & mask; styles->hash_table[h]; h = (h + 1) & mask)
+	{
+	}
+	styles->hash_table[h] = i + 1;
 }
 
 /* Adds specified style to <styles> if not already present. Sets *o_style to
@@ -193,31 +261,56 @@ odt_styles_add(
 	font_t               *font,
 	extract_odt_style_t **o_style)
 {
-	extract_odt_style_t style = {0 /*id*/, *font};
-	int i;
+	extract_odt_style_t  style = {0 /*id*/, *font, 0 /*hash*/};
+	extract_odt_style_t *s;
+	int                  i;
 
-	/* We keep styles->styles[] sorted; todo: use bsearch or similar when
-	searching. */
-	for (i=0; i<styles->styles_num; ++i)
+	style.hash = odt_font_hash(font);
+	if (styles->hash_table_size)
 	{
-		int d = odt_style_compare(&style, &styles->styles[i]);
-		if (d == 0)
+		unsigned mask = (unsigned) styles->hash_table_size - 1;
+		unsigned h;
+		for (h = style.hash & mask; styles->hash_table[h]; h = (h + 1) & mask)
 		{
-			*o_style = &styles->styles[i];
-			return 0;
+			s = &styles->styles[styles->hash_table[h] - 1];
+			if (s->hash == style.hash && !odt_style_compare(&style, s))
+			{
+				*o_style = s;
+				return 0;
+			}
 		}
-		if (d > 0) break;
 	}
-	/* Insert at position <i>. */
-	if (extract_realloc(alloc, &styles->styles, sizeof(styles->styles[0]) * (styles->styles_num+1))) return -1;
-	memmove(&styles->styles[i+1], &styles->styles[i], sizeof(styles->styles[0]) * (styles->styles_num - i));
+
+	/* Keep hash table at most half full. */
+	if ((styles->styles_num + 1) * 2 > styles->hash_table_size)
+	{
+		int hash_table_size = (styles->hash_table_size) ? styles->hash_table_size * 2 : 64;
+		extract_free(alloc, &styles->hash_table);
+		if (extract_malloc(alloc, &styles->hash_table, sizeof(*styles->hash_table) * hash_table_size)) return -1;
+		extract_bzero(styles->hash_table, sizeof(*styles->hash_table) * hash_table_size);
+		styles->hash_table_size = hash_table_size;
+		for (i=0; i<styles->styles_num; ++i)
+		{
+			odt_styles_hash_insert(styles, i);
+		}
+	}
+
+	if (styles->styles_num == styles->styles_max)
+	{
+		int styles_max = (styles->styles_max) ? styles->styles_max * 2 : 32;
+		if (extract_realloc(alloc, &styles->styles, sizeof(*styles->styles) * styles_max)) return -1;
+		styles->styles_max = styles_max;
+	}
+	s = &styles->styles[styles->styles_num];
+	s->id = styles->styles_num + 11; /* Leave space for template's built-in styles. */
+	if (extract_strdup(alloc, font->name, &s->font.name)) return -1;
+	s->font.size = font->size;
+	s->font.bold = font->bold;
+	s->font.italic = font->italic;
+	s->hash = style.hash;
 	styles->styles_num += 1;
-	styles->styles[i].id = styles->styles_num + 10; /* Leave space for template's built-in styles. */
-	if (extract_strdup(alloc, font->name, &styles->styles[i].font.name)) return -1;
-	styles->styles[i].font.size = font->size;
-	styles->styles[i].font.bold = font->bold;
-	styles->styles[i].font.italic = font->italic;
-	*o_style = &styles->styles[i];
+	odt_styles_hash_insert(styles, styles->styles_num - 1);
+	*o_style = s;
 
 	return 0;
 }
@@ -326,7 +419,6 @@ document_to_odt_content_paragraph(
 
 		for (span = content_span_iterator_init(&sit, &line->content); span != NULL; span = content_span_iterator_next(&sit))
 		{
-			int si;
 			double font_size_new;
 
 			content_state->ctm_prev = &span->ctm;
@@ -349,12 +441,13 @@ document_to_odt_content_paragraph(
 				if (extract_odt_run_start( alloc, content, styles, content_state)) goto end;
 			}
 
-			for (si=0; si<span->chars_num; ++si)
-			{
-				char_t* char_ = &span->chars[si];
-				int c = char_->ucs;
-				if (extract_astring_catc_unicode_xml(alloc, content, c)) goto end;
-			}
+			if (span->chars_num && extract_astring_cat_unicode_array_xml(
+					alloc,
+					content,
+					&span->chars[0].ucs,
+					span->chars_num,
+					sizeof(span->chars[0])
+					)) goto end;
 			/* Remove any trailing '-' at end of line. */
 			if (extract_astring_char_truncate_if(content, '-')) goto end;
 		}
@@ -659,7 +752,7 @@ end:
 }
 
 
-static int
+int
 extract_page_to_odt_content(
 		extract_alloc_t      *alloc,
 		extract_page_t       *page,
@@ -938,60 +1031,62 @@ extract_odt_write_template(
 		const char           *path_out,
 		int                   preserve_dir)
 {
-	int     e = -1;
-	int     i;
-	char*   path_tempdir = NULL;
-	char*   path = NULL;
-	char*   text = NULL;
-	char*   text2 = NULL;
-
+	int                   e = -1;
+	int                   i;
+	char                 *template_data = NULL;
+	size_t                template_data_length;
+	extract_zip_reader_t *reader = NULL;
+	extract_buffer_t     *buffer = NULL;
+	extract_zip_t        *zip = NULL;
+	char                 *name2 = NULL;
+	char                 *text = NULL;
+	char                 *text2 = NULL;
+
+	(void) preserve_dir;
 	assert(path_out);
 	assert(path_template);
 
-	if (extract_check_path_shell_safe(path_out))
+	outf("images->images_num=%i", images->images_num);
+	if (extract_read_all_path2(alloc, path_template, &template_data, &template_data_length))
 	{
-		outf("path_out is unsafe: %s", path_out);
+		outf("Failed to read template document: %s", path_template);
 		goto end;
 	}
+	if (extract_zip_reader_open(alloc, template_data, template_data_length, &reader)) goto end;
+	if (extract_buffer_open_file(alloc, path_out, 1 /*writable*/, &buffer)) goto end;
+	if (extract_zip_open(buffer, &zip)) goto end;
 
-	outf("images->images_num=%i", images->images_num);
-	if (extract_asprintf(alloc, &path_tempdir, "%s.dir", path_out) < 0) goto end;
-	if (extract_systemf(alloc, "rm -r '%s' 2>/dev/null", path_tempdir) < 0) goto end;
+	/* We modify just the items that we know extract_odt_content_item() will
+	modify, and copy all other items unchanged. */
 
-	if (extract_mkdir(path_tempdir, 0777))
+	for (i=0; i<extract_zip_reader_files_num(reader); ++i)
 	{
-		outf("Failed to create directory: %s", path_tempdir);
-		goto end;
-	}
+		const char *name = extract_zip_reader_file_name(reader, i);
+		int         j;
 
-	outf("Unzipping template document '%s' to tempdir: %s",
-			path_template, path_tempdir);
-	if (extract_systemf(alloc, "unzip -q -d '%s' '%s'", path_tempdir, path_template))
-	{
-		outf("Failed to unzip %s into %s",
-				path_template, path_tempdir);
-		goto end;
-	}
-
-	/* Might be nice to iterate through all items in path_tempdir, but for now
-	we look at just the items that we know extract_odt_content_item() will
-	modify. */
+		if (name[0] == 0 || name[strlen(name)-1] == '/')
+		{
+			/* Omit directory entries, like 'zip -D'. */
+			continue;
+		}
 
-	{
-		const char *names[] =
+		/* Omit items that will be replaced by our images. */
+		for (j=0; j<images->images_num; ++j)
 		{
-				"content.xml",
-				"META-INF/manifest.xml",
-		};
-		int names_num = sizeof(names) / sizeof(names[0]);
-		for (i=0; i<names_num; ++i)
+			extract_free(alloc, &name2);
+			if (extract_asprintf(alloc, &name2, "Pictures/%s", images->images[j]->name) < 0) goto end;
+			if (!strcmp(name, name2)) break;
+		}
+		if (j != images->images_num) continue;
+
+		if (0
+				|| !strcmp(name, "content.xml")
+				|| !strcmp(name, "META-INF/manifest.xml")
+				)
 		{
-			const char* name = names[i];
-			extract_free(alloc, &path);
 			extract_free(alloc, &text);
 			extract_free(alloc, &text2);
-			if (extract_asprintf(alloc, &path, "%s/%s", path_tempdir, name) < 0) goto end;
-			if (extract_read_all_path(alloc, path, &text)) goto end;
+			if (extract_zip_reader_read_file(reader, i, &text, NULL)) goto end;
 
 			outf("before extract_odt_content_item() styles->styles_num=%i", styles->styles_num);
 			if (extract_odt_content_item(
@@ -1013,51 +1108,40 @@ extract_odt_write_template(
 
 			{
 				const char* text3 = (text2) ? text2 : text;
-				if (extract_write_all(text3, strlen(text3), path)) goto end;
-				outf("have written to path=%s", path);
+				if (extract_zip_write_file(zip, text3, strlen(text3), name)) goto end;
 			}
 		}
+		else
+		{
+			if (extract_zip_copy_file(zip, reader, i)) goto end;
+		}
 	}
 
-	/* Copy images into <path_tempdir>/Pictures/. */
-	extract_free(alloc, &path);
-	if (extract_asprintf(alloc, &path, "%s/Pictures", path_tempdir) < 0) goto end;
-	if (extract_mkdir(path, 0777))
-	{
-		outf("Failed to mkdir %s", path);
-		goto end;
-	}
 	for (i=0; i<images->images_num; ++i)
 	{
 		image_t* image = images->images[i];
-		extract_free(alloc, &path);
-		if (extract_asprintf(alloc, &path, "%s/Pictures/%s", path_tempdir, image->name) < 0) goto end;
-		if (extract_write_all(image->data, image->data_size, path)) goto end;
+		void*    data;
+		int      e2;
+		extract_free(alloc, &name2);
+		if (extract_asprintf(alloc, &name2, "Pictures/%s", image->name) < 0) goto end;
+		if (extract_image_data_get(alloc, images, image, &data)) goto end;
+		e2 = extract_zip_write_file_method(zip, data, image->data_size, name2, extract_zip_method_for_type(image->type));
+		extract_image_data_release(alloc, image, data);
+		if (e2) goto end;
 	}
 
-	outf("Zipping tempdir to create %s", path_out);
-	{
-		const char* path_out_leaf = strrchr(path_out, '/');
-		if (!path_out_leaf) path_out_leaf = path_out;
-		if (extract_systemf(alloc, "cd '%s' && zip -q -r -D '../%s' .", path_tempdir, path_out_leaf))
-		{
-			outf("Zip command failed to convert '%s' directory into output file: %s",
-					path_tempdir, path_out);
-			goto end;
-		}
-	}
-
-	if (!preserve_dir)
-	{
-		if (extract_remove_directory(alloc, path_tempdir)) goto end;
-	}
+	if (extract_zip_close(&zip)) goto end;
+	if (extract_buffer_close(&buffer)) goto end;
 
 	e = 0;
 
 	end:
 	outf("e=%i", e);
-	extract_free(alloc, &path_tempdir);
-	extract_free(alloc, &path);
+	extract_zip_close(&zip);
+	extract_buffer_close(&buffer);
+	extract_zip_reader_close(&reader);
+	extract_free(alloc, &template_data);
+	extract_free(alloc, &name2);
 	extract_free(alloc, &text);
 	extract_free(alloc, &text2);
 
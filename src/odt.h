@@ -9,8 +9,13 @@ typedef struct extract_odt_style_t extract_odt_style_t;
 
 typedef struct
 {
-    extract_odt_style_t*    styles;
+    extract_odt_style_t*    styles;         /* In order of creation. */
     int                     styles_num;
+    int                     styles_max;
+    int*                    hash_table;     /* Open addressing; each entry
+                                            is zero or 1 + index into
+                                            .styles[]. */
+    int                     hash_table_size;/* Zero or a power of two. */
 } extract_odt_styles_t;
 
 void extract_odt_styles_free(extract_alloc_t* alloc, extract_odt_styles_t* styles);
@@ -32,6 +37,17 @@ Also writes style definitions to <o_styles>.
 <o_content> and <o_styles> can be passed to extract_odt_content_item() or
 extract_odt_write_template() to be inserted into an odt archive. */
 
+int extract_page_to_odt_content(
+        extract_alloc_t*    alloc,
+        extract_page_t*     page,
+        int                 spacing,
+        int                 rotation,
+        int                 images,
+        extract_astring_t*  output,
+        extract_odt_styles_t* styles
+        );
+/* Like extract_document_to_odt_content() but for a single page. */
+
 
 int extract_odt_write_template(
         extract_alloc_t*    alloc,
@@ -45,7 +61,8 @@ int extract_odt_write_template(
         );
 /* Creates a new odt file using a provided template document.
 
-Uses the 'zip' and 'unzip' commands internally.
+We read the template in memory, modify the items that contain content and copy
+all other items directly without decompression/recompression.
 
 contents
 contentss_num
@@ -57,12 +74,9 @@ images
 path_template
     Name of odt file to use as a template.
 path_out
-    Name of odt file to create. Must not contain single-quote, double quote,
-    space or ".." sequence - these will force EINVAL error because they could
-    make internal shell commands unsafe.
+    Name of odt file to create.
 preserve_dir
-    If true, we don't delete the temporary directory <path_out>.dir containing
-    unzipped odt content.
+    Ignored; we no longer use a temporary directory.
 */
 
 
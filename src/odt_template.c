@@ -2,6 +2,8 @@
 
 #include "odt_template.h"
 
+#include <stddef.h>
+
 const odt_template_item_t odt_template_items[] =
 {
     {
@@ -24,7 +26,60 @@ const odt_template_item_t odt_template_items[] =
                 "<text:sequence-decl text:display-outline-level=\"0\" text:name=\"Text\"/>"
                 "<text:sequence-decl text:display-outline-level=\"0\" text:name=\"Drawing\"/>"
                 "<text:sequence-decl text:display-outline-level=\"0\" text:name=\"Figure\"/></text:sequence-decls>"
-                "<text:p text:style-name=\"Standard\"/></office:text></office:body></office:document-content>"
+                "<text:p text:style-name=\"Standard\"/></office:text></office:body></office:document-content>",
+        "\xa5\x57\xc1\x8e\xda\x30\x10\xbd\xf7\x2b\x50\x2a\xf5\x96\x35"
+        "\x2c\xad\x54\x52\x60\x2f\xd5\x4a\x95\x76\x2f\xdd\x5d\xa9\x57\xaf"
+        "\xed\x04\xab\x8e\x9d\xda\x0e\x81\xbf\xef\xd8\x26\x21\xa1\x04\xac"
+        "\x72\x01\xe2\x79\x6f\x66\x32\xf3\x3c\x36\xcb\x87\x5d\x29\x26\x5b"
+        "\xa6\x0d\x57\x72\x95\xcc\xee\xa6\xc9\x84\x49\xa2\x28\x97\xc5\x2a"
+        "\x79\x7b\x7d\x4c\xbf\x26\x0f\xeb\x0f\x4b\x95\xe7\x9c\xb0\x8c\x2a"
+        "\x52\x97\x4c\xda\x94\x28\x69\xe1\x7b\x02\x6c\x69\x32\x62\xcc\xdc"
+        "\xae\x92\x8d\xb5\x55\x86\x50\xd3\x34\x77\xcd\xfc\x4e\xe9\x02\xbd"
+        "\xfe\x44\xce\x96\x5a\xb6\xb3\x28\x39\xa0\x0b\x4d\xa9\x38\x87\xbe"
+        "\x9f\x4e\xe7\xa8\x40\x14\x5b\x9c\x6e\x39\x6b\x3e\xb6\x8c\xdd\xc6"
+        "\x96\x67\x19\xb3\xc5\x62\x81\xbc\xb5\x83\x1a\x3e\xe2\x7a\x86\x7e"
+        "\x3d\x3f\xbd\x90\x0d\x2b\x71\xca\xa5\xb1\x58\x12\x76\x64\xd1\xeb"
+        "\xac\x0e\x9c\x2b\x5d\x9a\x11\xfc\x3d\x0a\xe6\x16\x4c\x55\x39\xea"
+        "\x19\x10\x29\xdb\x42\x19\x3b\xb4\x21\x9a\x57\x50\xc9\x5a\xcb\x4c"
+        "\x61\xc3\x4d\x26\x71\xc9\x4c\x66\x49\xa6\x2a\x26\xdb\xf2\x67\x7d"
+        "\x74\xe6\x9b\x16\x56\x5c\xe8\x58\xb6\xc3\xf6\xb9\x25\xb6\x9b\x91"
+        "\x1a\x7f\x45\xcf\x60\xf4\x1f\xcf\x4f\x2d\x5e\xd6\xe5\x3b\xd3\xb1"
+        "\xd1\x5c\x53\x8d\xdd\x0b\x36\x48\x97\x33\x41\x0f\x1e\x80\x72\x10"
+        "\x59\x70\xc3\x76\x15\xd3\xdc\x79\xc0\x22\x53\x4a\xa5\xa5\x81\xb6"
+        "\x59\xa6\x55\x95\xf5\xd8\x83\x37\x60\x16\xc7\xe6\xe3\xb0\x7d\xae"
+        "\x50\x20\xd1\x03\x59\x17\x9d\xd0\x73\x55\x4b\x48\x1d\x36\xc7\xd9"
+        "\xb4\x42\xc2\x3d\x0f\x7d\x97\xc1\x0a\xa9\x77\x55\x3d\xbe\x64\x2b"
+        "\x82\x05\x0a\xcf\x2d\xc7\xe2\x77\xc1\x62\xdf\xc1\x83\xfb\x11\xc9"
+        "\x06\xeb\x68\xf5\x78\x70\x9f\xed\xdd\x5d\x4b\xd7\x83\x3a\x71\x6b"
+        "\xdc\x44\x0b\x00\xb0\x30\x54\xfa\x01\x75\x65\x2f\xc4\xfa\x82\x34"
+        "\xab\x94\xb6\xc7\x60\x73\x1a\x1f\x6c\x4e\x87\xad\x88\x65\xaa\x1c"
+        "\x78\xf7\x5d\x49\x8e\xa2\xb8\xde\x8d\x93\xf6\x7b\xb5\x47\x6f\xe5"
+        "\xd3\xad\x41\x49\x57\x9a\xaa\xd6\xc2\x17\x85\x12\xc4\x04\x73\x2c"
+        "\x83\x66\x77\xb3\x6e\xa0\x12\x2c\xc8\x7f\xa8\xd7\xd1\xb2\x81\x87"
+        "\x41\xc9\x94\x22\x17\xba\xf3\x19\x39\x4e\x5f\x08\x17\x95\x33\x9b"
+        "\x22\x87\xe9\x46\xa8\xe0\xf2\xf7\xf8\x40\x77\xd6\x5e\x1e\x17\xd3"
+        "\x18\xee\x1f\x40\x37\x17\xe1\x8d\xe6\x30\x43\x8e\xf3\x32\xb6\x41"
+        "\x3b\x23\xd2\x5c\xc1\xb9\x57\x56\x50\xd0\x93\x7d\xe7\x46\xe9\x2e"
+        "\x6e\x8e\xb9\x99\xaf\x68\x7e\x3a\xca\x4e\x66\xb1\xd9\x16\xd1\xca"
+        "\xd9\x16\x23\x59\x85\x34\xe2\x85\xef\x93\xf6\xfc\xc3\xef\xde\xb5"
+        "\x60\x9e\xac\xdb\x3b\x40\x38\x75\x0c\xea\x16\x72\xb8\x0b\xa4\x39"
+        "\x26\x2c\xa5\x8c\x08\xb3\x5e\x06\x31\x77\xcb\x93\xf0\xec\x82\xaf"
+        "\x92\x27\x0e\x87\x86\x97\xe4\xe4\x05\xea\x92\x27\x13\x78\x81\x16"
+        "\x5b\x72\xb1\x5f\x25\x9f\x70\xa5\xcc\xb7\x53\x60\x58\x4d\x26\x03"
+        "\xe7\x8e\x90\x16\x4c\x02\x00\xc4\xaa\x55\x89\xe5\x00\x51\x71\x4b"
+        "\xe0\x50\xdb\x62\xcd\xfd\xdc\x42\xf1\xc9\x61\x69\xa2\x72\x03\x5c"
+        "\x44\x6a\xa6\xe1\xc6\xdc\x92\xda\x9b\xe4\xce\x70\x26\xa5\xa3\xe5"
+        "\x42\xf8\xbd\xb1\xac\xbc\x16\x1f\x8d\x35\xf4\xb0\x8e\x6b\x0b\x15"
+        "\xb6\x9c\xa4\xde\x4f\x4f\x02\xef\x8a\xee\xbb\x07\x37\x08\xd7\x4b"
+        "\x3f\x0e\x0d\xfb\x53\xc3\x75\xb2\x73\xf4\xef\xe2\xc4\x2f\x51\x6e"
+        "\x2a\x81\xf7\xa9\xaa\x2d\xec\x7d\x96\x0a\xb8\x16\xc1\x85\x0f\xa4"
+        "\xe8\xcd\xa1\x04\x3f\x84\xa8\x8d\x0d\x75\x77\xe9\xde\xe4\xec\xb5"
+        "\x7d\xe9\xdb\xbc\xc0\xcf\x9b\x9d\x7c\x0f\x27\xe3\xcd\x7e\x1e\x79"
+        "\x51\xeb\xd0\xc8\xf1\xe2\x57\x81\xe1\x1b\x98\x06\xde\x0b\x5c\x85"
+        "\x29\xd6\xb4\x2f\x81\xd0\x43\x34\x68\x2f\x1a\xf9\x13\xb0\xfe\x0b",
+        799,
+        3141,
+        0x346b3cfa
     },
 
     {
@@ -85,7 +140,8 @@ const odt_template_item_t odt_template_items[] =
         "\x65\x74\x61\x2f\x70\x6b\x67\x23\x44\x6f\x63\x75\x6d\x65\x6e\x74"
         "\x22\x2f\x3e\x0a\x20\x20\x3c\x2f\x72\x64\x66\x3a\x44\x65\x73\x63"
         "\x72\x69\x70\x74\x69\x6f\x6e\x3e\x0a\x3c\x2f\x72\x64\x66\x3a\x52"
-        "\x44\x46\x3e\x0a"
+        "\x44\x46\x3e\x0a",
+        NULL, 0, 0, 0
     },
 
     {
@@ -100,14 +156,47 @@ const odt_template_item_t odt_template_items[] =
                 "<dc:date>2021-04-06T17:14:51.409959656</dc:date>"
                 "<meta:editing-duration>PT20S</meta:editing-duration>"
                 "<meta:editing-cycles>1</meta:editing-cycles>"
-                "<meta:document-statistic meta:table-count=\"0\" meta:image-count=\"0\" meta:object-count=\"0\" meta:page-count=\"1\" meta:paragraph-count=\"0\" meta:word-count=\"0\" meta:character-count=\"0\" meta:non-whitespace-character-count=\"0\"/></office:meta></office:document-meta>"
+                "<meta:document-statistic meta:table-count=\"0\" meta:image-count=\"0\" meta:object-count=\"0\" meta:page-count=\"1\" meta:paragraph-count=\"0\" meta:word-count=\"0\" meta:character-count=\"0\" meta:non-whitespace-character-count=\"0\"/></office:meta></office:document-meta>",
+        "\x8d\x93\xcb\x6e\xdb\x30\x10\x45\xf7\xfd\x0a\x43\xcd\x56\x22"
+        "\xa9\x97\x2d\x42\x52\x80\xa0\xe8\xaa\x40\x0a\xc4\x01\xba\x33\x68"
+        "\x72\x22\xb3\x95\x49\x81\xa2\xa2\xf4\xef\x4b\xbd\x1c\xbf\x16\xdd"
+        "\x89\x33\x67\xe6\xde\x19\x52\xf9\xe3\xc7\xb1\x5e\xbd\x83\x69\xa5"
+        "\x56\x85\x47\x02\xec\xad\x40\x71\x2d\xa4\xaa\x0a\xef\x75\xfb\xdd"
+        "\xdf\x78\x8f\xe5\x97\x5c\xbf\xbd\x49\x0e\x54\x68\xde\x1d\x41\x59"
+        "\xff\x08\x96\xad\x5c\xa9\x6a\x69\x65\x84\xa8\x0b\xef\x60\x6d\x43"
+        "\x11\xea\xfb\x3e\xe8\xa3\x40\x9b\x0a\x85\x18\x47\xa8\x42\x82\x59"
+        "\xe6\xbf\x4b\xe8\xbf\x7a\x73\xc5\x50\x5c\x78\x9d\x51\x54\xb3\x56"
+        "\xb6\x54\xb1\x23\xb4\xd4\x72\xaa\x1b\x50\x8b\x04\xfd\x64\xe9\x68"
+        "\x6b\x3a\x6b\xad\x4f\x5a\x03\x3e\x19\x5b\xf4\x62\x34\x9d\x17\x5a"
+        "\xf0\x13\xdc\x74\xa6\x1e\x31\xc1\x11\xd4\x30\x48\xb4\x88\x04\x04"
+        "\x2d\xec\x47\x2d\xd5\x9f\x7b\x73\x90\x2c\xcb\xd0\x98\x3d\x99\x18"
+        "\x45\xfe\x77\x84\x79\x77\xe3\x10\xf3\xf7\xd9\xc2\x23\xaf\x5c\xb6"
+        "\x3b\xcc\x5a\xe6\xe3\xc4\xdc\x00\xb3\x8e\xf0\xdd\xf6\xa0\x0c\x71"
+        "\x48\x7c\x1c\xfb\x38\xd9\x92\x35\xc5\x29\x4d\xd6\x41\x16\xad\x49"
+        "\xb4\xc6\xc9\x26\x47\x77\x2a\xa6\x2e\x15\x28\x30\xcc\x6a\x53\xfe"
+        "\x90\x7b\x03\xcf\xa3\x0c\x5a\x07\x38\x20\x41\xf8\xf0\xec\xac\x3e"
+        "\xbd\x7c\xdb\xfd\xda\xa4\xbb\x34\x5e\x9d\x21\xbb\xc6\xe8\xdf\xc0"
+        "\x2d\xc2\xf8\xe1\xa9\x93\xb5\xf0\xc3\x59\xe5\xb3\x63\x2e\x38\xbd"
+        "\x34\x97\x0e\xe6\x48\x4c\x13\x12\xc4\x38\xcb\x92\x2c\x4d\xd2\x1c"
+        "\x2d\xd8\xe4\x08\x84\xb4\xee\x69\xf9\xa2\x33\xa3\xdb\xf2\xe7\x36"
+        "\xc4\x2f\x73\xf3\x9b\xe4\x65\x0d\xff\xcb\x6b\x68\x4b\x72\x45\xcf"
+        "\xe1\x89\x3d\x3d\xd0\xd6\xba\x16\xad\x95\x7c\x35\xc6\x2d\xdb\xd7"
+        "\xe0\x73\xdd\x29\x5b\x78\xee\x1e\xc6\xa0\x3c\xb2\xea\x26\xa8\xf7"
+        "\xc3\xe4\xd7\xd1\xe6\x8c\x24\xa7\x98\x61\x95\x61\xcd\xe1\x1a\xee"
+        "\xb5\x11\xd7\x31\x7e\x70\x34\xb7\x60\xae\x13\xca\x5d\x59\x7f\x90"
+        "\x16\xda\x86\x71\xa7\x71\xcb\xa1\x32\x47\x17\x2f\x04\xdd\xfb\x1b"
+        "\xcb\x7f",
+        449,
+        971,
+        0xf0b1c859
     },
 
     {
         "mimetype",
         "\x61\x70\x70\x6c\x69\x63\x61\x74\x69\x6f\x6e\x2f\x76\x6e\x64"
         "\x2e\x6f\x61\x73\x69\x73\x2e\x6f\x70\x65\x6e\x64\x6f\x63\x75\x6d"
-        "\x65\x6e\x74\x2e\x74\x65\x78\x74"
+        "\x65\x6e\x74\x2e\x74\x65\x78\x74",
+        NULL, 0, 0, 0
     },
 
     {
@@ -236,7 +325,121 @@ const odt_template_item_t odt_template_items[] =
                 "<config:config-item config:name=\"UseOldNumbering\" config:type=\"boolean\">false</config:config-item>"
                 "<config:config-item config:name=\"UseFormerObjectPositioning\" config:type=\"boolean\">false</config:config-item>"
                 "<config:config-item config:name=\"ChartAutoUpdate\" config:type=\"boolean\">true</config:config-item>"
-                "<config:config-item config:name=\"AddParaTableSpacing\" config:type=\"boolean\">true</config:config-item></config:config-item-set></office:settings></office:document-settings>"
+                "<config:config-item config:name=\"AddParaTableSpacing\" config:type=\"boolean\">true</config:config-item></config:config-item-set></office:settings></office:document-settings>",
+        "\xb5\x5a\x5d\x73\x1a\x3b\x0c\x7d\xbf\xbf\x22\xc3\x7b\x4a\xbe"
+        "\xdb\x30\x49\x3a\x40\x4a\x4b\x4b\x42\x06\x48\x33\xb7\x6f\x66\x57"
+        "\x80\x1b\xaf\xb5\x63\x7b\x03\xfc\xfb\x2b\x9b\x85\xe6\x12\xb6\xa5"
+        "\x0b\x7a\x4a\xd8\xf5\x4a\xb6\x2c\xe9\x1c\xc9\xbe\xfa\x38\x4b\xd4"
+        "\xc1\x0b\x18\x2b\x51\x5f\x57\x8e\xdf\x1d\x55\x0e\x40\x47\x18\x4b"
+        "\x3d\xbe\xae\x3c\x0e\x5a\x87\x1f\x2a\x1f\x6f\xfe\xb9\xc2\xd1\x48"
+        "\x46\x50\x8b\x31\xca\x12\xd0\xee\xd0\x82\x73\x34\xc4\x1e\xd0\xe7"
+        "\xda\xd6\x22\xd4\x23\x49\x1f\x64\x46\xd7\x50\x58\x69\x6b\x5a\x24"
+        "\x60\x6b\x2e\xaa\x61\x0a\x7a\xf9\x59\xed\xf5\xe8\x5a\x50\xb6\x78"
+        "\x32\x53\x52\x3f\x5f\x57\x26\xce\xa5\xb5\x6a\x75\x3a\x9d\xbe\x9b"
+        "\x9e\xbe\x43\x33\xae\x1e\x5f\x5e\x5e\x56\xc3\xdb\xe5\x50\x44\x5c"
+        "\x0d\xf4\xb2\x17\x33\x0b\x83\x4f\x8e\x8e\xce\xaa\x8b\xdf\xab\xd1"
+        "\xe1\xd7\xb6\x13\xcb\x57\x19\x26\x96\xff\xff\xca\x34\xa7\x95\x9b"
+        "\xa5\x1d\x96\xcb\xbf\xb9\xca\xd7\xb2\xf8\x73\x28\x1d\x24\xde\x36"
+        "\x07\xf9\x63\xaf\xec\xba\x42\x53\xae\xbd\x48\x98\xae\xac\x56\xd9"
+        "\xf4\xdd\xff\xbf\xf9\x4e\xe3\xeb\x06\xc4\x00\xd3\xca\xf2\x8d\x9b"
+        "\xa7\xf4\x46\xa1\x1e\x57\x6e\x8e\xae\xaa\x6f\x45\x6c\x2f\xb6\x03"
+        "\x23\xc7\x21\xf7\x49\xc6\x6e\xb2\x51\xf0\xc9\xc5\xc9\xfb\xf3\xdd"
+        "\x84\x7f\x01\x39\x9e\x6c\x9e\xf6\xf1\xe5\xf9\xd1\x49\x39\xe9\xfd"
+        "\x09\x4e\x7b\x10\x93\x8f\x41\x73\x22\xf4\x18\xec\x9a\x86\x21\xa2"
+        "\x02\xa1\x2b\x37\xce\x64\x50\x4e\x47\x5b\x37\x0c\x4e\x2d\xdc\x61"
+        "\x0c\x45\xd2\x47\x42\xd9\xad\xc5\x1f\x26\x22\x3d\x94\x3a\x86\x19"
+        "\xc4\x6f\x8d\xb5\xd9\xc1\xc2\x37\xe4\xec\x66\xbe\x9d\xc9\xdb\xf1"
+        "\xda\x54\xad\x33\xd2\x1b\xdb\xfb\x72\x49\x63\x7b\xb9\x85\xbe\x77"
+        "\x76\x7a\x76\x5a\x5e\x6c\x51\xa4\x9c\x9c\x1f\x1d\x97\x95\x6a\xe5"
+        "\x50\xc1\xfe\x63\x25\x88\xdd\x7b\x64\x07\xa9\xbd\xc2\x10\xf1\x01"
+        "\x58\xda\xbc\x41\x76\x03\x9d\xc3\xa4\x30\xfe\x4a\x4e\xfc\x07\x62"
+        "\x32\x20\x51\xeb\xce\x36\x41\xe3\x76\xca\x47\x1d\x31\xc7\xcc\x35"
+        "\x51\x65\x89\x5e\x8f\xe9\x5c\x7a\x69\xc7\x58\x4a\x6f\x20\x3e\xef"
+        "\x2d\xa8\xdf\xda\xa5\x25\x22\x87\xa6\x60\xee\x65\x0d\xde\xb6\x7d"
+        "\x50\x10\x39\x88\x5b\x86\x1e\x30\x4c\xbd\xae\x23\x9a\x23\xc4\x03"
+        "\x98\xb9\x2e\x21\xe8\x48\x21\x45\xfd\x58\x44\xf3\x12\xca\x36\x3c"
+        "\x7c\x9d\xc9\x8a\x5e\xe7\xc9\x71\xf3\x00\x02\xe2\xed\xa1\x7b\xf1"
+        "\x20\x33\xc2\x11\x11\xf8\x1b\x0c\x7f\xa0\x74\xe9\x1a\x4a\x44\xcf"
+        "\x2d\xd4\xae\x10\x56\x76\x30\x74\xd0\xd0\x03\x4f\x52\x60\x3d\x5b"
+        "\xef\x43\x7e\x5f\xbc\xc0\x60\x92\x25\x43\x2d\xa4\xda\x3f\x2c\x7e"
+        "\x4a\x86\xe4\x84\x9c\xb6\x69\x92\x70\x83\x8a\x01\xd2\xbb\x99\xf3"
+        "\x94\xa1\x43\xc6\x57\xff\x4a\x50\xb1\xbd\x27\x3b\x41\x40\x48\xa6"
+        "\xc5\x3c\x88\x31\x34\xc8\x9b\xc6\x06\x33\x5d\xb8\xdd\xe5\x97\x14"
+        "\x94\xd4\xb5\x46\x17\x5c\x7d\x43\x5e\xdb\x2d\x29\x07\xf9\x9f\x8d"
+        "\x48\x27\x32\x62\xd8\x91\xe0\x4d\x31\xc4\xb7\xc2\x89\xa1\xb0\x70"
+        "\xff\x36\xb9\xe5\x0c\xa6\xba\xcd\x5c\xd1\x51\x8e\x6c\xa1\x59\x07"
+        "\xbc\xbd\x6d\xa7\xe7\x15\x7e\x4b\x19\x4c\xb1\x70\x17\x83\x36\xa5"
+        "\x35\x70\xcd\xff\x8b\x24\x6b\x6b\x9f\xe3\xd9\x32\x9b\x27\x33\x9c"
+        "\x26\x6a\x89\xd9\x8e\x5e\x12\xc2\x32\x05\xd3\x32\x98\xf4\xc1\x65"
+        "\xeb\x9c\x6e\x1f\xb6\x18\x88\xa1\xed\x81\xa2\xa0\xa4\x6c\x8c\x6d"
+        "\x02\x36\x5d\x68\xf2\xf2\x06\xc9\x6b\xa0\xdc\xf1\x29\xfe\xbf\xc1"
+        "\x1b\xb8\xa6\xa8\xba\x38\x6b\x48\x2d\xcc\x7c\x6b\xf3\x78\x07\x79"
+        "\x20\x10\x84\x09\xaa\x18\xd6\xc9\xcc\x3e\xec\x73\x27\xdc\xa4\x41"
+        "\x53\xf3\xd3\xaf\x2b\x39\xd6\x09\x8b\x81\x72\xcb\x78\xca\x97\x08"
+        "\xf3\xcc\x81\x59\xed\xb1\x26\xde\xe4\xf7\xbb\xae\x63\x62\x0e\xfa"
+        "\xd9\x52\x06\xea\xf8\xd2\x54\xa8\x28\x53\x21\x2f\x33\xe8\xf5\x30"
+        "\x29\x75\x86\x99\xfd\xa4\x63\xca\xff\xc5\x01\xb7\x83\x92\x96\x47"
+        "\xc9\x7a\xe6\xf0\x31\x8d\x85\x2b\xe4\x9d\xbb\x00\x40\xea\xe6\xb7"
+        "\xc3\xa0\x87\x92\x13\xd8\x07\x61\xc4\xfe\xd5\xd4\xd3\x54\xcd\xbd"
+        "\xe8\xb1\x87\xb2\x3b\x72\x05\x8f\x12\xc2\x0d\x90\x9d\x01\x84\x15"
+        "\x32\x25\x44\xf2\x3a\xcf\xd5\x69\x3d\x63\xc9\xe1\x63\x01\x9e\xeb"
+        "\x56\x0a\xdd\x8f\x8c\x4c\xdd\x6f\x79\xdf\x8e\x2c\xa0\x43\x81\xc2"
+        "\xab\xe6\x56\x5a\x41\x25\x71\x77\x34\xf2\xdb\xf1\x80\x56\xfa\xd0"
+        "\xe4\xd9\xfa\xb0\xa4\xae\x56\xf3\x47\xcb\x47\x97\xef\xec\x13\x9a"
+        "\xb8\x89\x49\x7a\x27\xb5\xcf\x38\x8b\x6e\x5b\x63\xde\x52\x65\xaa"
+        "\xb6\x3f\xa9\xeb\x67\x26\xb0\x58\x8f\x0e\x4f\x14\x47\xfd\x44\xa8"
+        "\xc2\x0a\x63\x07\x3d\xbf\xf8\xb2\x8f\x58\xef\xe0\xb7\x46\x4c\x43"
+        "\x01\xc7\x90\x46\x95\x4c\x53\x88\x1f\x64\xe4\x32\xc3\x93\x43\x15"
+        "\x0a\xe7\xbc\xe7\xdd\x63\x12\x22\x95\x43\xcb\xa3\x1e\x1a\x10\xcf"
+        "\x41\xcd\x32\xa5\x71\xe8\x09\x8e\xdd\x9f\x5b\x7a\xc1\xe5\xd6\x79"
+        "\x56\xf3\x1d\x08\x26\x0e\x39\xf0\x66\xe2\x22\xa8\x7f\x72\xd6\xf2"
+        "\xe2\x09\xf2\x2d\x61\xa4\x59\x06\x60\x57\x77\x87\x3f\x29\x8f\x71"
+        "\x41\x57\x9f\x96\xa1\xe0\x2b\x0e\x39\x34\x84\xec\xd1\x14\xa9\x7d"
+        "\x00\x13\x11\xf9\xa3\x94\x7c\x71\xc1\xc2\x93\x94\x22\x2d\x10\x70"
+        "\xb8\x09\x4a\xf1\x30\x8c\x2f\x20\x68\x67\xfa\xa9\x88\xc8\x68\x0d"
+        "\xf0\xdd\x33\x61\xdd\xef\x74\xed\xb0\xa6\x1e\xb9\x41\x0f\x71\x9d"
+        "\x30\xd3\x96\x55\x6e\x4e\x8e\xce\x4f\x2e\xcf\x2e\x76\xd8\x76\x5a"
+        "\xc6\xa6\xaa\xe8\x2f\x0b\x89\x26\xa1\x05\x6d\xeb\xb2\xb2\x27\x94"
+        "\x4a\xc4\x9b\x0e\xc8\xf6\x65\x5b\x28\x12\x28\x6e\xfb\x0e\xd3\x25"
+        "\x74\x33\x44\x18\xa1\x41\xdd\x36\x27\xb4\x6d\x11\xd9\x61\xd9\x14"
+        "\x7d\x32\x34\xd4\x10\xaa\x86\xee\x2b\x47\x34\xdc\xe2\x3d\x3a\x8a"
+        "\x06\x0f\x42\x3e\x81\x50\x60\xdb\xae\xf6\x3c\x85\xa9\x45\xf8\x59"
+        "\xe1\x50\xa8\xdb\xfc\x30\x95\xc8\x03\x4b\x71\xb4\xd9\x09\x36\x1c"
+        "\x1d\x04\xd7\x2d\xd9\xa3\xea\xa0\x88\x7b\x14\x7e\xa8\x59\x68\x4f"
+        "\xd8\x9a\x1e\x58\x08\xd1\x5c\x77\xce\xf8\x02\x8f\x40\xd6\xe3\x1f"
+        "\xc7\xee\xb8\x39\x81\xd3\x3d\xde\xc2\x48\x64\x8a\x43\x83\xdf\xed"
+        "\x45\x41\x57\xdc\x2f\x2c\x79\xcc\x12\x8c\xf5\x35\xb3\x4e\x8e\xe6"
+        "\x9e\x91\xda\x27\xe9\xa8\xde\xd2\x99\x50\x0d\xcf\x4f\x58\xa0\x0a"
+        "\x53\xaf\x2a\xcf\xbd\xfd\x89\xf1\xce\xdc\x92\xc6\x7a\xb7\x66\xa8"
+        "\x59\x29\x0b\xd5\x43\x27\x70\xd1\xd6\x21\x67\x58\x55\x96\xb6\x4d"
+        "\x3c\xdc\xf2\x34\xd7\x16\xcd\xcd\xd0\xb6\x66\xe1\x8f\x33\x5a\x48"
+        "\x04\x3f\xc0\xe0\xa7\x19\x2d\x4f\xc4\x3c\x95\xd1\x5a\x4a\xf0\x7f"
+        "\xfb\x98\x99\xa8\x7c\x47\x8f\x4a\x2c\x5f\xcd\xff\xe2\x45\x29\xcf"
+        "\xcc\x57\x7a\x5e\x79\x1b\xc7\x49\x9c\x22\xf2\x10\x80\x98\x98\x57"
+        "\x53\xe8\x08\x18\x8e\x71\xfa\xd9\xd0\x79\x8c\x23\x4c\xb3\x4b\x94"
+        "\xab\x87\x5f\x1c\x2b\x8a\x43\x25\x97\x9b\x6c\x80\x81\x7e\x7b\x2a"
+        "\xc6\xc0\x91\x49\x17\xb9\x2f\x18\x2d\xd4\x1f\x7c\x78\x87\xb6\x2b"
+        "\xd1\xaf\x8d\xd4\xeb\xf8\xfd\x87\x0f\xe7\x25\xaf\x59\xd0\xc4\xbf"
+        "\x83\x71\x32\x12\x2a\xb0\x8c\xee\x68\x44\x90\xc3\x52\x5f\x51\x22"
+        "\xce\xb9\xfd\xe2\xa4\x3d\x64\xe6\xba\x0d\x67\x55\x4c\x49\x9a\x56"
+        "\xc7\xbc\xaa\xb6\xed\x88\x21\xac\x18\x0d\x6b\xbb\x65\x60\x84\x54"
+        "\x9e\xe7\x87\x76\x2f\x57\xf9\x05\x86\xfd\x98\x62\xd1\xbc\x5e\x61"
+        "\xe5\x02\xd0\xda\x9a\xbd\x29\x0a\x66\xa7\x33\x9c\xb6\xfd\x46\x11"
+        "\x1e\x1a\x93\x0f\x99\x8e\x5c\xc6\xd5\x64\xcf\x27\xeb\xed\xe2\xaf"
+        "\x1e\x7a\xa6\x1c\xee\x90\x14\xdc\xb2\x9a\xc8\xf1\xe4\xd0\x80\xa5"
+        "\xa8\xf2\x13\x2a\x4d\x2f\x14\xf4\x70\xfa\x0d\x80\x63\xcb\x17\xc4"
+        "\xcf\x3b\xd5\x00\x92\x54\x31\x75\xf5\x87\x10\x02\x45\xc1\x8c\xb5"
+        "\xa5\x4b\x90\xdc\x55\x71\xbe\x4b\x77\x40\xdb\x50\x7c\x4a\xbd\x4b"
+        "\x98\xe8\x17\x4a\xcd\x0d\x8a\xfe\x55\x89\xcf\x76\x61\x20\x3f\x01"
+        "\xee\x0d\x3a\x1c\x69\xd8\x9f\x83\x90\xd1\x8c\xa7\x5d\x2c\xe0\xeb"
+        "\x81\x3e\x78\x70\x6e\xa7\xba\xeb\x3b\x61\x18\x8e\xf6\x7c\x11\xfb"
+        "\x7d\x71\xd3\xb7\xab\x9b\x0a\x2d\x47\xa5\xbc\xea\x04\x78\x67\xa6"
+        "\xc0\xf6\xda\xf6\x7e\xf1\x6d\xe1\xc4\x9c\x39\x77\xc5\x5c\xbb\xc3"
+        "\x9f\xe4\x5b\xbc\x47\x1f\xde\x66\x8e\xf3\xcc\x70\x83\x97\xfd\xbd"
+        "\x92\xc2\x2b\x66\xd5\x37\xf7\xc5\xab\x45\x37\xe9\x6f\xfe\x03",
+        1774,
+        12171,
+        0x34b64795
     },
 
     {
@@ -318,7 +521,140 @@ const odt_template_item_t odt_template_items[] =
                 "<style:header-style/>"
                 "<style:footer-style/></style:page-layout></office:automatic-styles>"
                 "<office:master-styles>"
-                "<style:master-page style:name=\"Standard\" style:page-layout-name=\"Mpm1\"/></office:master-styles></office:document-styles>"
+                "<style:master-page style:name=\"Standard\" style:page-layout-name=\"Mpm1\"/></office:master-styles></office:document-styles>",
+        "\xed\x5a\x59\xaf\xdb\xb8\x15\x7e\xef\xaf\x30\x34\x98\xbe\xc9"
+        "\x92\xed\xeb\x7b\x6d\x37\x37\xf3\x30\x40\xd1\x01\x92\x29\xd0\x64"
+        "\x9e\x07\xb4\x44\xdb\x6c\x28\x52\x20\x29\x2f\xf9\xf5\x3d\xdc\x24"
+        "\x4a\x96\x6c\x25\x37\x05\x0a\xd4\x09\x10\x44\x3c\xdb\xc7\xb3\x71"
+        "\xf3\xbb\x5f\xce\x05\x9d\x1c\xb1\x90\x84\xb3\xd7\x68\x36\x4d\xa3"
+        "\x09\x66\x19\xcf\x09\xdb\xbf\x46\x7f\x7c\xfe\x7b\xbc\x8a\x7e\x79"
+        "\xff\x97\x77\x7c\xb7\x23\x19\xde\xe4\x3c\xab\x0a\xcc\x54\x2c\xd5"
+        "\x85\x62\x39\x01\x61\x26\x37\x99\x94\x0b\xf5\x1a\x1d\x94\x2a\x37"
+        "\x49\x72\x3a\x9d\xa6\xa7\xc5\x94\x8b\x7d\xf2\xf9\x5f\x89\xa6\xc5"
+        "\x0a\x9f\x55\x12\x39\xee\xbd\xc8\x73\xda\xc7\x3d\x4f\xd3\x45\xb2"
+        "\x4f\x72\xa4\x50\x7c\x24\xf8\xf4\x93\x97\x38\x1f\x54\xd1\x2b\x31"
+        "\x5b\xaf\xd7\x89\xa1\x7a\xd6\x9c\x17\x03\xaa\x67\x09\x70\xc4\xf8"
+        "\x08\xe8\xa5\xe7\x96\x99\x20\x25\x20\xaf\x04\xdb\x70\x24\x89\xdc"
+        "\x30\x54\x60\xb9\x51\xd9\x86\x97\x98\xf9\xd9\x6e\x42\xee\x8d\xf1"
+        "\x91\x1d\xd9\x71\x51\x8c\x95\xd6\xbc\xa1\x6c\x81\xd4\x61\x60\x4e"
+        "\xab\xe4\x23\x10\xcd\x3f\x1f\x3f\x78\x7e\x56\x15\x5b\x2c\xc6\x5a"
+        "\xd3\x4e\x34\x31\x6a\xc1\x25\x98\xe6\x4e\x03\x88\xb8\x98\x5a\x35"
+        "\xf8\x5c\x62\x41\xb4\x06\x44\x37\x9c\xf3\xb8\x90\x31\x61\x0a\x0b"
+        "\x5e\x6e\x02\xe9\xd6\x0c\xb0\x42\x63\xf1\x68\xde\x50\x96\x72\x48"
+        "\x09\x27\x2c\xf6\x75\x5e\xed\x78\xc5\x00\x3a\xe4\x62\x2f\x2c\x0b"
+        "\x38\xd0\x10\xaa\xb4\x54\x80\x5e\x7b\xb5\x99\xa4\x4f\x82\x75\x62"
+        "\xbf\xbd\x8c\x42\x5b\x8a\xc7\xce\xc1\x30\x87\x16\xb3\x03\x12\xa3"
+        "\xb3\xc7\x30\x87\xd2\x46\xdd\x3d\xb8\x86\xa9\x4e\x6e\x81\x4e\xa3"
+        "\x13\x00\x78\xa1\x86\x43\x83\xa2\x54\x37\x6c\x2d\x13\x81\x4b\x2e"
+        "\x54\x63\x6c\x91\x8f\x37\xb6\xc8\xdb\xa1\x18\x2b\xc9\x77\x20\x37"
+        "\xaf\x5d\xd2\x24\xc5\xfd\x68\x74\xc2\x6f\xb2\x7d\x74\x29\x77\x4b"
+        "\x23\xcf\x6a\xd7\x94\x95\xa0\xc6\x29\x79\x96\x60\x8a\xb5\x94\x4c"
+        "\x66\xd3\x59\xdd\xc0\x32\x44\xb3\xef\xc8\x5e\x2d\xb6\x69\x69\x68"
+        "\xb9\x8c\xf3\xec\x46\x74\x9e\x12\x2d\x13\x26\xc2\xcd\xcc\x99\xa5"
+        "\x89\xe6\xa9\x1b\x28\x25\xec\xcb\x70\x03\xd5\xd4\x00\xc7\x4d\x18"
+        "\xed\xfa\x01\xee\xd3\x4d\xf6\x93\x20\xd0\x43\x9a\x7e\x39\x36\x40"
+        "\x67\x49\xe3\x1d\x8f\x33\x5e\x94\xe0\xd0\x4e\xdd\xc9\xe3\x7e\x74"
+        "\xa0\x8f\xfb\x01\x25\x16\xe9\xf8\x3c\x35\xad\xc7\xc8\xbb\xff\x07"
+        "\x8b\xe6\x22\x7a\xef\x57\xc8\x1d\x87\xd5\x71\x87\x32\x1c\xe7\x38"
+        "\xa3\xf2\xfd\x3b\x9b\x6a\xf5\xf0\xc4\x7e\x6b\x5b\xaf\xd1\x07\x02"
+        "\x2d\xdd\x24\xcc\xe4\x13\x24\xca\x2e\x9a\x00\x5e\xcf\x5b\x10\x7a"
+        "\x79\x8d\xfe\x8a\x4a\x2e\xff\xd6\x65\xb4\xa3\xd1\xa4\xa5\x5c\x0b"
+        "\xc4\x7b\xcc\x80\x01\x52\x49\xf0\x02\xb1\x16\x47\x49\x54\x06\x4b"
+        "\xce\x11\x09\x62\xba\x4a\x32\x1e\x1c\x62\x72\x14\x36\xe0\x1b\x01"
+        "\x4d\x9e\x88\x94\x6f\x81\xf6\x07\x23\x9a\xd0\x03\xa9\xa1\xdc\x30"
+        "\x7f\x91\x0a\x17\xf7\xec\x27\x43\x01\x75\xe3\x76\x07\xe4\x71\xe6"
+        "\x78\x87\x2a\xea\xf6\x45\x5e\xb3\xc3\xb4\x17\xa8\x3c\x90\x2c\xf2"
+        "\xbc\xee\x3b\x2e\x61\x6d\xc5\x42\x11\xd8\x47\xe9\x79\x48\x25\xf8"
+        "\x17\x0c\xd9\x4a\x39\x2c\xf3\x3f\x2d\x9e\x9e\x97\xe8\x29\x9a\xe8"
+        "\x3a\x86\xb5\x97\xd2\x9a\xf2\x32\x5f\xef\x32\xc8\x95\x1d\xdf\x9c"
+        "\x40\x55\xcc\x4b\x65\xf2\x90\xf1\x58\x7f\x3b\x11\x79\x40\x39\x3f"
+        "\xc5\x80\x56\x62\x15\x9f\x5f\xa3\x74\x3a\x9b\xad\x66\x84\xf5\xd2"
+        "\x2f\xd7\x74\x05\xeb\x55\x0c\xad\x01\xc7\xb2\x44\x19\xac\x25\xf1"
+        "\x81\x0b\xf2\x95\xeb\x66\x66\xb9\x67\x4f\xb7\xb8\x8f\x7a\x6e\x59"
+        "\x0f\x2f\x14\xd7\x68\xbd\x57\xbc\x7d\x5a\x9d\xbb\x29\x4c\xe7\x44"
+        "\xd4\x21\xb6\xcb\xc8\x0e\x51\x19\x64\x52\x89\x04\x32\x9e\x6f\xf9"
+        "\xdd\x90\x34\x7f\x8c\x2a\xc5\xb5\x11\x48\x2f\x92\x63\x6e\x59\x11"
+        "\x2d\x0f\xc8\x1b\x30\x38\xb6\x02\x23\x68\xa5\x10\x2c\x92\xb5\xd3"
+        "\x8c\xb0\x1c\xeb\xc6\xa1\xb7\xc7\x21\x64\x8f\xc4\x03\x81\x25\x1d"
+        "\xd2\x84\x97\x52\x27\xd9\x30\xb6\x9a\x5d\x83\xbb\x82\x5c\x49\x0c"
+        "\x73\x65\x3a\x82\xc6\xb8\xcb\x0d\x25\x2a\xe8\xcd\x76\x6b\xc4\xb5"
+        "\x79\xa5\x03\xfb\x73\x0b\xe7\x50\xeb\x81\x74\x32\x74\x49\xbe\x02"
+        "\x7d\x36\x2f\x95\x19\xa3\x88\xed\x2b\xb4\x87\x21\xcc\xcc\x40\x06"
+        "\xab\x9c\x12\xba\xd6\x3e\xd5\x9e\xc1\x0a\xba\x7c\xfc\x05\x0b\x66"
+        "\x26\x6c\x61\x74\x6c\xc6\xd0\x64\x11\xeb\x2f\x51\x6d\xd3\xd3\x67"
+        "\xe9\x74\x59\xd6\x64\x6f\xde\x53\xbf\x1e\x3c\xc5\xe1\xf0\x84\x5f"
+        "\x7f\xbf\xb6\xa8\x3b\x3f\xc5\xe7\x1b\x36\x6b\x0e\x3b\xdf\x8e\xcd"
+        "\x9a\x7a\x20\x5d\xab\x35\xe9\xb7\xdf\xa3\x26\x90\xad\x36\x30\xa6"
+        "\x37\xd4\x91\x8f\x6e\xe6\x29\xb8\x9d\x0b\x48\x45\x26\x5f\xa3\xb9"
+        "\xad\x7c\x02\xb1\xaf\xbf\x0e\x97\xf2\x80\x99\x09\x67\x4c\x51\x9e"
+        "\x43\x30\x0c\x50\xd3\x14\x28\x29\x48\x3d\xb7\x91\xb9\x5e\x56\x2c"
+        "\x53\x95\x55\xa8\x9b\x0a\xb8\x00\x9c\x02\xc1\xbd\x5f\x0c\x3e\xbf"
+        "\xe3\x9c\x40\x57\x60\xda\x48\x3a\x7d\x5a\xcf\x97\x4d\xa9\xea\x5d"
+        "\x81\x2e\xe6\x82\xe7\x58\xfb\x60\x1f\xd4\xe9\x23\xdf\xff\xe7\xf3"
+        "\x3d\xcc\x38\xec\xdb\x5b\x37\x0d\x05\x2e\x10\x61\xb1\x3e\xf6\xf8"
+        "\x5c\xbc\xce\xd5\xb2\x92\x87\x2e\x8b\x8d\x66\xc8\x05\x39\x9c\xa1"
+        "\x52\x06\x2d\xfd\x7b\xcb\xcd\x1e\xa7\x82\x4e\x4c\x71\x98\x6b\xf6"
+        "\x84\xb7\xe5\x42\x17\x90\x4e\x4e\x58\x66\x20\xd3\x28\x18\xd7\xa9"
+        "\xff\x56\xc3\xb1\xe0\xa7\x8e\x71\x18\xe9\xd4\xf9\x17\x8c\xcb\x58"
+        "\xf1\x3d\x56\x07\x7d\xdc\xd7\xa5\x7a\xcf\x70\x68\xd0\x66\xfb\x27"
+        "\x28\xbc\x1c\x89\x3c\x1a\x6c\x37\x3e\xbc\x14\x49\x70\xac\x2e\xba"
+        "\xbb\x1d\xa8\x40\x02\x3a\x00\x60\x83\x6e\x90\x12\x5b\x1c\x6e\x6c"
+        "\xcb\x95\xd2\x37\x2f\xe9\x34\x7d\x59\xaf\x9b\x42\xcf\x20\xf1\x40"
+        "\x75\x85\x68\x77\x35\x6c\xa6\x74\x67\x2a\xff\xc0\x28\x0f\xfa\xce"
+        "\xe0\x4c\x60\xa0\xbe\x98\x8a\xfb\xbd\xc0\x74\x6b\x09\x19\x3e\xc3"
+        "\xc0\x9f\xf3\xf4\xcf\x2d\xcf\x2f\x6f\xf6\xc8\x74\xf6\xfc\xbc\x1c"
+        "\x74\xcb\x6a\xb1\x1c\xe3\x96\x3a\x03\xcc\x46\x86\x99\x8d\x0c\xa2"
+        "\x27\x74\x91\xf7\x3a\xe4\x40\xaf\x33\x3b\x77\xdf\xea\xfe\xfb\x1b"
+        "\xf7\x6e\x57\x7d\x2a\xd5\x37\x35\x46\x67\xf1\x3e\x87\xc3\xe4\x39"
+        "\x87\xf6\xf4\x9e\xde\x00\x1c\xea\xc2\xbd\x48\x6f\x36\x54\x87\x64"
+        "\x0c\x8f\x47\x5b\xf3\x0e\xe2\xad\x39\x86\x11\x37\x3d\x5c\x63\x1e"
+        "\x5d\x48\x7d\xc9\x0e\x4b\x74\x49\xd1\x25\x28\x87\x49\x48\x7e\x4b"
+        "\xb1\xfd\xf8\xce\xb2\x7e\x99\x8f\x2d\x21\xb3\x3b\x39\x60\xb2\x3f"
+        "\x40\xfd\xcc\x66\xcb\x9f\xc7\xbb\xe9\x03\xec\x5a\xbe\x67\xfe\x37"
+        "\x7a\x09\xd5\x2a\x47\x54\x6f\x2b\x1f\xe7\xdf\x12\xdb\x5f\x91\x39"
+        "\x03\xfe\xc0\xb8\x01\x4a\x81\xbe\xb1\x01\xfa\x26\xf7\xa6\x06\x68"
+        "\xee\xf5\xec\x65\xb7\x39\x46\xc9\x36\xc5\x44\xd6\xdf\x85\xa7\xc3"
+        "\x4d\x71\x60\x77\x67\xc7\xb4\x04\x6c\x7d\xe1\xc0\x09\xc7\xf2\x9b"
+        "\x11\x68\x11\x8d\xd7\x1c\x75\x48\xb8\x77\x83\x15\x88\xd7\x74\xa7"
+        "\x60\x74\x88\x7f\x83\x93\xe5\xf9\x07\x06\x98\x18\x7d\x37\x03\xfc"
+        "\x83\x42\xf1\x4d\x19\x6e\x34\xf3\x4a\xd9\x13\xf4\x95\x17\xfe\x69"
+        "\x29\x51\x87\x91\xe2\x23\xa6\x8e\xdd\x62\xd3\x03\x60\xa3\x5e\xfa"
+        "\xab\x22\xd6\x2f\x30\x08\xfa\x41\x3d\x69\x5d\x97\x4e\xb4\x3b\xeb"
+        "\x90\xc4\x25\x31\xdb\x50\x70\xa3\xc9\x56\xec\xce\x2d\x14\x6d\x81"
+        "\x0c\x51\xdc\x33\x7d\x53\xd8\xa7\xb6\xc3\xe2\x74\x9b\xc1\x1d\xec"
+        "\x2b\xf9\x09\xe7\xf1\xf6\x62\x3b\x04\x6c\x08\x03\x77\xf4\x62\x03"
+        "\xea\xd0\xb4\x47\x3a\x64\xfe\x70\x48\xdb\x21\x8b\x87\x43\xda\x0e"
+        "\x79\x7a\x38\xa4\xed\x90\xe5\xc3\x21\x6d\x87\x3c\x3f\x1c\xd2\x76"
+        "\xc8\xcb\xc3\x21\x6d\x87\xac\x1e\x0e\x69\x3b\x64\xfd\x70\x48\x67"
+        "\x63\x96\xfe\x1f\x79\xa4\x4d\x0a\xdd\xc4\xb8\xc2\x12\xce\x04\x6c"
+        "\x47\xf6\x95\xbb\x8b\xa9\x09\xb1\xdb\xa9\xef\x38\x57\xfa\xbb\xcf"
+        "\x63\x33\xb7\x17\xb7\xef\x6f\x47\x44\x2b\x7d\xdd\xee\x06\xbd\xa0"
+        "\xac\x3d\xe5\x2e\xdb\x43\x19\xbb\x81\xd7\xb7\xf1\x5a\x9f\x7f\xf6"
+        "\xd6\xf3\x1d\x8f\x10\xb3\x7c\x08\x20\xe9\x07\xe8\xd5\x6b\x8f\x34"
+        "\x08\xfa\xcc\x0c\x1e\x3f\xec\xcb\xa5\xb9\x78\x5b\x3f\x07\x67\xcb"
+        "\x3e\xf7\x38\x2d\x8d\x1b\x28\xde\x29\x47\x23\x2c\x13\xe6\x57\x1e"
+        "\x7a\xa9\x0f\x1e\x7e\x8d\xb6\xe6\xbd\x57\x5f\xc4\x82\x4e\x92\xc5"
+        "\x9e\xe0\x4f\x4e\x7b\x08\x37\xba\x40\x78\x5b\x27\x95\x8f\x65\x31"
+        "\x8b\x7a\x98\x3a\x87\x54\x43\x39\x91\x5c\xff\x18\x6c\x35\xf5\xc7"
+        "\x67\x33\xda\xdc\x5f\x0c\x4e\xce\x69\x07\xe7\xa9\x98\x0b\xa2\x7f"
+        "\x68\xe2\xc2\xcc\x05\x9c\xdf\x89\x8a\xae\x4f\xe9\x2f\xab\x97\xa7"
+        "\xa1\x53\xfa\x35\x4d\x3b\xaa\x9f\x22\x2c\xba\x86\x64\xc1\xb4\xdf"
+        "\x76\xa8\x88\xd5\xb6\x79\x67\x30\x0e\xd8\x0b\x92\xd7\x8f\xd9\x59"
+        "\xaa\xff\xf6\x71\xb8\x90\xcf\x7b\x89\x5b\x24\x1b\x07\xa5\xd3\xf9"
+        "\xcb\xaa\x41\x10\xf2\x89\x6a\x7b\x09\xf8\x66\x8b\x75\x3f\x9f\x45"
+        "\xcb\x38\xc3\x83\x5a\xa0\x35\xe8\x1f\xbb\xb8\x14\xbc\x66\x32\x51"
+        "\xb8\x41\x77\x77\x6d\x1d\x0e\x5f\xa3\x71\x81\xce\x0d\x50\x00\xd9"
+        "\xfc\x02\xc2\x31\x48\x5c\x7a\x17\xdb\x74\x49\xa7\x69\xfa\x12\xe4"
+        "\x86\x7f\x6f\x03\xa4\x90\x22\x46\xc0\x30\x2d\xd6\xab\x1e\x26\xb4"
+        "\xd3\x4f\x58\xbd\x3c\x4d\x9b\x7a\x8d\x24\xa7\xa4\xbe\x3a\x40\xf9"
+        "\xbf\x2b\xa9\x6c\xad\xd8\x0a\xb2\xe3\x02\x7a\x9d\x03\x35\x5f\xd6"
+        "\xaf\x6f\x3e\xc4\xa9\xf9\x13\x85\xcf\xdd\x7d\xd5\xe0\x27\x7c\xc0"
+        "\x48\x3f\xbf\x98\x8f\x24\xf4\x42\x30\x78\xad\xa8\xa9\xdb\xeb\x42"
+        "\x75\x84\x02\xc9\x5a\x47\x6d\xcd\x0d\x6a\x4d\x37\x5f\x50\x42\xcc"
+        "\x41\x81\x07\xfd\xa2\xa3\x3e\xe9\xff\xc9\xec\xfb\xff\x00",
+        2077,
+        11122,
+        0xcbceeb5d
     },
 
     {
@@ -343,7 +679,29 @@ const odt_template_item_t odt_template_items[] =
                 "<manifest:file-entry manifest:full-path=\"content.xml\" manifest:media-type=\"text/xml\"/>\n"
                 " "
                 "<manifest:file-entry manifest:full-path=\"Thumbnails/thumbnail.png\" manifest:media-type=\"image/png\"/>\n"
-                "</manifest:manifest>"
+                "</manifest:manifest>",
+        "\xad\x93\x4d\x6a\xc3\x30\x10\x85\xf7\x39\x85\xd1\xb6\x58\x4a"
+        "\xdb\x4d\x11\x71\xb2\x28\xf4\x04\xe9\x01\x54\x7b\xe4\x0c\x48\x23"
+        "\xa1\x9f\x90\xdc\xbe\xb2\x89\x13\x97\x12\x88\x21\x3b\x49\x33\xfe"
+        "\xde\x9b\x27\x6b\xb3\x3b\x59\x53\x1d\x21\x44\x74\xd4\xb0\x57\xbe"
+        "\x66\x15\x50\xeb\x3a\xa4\xbe\x61\xdf\xfb\xaf\xfa\x83\xed\xb6\xab"
+        "\x8d\x55\x84\x1a\x62\x92\xd3\xa2\x2a\xdf\x51\xbc\x6e\x1b\x96\x03"
+        "\x49\xa7\x22\x46\x49\xca\x42\x94\xa9\x95\xce\x03\x75\xae\xcd\x16"
+        "\x28\xc9\xbf\xfd\x72\x54\xba\xee\x66\x06\xde\xd9\x05\x6d\x1c\x9c"
+        "\x26\x6e\xe8\xe5\x04\xd2\x2e\x53\xa7\x52\xe9\xbe\x08\xc1\xc9\x43"
+        "\xc0\xa1\xa4\x8c\x74\x5a\x63\x0b\x72\x46\x18\x95\xb6\xab\xea\x36"
+        "\x82\x46\x03\x75\x69\x0f\xe7\x9b\x01\x9d\x8d\xa9\xbd\x4a\x87\x86"
+        "\x89\xbb\xbe\x6e\x21\x40\x87\xaa\x4e\x67\x0f\x0d\x53\xde\x1b\x6c"
+        "\x47\x43\xe2\x48\x1d\x1f\x33\xe0\xf3\xd1\x79\x2a\x36\x98\x58\xe2"
+        "\xc1\x42\x52\xbc\x0c\x71\x47\x73\x00\x8a\xa1\xbc\x08\x1a\x21\xa5"
+        "\x72\xad\xf1\xe9\xe0\x4f\x47\x1a\xfb\x1c\xc6\x10\xe2\x9b\x78\x30"
+        "\xa9\x98\x69\xb0\xc2\x33\xf2\x76\x4e\x58\x18\xd5\xe5\x8c\x87\x4e"
+        "\x3f\x20\x5c\xba\x5e\x96\x27\x97\xce\x06\x9e\x9f\x5b\x99\x3a\x0d"
+        "\xff\xc7\xb3\xb9\xfb\x43\xb6\x3f\xa4\xd0\x44\x91\xa6\x25\xf7\xd4"
+        "\xdf\x11\x41\xab\x7a\x10\x43\xbd\xa8\x6c\xc4\xbf\xa7\xbe\xfd\x05",
+        303,
+        1061,
+        0x43288548
     },
 
     {
@@ -357,7 +715,8 @@ const odt_template_item_t odt_template_items[] =
         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
         "\x00\x78\x18\xc7\x00\x00\x01\xf9\xd2\xb5\x9a\x00\x00\x00\x00\x49"
-        "\x45\x4e\x44\xae\x42\x60\x82"
+        "\x45\x4e\x44\xae\x42\x60\x82",
+        NULL, 0, 0, 0
     },
 
 };
@@ -8,6 +8,13 @@ typedef struct
 {
     const char* name; /* Name of item in odt archive. */
     const char* text; /* Contents of item in odt archive. */
+
+    /* If not NULL, raw deflate compressed version of <text>, for copying
+    directly into zip files if <text> is not modified. */
+    const char*   compressed;
+    int           compressed_length;
+    int           text_length;   /* strlen(text). */
+    unsigned long crc;           /* CRC-32 of text. */
 } odt_template_item_t;
 
 extern const odt_template_item_t odt_template_items[];
@@ -0,0 +1,95 @@
+#include "extract/alloc.h"
+
+#include "mem.h"
+#include "outf.h"
+#include "spill.h"
+#include "sys.h"
+
+#include <errno.h>
+#include <stdio.h>
+
+
+struct extract_spill_t
+{
+	extract_alloc_t *alloc;
+	FILE            *file;
+	uint64_t         size;  /* Current size of file. */
+};
+
+
+/* Seek that works with offsets beyond 2GB where possible. */
+static int s_seek(FILE *file, uint64_t offset)
+{
+#ifdef _WIN32
+	return _fseeki64(file, (__int64) offset, SEEK_SET);
+#else
+	return fseeko(file, (off_t) offset, SEEK_SET);
+#endif
+}
+
+int extract_spill_open(extract_alloc_t *alloc, const char *dir, extract_spill_t **o_spill)
+{
+	extract_spill_t *spill = NULL;
+
+	if (extract_malloc(alloc, &spill, sizeof(*spill))) return -1;
+	spill->alloc = alloc;
+	spill->size = 0;
+	if (extract_tmpfile(alloc, dir, &spill->file))
+	{
+		outf0("Failed to create spill file in: %s", dir);
+		extract_free(alloc, &spill);
+		return -1;
+	}
+	*o_spill = spill;
+	return 0;
+}
+
+int extract_spill_write(extract_spill_t *spill, const void *data, size_t data_size, uint64_t *o_offset)
+{
+	if (s_seek(spill->file, spill->size)) return -1;
+	if (fwrite(data, 1, data_size, spill->file) != data_size)
+	{
+		errno = EIO;
+		return -1;
+	}
+	*o_offset = spill->size;
+	spill->size += data_size;
+	return 0;
+}
+
+int extract_spill_read(extract_spill_t *spill, uint64_t offset, void *data, size_t data_size)
+{
+	if (offset + data_size > spill->size)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	if (s_seek(spill->file, offset)) return -1;
+	if (fread(data, 1, data_size, spill->file) != data_size)
+	{
+		errno = EIO;
+		return -1;
+	}
+	return 0;
+}
+
+int extract_spill_read_alloc(extract_spill_t *spill, uint64_t offset, size_t data_size, void **o_data)
+{
+	/* Allocate at least one byte so that we always return non-NULL. */
+	if (extract_malloc(spill->alloc, o_data, data_size ? data_size : 1)) return -1;
+	if (extract_spill_read(spill, offset, *o_data, data_size))
+	{
+		extract_free(spill->alloc, o_data);
+		return -1;
+	}
+	return 0;
+}
+
+void extract_spill_close(extract_spill_t **pspill)
+{
+	extract_spill_t *spill = *pspill;
+
+	if (!spill) return;
+	fclose(spill->file);
+	extract_free(spill->alloc, pspill);
+}
@@ -0,0 +1,54 @@
+#ifndef ARTIFEX_EXTRACT_SPILL
+#define ARTIFEX_EXTRACT_SPILL
+
+/* Only for internal use by extract code.  */
+
+#include "extract/alloc.h"
+
+#include "compat_stdint.h"
+
+#include <stddef.h>
+
+
+/*
+	Support for an append-only temporary file, used to hold data that would
+	otherwise have to be kept in memory.
+
+	Unless otherwise stated, all functions return 0 on success or -1 with errno
+	set.
+*/
+
+/* Abstract handle for spill file state. */
+typedef struct extract_spill_t extract_spill_t;
+
+
+/*
+	Creates a new spill file in directory <dir>. The file is removed when
+	closed by extract_spill_close().
+*/
+int extract_spill_open(extract_alloc_t *alloc, const char *dir, extract_spill_t **o_spill);
+
+/*
+	Appends <data_size> bytes to spill file, and sets *o_offset to their
+	position, for use with extract_spill_read().
+*/
+int extract_spill_write(extract_spill_t *spill, const void *data, size_t data_size, uint64_t *o_offset);
+
+/*
+	Reads <data_size> bytes starting at <offset> into <data>.
+*/
+int extract_spill_read(extract_spill_t *spill, uint64_t offset, void *data, size_t data_size);
+
+/*
+	Like extract_spill_read() but reads into a new buffer, which the caller
+	must free with extract_free().
+*/
+int extract_spill_read_alloc(extract_spill_t *spill, uint64_t offset, size_t data_size, void **o_data);
+
+/*
+	Closes and removes the spill file, frees *pspill and sets *pspill to NULL.
+	Does nothing if *pspill is already NULL.
+*/
+void extract_spill_close(extract_spill_t **pspill);
+
+#endif
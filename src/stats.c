@@ -0,0 +1,211 @@
+#include "extract/buffer.h"
+
+#include "astring.h"
+#include "stats.h"
+
+#include <errno.h>
+#include <time.h>
+
+#ifdef _WIN32
+	#include <windows.h>
+#endif
+
+
+static const char *s_stage_names[] =
+{
+	"ingest",
+	"boxer",
+	"table_sort",
+	"table_fill",
+	"make_lines",
+	"make_paragraphs",
+	"analyse_paragraphs",
+	"rotated_blocks",
+	"format",
+	"images",
+	"zip",
+	"buffer_io"
+};
+
+const char *extract_stage_name(extract_stage_t stage)
+{
+	if ((int) stage < 0 || stage >= extract_stage_NUM) return "?";
+	return s_stage_names[stage];
+}
+
+static void s_now(extract_probe_timer_t *timer)
+{
+#ifdef _WIN32
+	FILETIME       creation;
+	FILETIME       exit;
+	FILETIME       kernel;
+	FILETIME       user;
+	LARGE_INTEGER  count;
+	LARGE_INTEGER  frequency;
+
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&frequency);
+	timer->wall = (double) count.QuadPart / (double) frequency.QuadPart;
+	timer->cpu = 0;
+	if (GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+	{
+		/* FILETIME is in units of 100ns. */
+		timer->cpu = (kernel.dwLowDateTime + 4294967296.0 * kernel.dwHighDateTime
+				+ user.dwLowDateTime + 4294967296.0 * user.dwHighDateTime) / 1e7;
+	}
+#else
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	timer->wall = (double) t.tv_sec + (double) t.tv_nsec / 1e9;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+	timer->cpu = (double) t.tv_sec + (double) t.tv_nsec / 1e9;
+#endif
+}
+
+void extract_probe_begin(extract_probe_t *probe, extract_stage_t stage, extract_probe_timer_t *timer)
+{
+	if (!probe) return;
+	s_now(timer);
+	if (probe->trace_fn)
+	{
+		probe->trace_fn(probe->trace_handle, s_stage_names[stage], 1 /*begin*/, probe->page, timer->wall);
+	}
+}
+
+void extract_probe_end(extract_probe_t *probe, extract_stage_t stage, const extract_probe_timer_t *timer)
+{
+	extract_probe_timer_t now;
+
+	if (!probe) return;
+	s_now(&now);
+	if (probe->stats)
+	{
+		probe->stats->times[stage].wall += now.wall - timer->wall;
+		probe->stats->times[stage].cpu += now.cpu - timer->cpu;
+		probe->stats->times[stage].calls += 1;
+	}
+	if (probe->trace_fn)
+	{
+		probe->trace_fn(probe->trace_handle, s_stage_names[stage], 0 /*end*/, probe->page, now.wall);
+	}
+}
+
+void extract_probe_event(extract_probe_t *probe, const char *name, int begin)
+{
+	extract_probe_timer_t now;
+
+	if (!probe || !probe->trace_fn) return;
+	s_now(&now);
+	probe->trace_fn(probe->trace_handle, name, begin, probe->page, now.wall);
+}
+
+
+struct extract_trace_chrome_t
+{
+	extract_buffer_t *buffer;
+	int               events_num;
+	double            time0;
+	int               errno_;
+	extract_astring_t event;    /* Reused for each event. */
+};
+
+int extract_trace_chrome_open(extract_buffer_t *buffer, extract_trace_chrome_t **o_chrome)
+{
+	extract_trace_chrome_t *chrome;
+
+	if (extract_malloc(extract_buffer_alloc(buffer), &chrome, sizeof(*chrome))) return -1;
+	chrome->buffer = buffer;
+	chrome->events_num = 0;
+	chrome->time0 = 0;
+	chrome->errno_ = 0;
+	extract_astring_init(&chrome->event);
+	if (extract_buffer_cat(buffer, "[\n"))
+	{
+		extract_free(extract_buffer_alloc(buffer), &chrome);
+		return -1;
+	}
+	*o_chrome = chrome;
+
+	return 0;
+}
+
+/* Appends <text> to <string> with JSON escapes for '"', '\\' and control
+characters. */
+static int s_cat_json_escaped(extract_alloc_t *alloc, extract_astring_t *string, const char *text)
+{
+	static const char *hex = "0123456789abcdef";
+	const char        *c;
+
+	for (c=text; *c; ++c)
+	{
+		unsigned char uc = (unsigned char) *c;
+		if (uc == '"' || uc == '\\')
+		{
+			if (extract_astring_catc(alloc, string, '\\')) return -1;
+			if (extract_astring_catc(alloc, string, *c)) return -1;
+		}
+		else if (uc < 0x20)
+		{
+			if (extract_astring_cat(alloc, string, "\\u00")) return -1;
+			if (extract_astring_catc(alloc, string, hex[uc >> 4])) return -1;
+			if (extract_astring_catc(alloc, string, hex[uc & 15])) return -1;
+		}
+		else
+		{
+			if (extract_astring_catc(alloc, string, *c)) return -1;
+		}
+	}
+	return 0;
+}
+
+void extract_trace_chrome(void *handle, const char *name, int begin, int page, double time)
+{
+	extract_trace_chrome_t *chrome = handle;
+	extract_alloc_t        *alloc;
+	extract_astring_t      *event = &chrome->event;
+	int                     e = -1;
+
+	if (chrome->errno_) return;
+	alloc = extract_buffer_alloc(chrome->buffer);
+	if (chrome->events_num == 0) chrome->time0 = time;
+	event->chars_num = 0;
+	if (chrome->events_num && extract_astring_cat(alloc, event, ",\n")) goto end;
+	if (extract_astring_cat(alloc, event, "{\"name\":\"")) goto end;
+	if (s_cat_json_escaped(alloc, event, name)) goto end;
+	/* Times are in microseconds. */
+	if (extract_astring_catf(alloc, event, "\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":1",
+			(begin) ? 'B' : 'E',
+			(time - chrome->time0) * 1e6
+			)) goto end;
+	if (page >= 0 && extract_astring_catf(alloc, event, ",\"args\":{\"page\":%i}", page)) goto end;
+	if (extract_astring_cat(alloc, event, "}")) goto end;
+	if (extract_buffer_write(chrome->buffer, event->chars, event->chars_num, NULL)) goto end;
+	chrome->events_num += 1;
+
+	e = 0;
+end:
+
+	if (e) chrome->errno_ = errno ? errno : EIO;
+}
+
+int extract_trace_chrome_close(extract_trace_chrome_t **pchrome)
+{
+	extract_trace_chrome_t *chrome = *pchrome;
+	int                     e = 0;
+
+	if (!chrome) return 0;
+	if (chrome->errno_)
+	{
+		errno = chrome->errno_;
+		e = -1;
+	}
+	else if (extract_buffer_cat(chrome->buffer, "\n]\n"))
+	{
+		e = -1;
+	}
+	extract_astring_free(extract_buffer_alloc(chrome->buffer), &chrome->event);
+	extract_free(extract_buffer_alloc(chrome->buffer), pchrome);
+
+	return e;
+}
@@ -0,0 +1,49 @@
+#ifndef ARTIFEX_EXTRACT_STATS_H
+#define ARTIFEX_EXTRACT_STATS_H
+
+/* Only for internal use by extract code.  */
+
+#include "extract/extract.h"
+
+
+/* Where to send timings and trace events; see extract_set_stats() and
+extract_set_trace(). Code that is passed a NULL extract_probe_t* does no timing
+at all. */
+typedef struct
+{
+	extract_stats_t   *stats;           /* If not NULL, we add stage times here. */
+	extract_trace_fn  *trace_fn;        /* If not NULL, we send trace events here. */
+	void              *trace_handle;
+	int                page_first;      /* Page index of document->pages[0]. */
+	int                page;            /* Page index passed to trace_fn, or -1. */
+} extract_probe_t;
+
+/* Start times of a stage. */
+typedef struct
+{
+	double wall;
+	double cpu;
+} extract_probe_timer_t;
+
+/* Sets *timer to the current times and sends a begin event for <stage>. Does
+nothing if <probe> is NULL. */
+void extract_probe_begin(extract_probe_t *probe, extract_stage_t stage, extract_probe_timer_t *timer);
+
+/* Adds time since extract_probe_begin() to probe->stats->times[stage] and
+sends an end event for <stage>. Does nothing if <probe> is NULL. */
+void extract_probe_end(extract_probe_t *probe, extract_stage_t stage, const extract_probe_timer_t *timer);
+
+/* Sends a begin or end event called <name> that is not a stage, e.g. "page".
+Does nothing if <probe> is NULL. */
+void extract_probe_event(extract_probe_t *probe, const char *name, int begin);
+
+
+/* Makes <buffer> record time spent in its fn_read(), fn_write() and
+fn_cache() callbacks as extract_stage_BUFFER_IO in <probe>, which can be NULL.
+Returns the previous value. Defined in buffer.c. */
+extract_probe_t *extract_buffer_set_probe(extract_buffer_t *buffer, extract_probe_t *probe);
+
+/* Returns the extract_probe_t set by extract_buffer_set_probe(), or NULL. */
+extract_probe_t *extract_buffer_get_probe(extract_buffer_t *buffer);
+
+#endif
@@ -4,8 +4,12 @@
 
 #include <errno.h>
 #include <stdarg.h>
+#include <stdlib.h>
 
 #include <sys/stat.h>
+#ifndef _WIN32
+	#include <unistd.h>
+#endif
 
 
 /* Define extract_APPLE_IOS if we are on iOS. */
@@ -49,6 +53,11 @@ int extract_systemf(extract_alloc_t *alloc, const char *format, ...)
 }
 
 int  extract_read_all(extract_alloc_t *alloc, FILE *in, char **o_out)
+{
+	return extract_read_all2(alloc, in, o_out, NULL);
+}
+
+int  extract_read_all2(extract_alloc_t *alloc, FILE *in, char **o_out, size_t *o_out_length)
 {
 	size_t  len = 0;
 	size_t  delta = 128;
@@ -62,6 +71,7 @@ int  extract_read_all(extract_alloc_t *alloc, FILE *in, char **o_out)
 		len += n;
 		if (feof(in)) {
 			(*o_out)[len] = 0;
+			if (o_out_length) *o_out_length = len;
 			return 0;
 		}
 		if (ferror(in)) {
@@ -70,16 +80,23 @@ int  extract_read_all(extract_alloc_t *alloc, FILE *in, char **o_out)
 			extract_free(alloc, o_out);
 			return -1;
 		}
+		/* Grow geometrically to avoid quadratic behaviour with large files. */
+		if (n == delta) delta = len;
 	}
 }
 
 int  extract_read_all_path(extract_alloc_t *alloc, const char *path, char **o_text)
+{
+	return extract_read_all_path2(alloc, path, o_text, NULL);
+}
+
+int  extract_read_all_path2(extract_alloc_t *alloc, const char *path, char **o_text, size_t *o_text_length)
 {
 	int e = -1;
 	FILE *f = NULL;
 	f = fopen(path, "rb");
 	if (!f) goto end;
-	if (extract_read_all(alloc, f, o_text)) goto end;
+	if (extract_read_all2(alloc, f, o_text, o_text_length)) goto end;
 	e = 0;
 	end:
 	if (f) fclose(f);
@@ -136,3 +153,45 @@ int extract_mkdir(const char *path, int mode)
 	return mkdir(path, mode);
 }
 #endif
+
+#ifdef _WIN32
+int extract_tmpfile(extract_alloc_t *alloc, const char *dir, FILE **o_file)
+{
+	char *path = _tempnam(dir, "extract");
+	(void) alloc;
+	if (!path)
+	{
+		errno = EEXIST;
+		return -1;
+	}
+	/* 'D' makes file be deleted when closed. */
+	*o_file = fopen(path, "w+bD");
+	free(path);
+	return (*o_file) ? 0 : -1;
+}
+#else
+int extract_tmpfile(extract_alloc_t *alloc, const char *dir, FILE **o_file)
+{
+	int   e = -1;
+	char *path = NULL;
+	int   fd;
+
+	if (extract_asprintf(alloc, &path, "%s/extract-XXXXXX", dir) < 0) goto end;
+	fd = mkstemp(path);
+	if (fd < 0) goto end;
+	/* Remove the directory entry now, so the file disappears when closed. */
+	unlink(path);
+	*o_file = fdopen(fd, "w+b");
+	if (!*o_file)
+	{
+		close(fd);
+		goto end;
+	}
+
+	e = 0;
+end:
+
+	extract_free(alloc, &path);
+	return e;
+}
+#endif
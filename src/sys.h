@@ -15,9 +15,16 @@ On iOS we always -1:ENOTSUP because the system() function is not available. */
 int  extract_read_all(extract_alloc_t* alloc, FILE* in, char** o_out);
 /* Reads until eof into zero-terminated malloc'd buffer. */
 
+int  extract_read_all2(extract_alloc_t* alloc, FILE* in, char** o_out, size_t* o_out_length);
+/* Like extract_read_all() but also sets *o_out_length (if not NULL) to the
+number of bytes read, excluding the terminating zero. */
+
 int  extract_read_all_path(extract_alloc_t* alloc, const char* path, char** o_text);
 /* Reads entire file into zero-terminated malloc'd buffer. */
 
+int  extract_read_all_path2(extract_alloc_t* alloc, const char* path, char** o_text, size_t* o_text_length);
+/* Like extract_read_all_path() but also sets *o_text_length (if not NULL). */
+
 int  extract_write_all(const void* data, size_t data_size, const char* path);
 
 int extract_check_path_shell_safe(const char* path);
@@ -32,4 +39,8 @@ to be relied on. */
 int extract_mkdir(const char* path, int mode);
 /* Compatibility wrapper to cope on Windows. */
 
+int extract_tmpfile(extract_alloc_t* alloc, const char* dir, FILE** o_file);
+/* Creates a new temporary file in directory <dir>, opened for reading and
+writing in binary mode. The file is removed automatically when closed. */
+
 #endif
@@ -1,3 +1,6 @@
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_OUTPUT
+
 #include "text.h"
 
 #include "astring.h"
@@ -1,3 +1,6 @@
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_XML
+
 #include "extract/alloc.h"
 
 #include "mem.h"
@@ -14,6 +17,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#include <arm_neon.h>
+#endif
+
 
 /* These str_*() functions realloc buffer as required. All return 0 or -1 with
 errno set. */
@@ -39,6 +48,20 @@ static int str_catc(extract_alloc_t *alloc, char **p, char c)
 	return str_catl(alloc, p, &c, 1);
 }
 
+/* Like extract_astring_catl(), but accounts a new buffer for <string> as
+extract_alloc_category_XML instead of extract_alloc_category_OUTPUT. */
+static int astring_catl(extract_alloc_t *alloc, extract_astring_t *string, const char *s, size_t s_len)
+{
+	if (extract_astring_reserve_category(alloc, extract_alloc_CATEGORY, string, s_len)) return -1;
+	return extract_astring_catl(alloc, string, s, s_len);
+}
+
+/* Like extract_astring_catc(), with accounting as astring_catl(). */
+static int astring_catc(extract_alloc_t *alloc, extract_astring_t *string, char c)
+{
+	return astring_catl(alloc, string, &c, 1);
+}
+
 /* Unused but useful to keep code here. */
 #if 0
 /* Appends a string. */
@@ -522,7 +545,7 @@ int extract_xml_pparse_next(extract_buffer_t *buffer, extract_xml_tag_t *out)
 		}
 		if (e) goto end;
 		if (c == '<') break;
-		if (extract_astring_catc(alloc, &out->text, c)) goto end;
+		if (astring_catc(alloc, &out->text, c)) goto end;
 	}
 
 	ret = 0;
@@ -536,3 +559,819 @@ end:
 
 	return ret;
 }
+
+
+/* Implementation of extract_xml_scanner_*(). */
+
+/* Size of chunks that we read if the buffer has no cache. */
+#define SCANNER_CHUNK_SIZE (64 * 1024)
+
+/* Values of extract_xml_scanner_t::state. These follow the way that
+extract_xml_pparse_next() reads a tag. */
+enum
+{
+	SCAN_NAME,
+	SCAN_ATTRIBUTE_NAME,
+	SCAN_ATTRIBUTE_VALUE,
+	SCAN_AFTER_SLASH,
+	SCAN_TEXT,
+	SCAN_DONE
+};
+
+/* Sets scanner->pos..end to the next chunk. Returns +1 if EOF. */
+static int s_scanner_fetch(extract_xml_scanner_t *scanner)
+{
+	const void *data;
+	size_t      numbytes;
+	int         e = extract_buffer_read_chunk(
+			scanner->buffer,
+			scanner->chunk,
+			SCANNER_CHUNK_SIZE,
+			&data,
+			&numbytes
+			);
+
+	if (e) return e;
+	scanner->pos = data;
+	scanner->end = scanner->pos + numbytes;
+
+	return 0;
+}
+
+void extract_xml_scanner_free(extract_xml_scanner_t *scanner)
+{
+	extract_free(scanner->alloc, &scanner->chunk);
+	extract_astring_free(scanner->alloc, &scanner->carry);
+	extract_astring_free(scanner->alloc, &scanner->unescaped);
+	extract_free(scanner->alloc, &scanner->scan_attributes);
+	extract_free(scanner->alloc, &scanner->tag.attributes);
+	scanner->scan_attributes_max = 0;
+	scanner->attributes_max = 0;
+}
+
+int extract_xml_scanner_init(
+		extract_alloc_t       *alloc,
+		extract_buffer_t      *buffer,
+		const char            *prefix,
+		size_t                 prefix_size,
+		extract_xml_scanner_t *scanner)
+{
+	extract_bzero(scanner, sizeof(*scanner));
+	scanner->alloc = alloc;
+	scanner->buffer = buffer;
+	extract_astring_init(&scanner->carry);
+	extract_astring_init(&scanner->unescaped);
+	if (extract_malloc(alloc, &scanner->chunk, SCANNER_CHUNK_SIZE)) goto fail;
+	if (prefix_size > SCANNER_CHUNK_SIZE) {
+		errno = EINVAL;
+		goto fail;
+	}
+	if (prefix_size) {
+		memcpy(scanner->chunk, prefix, prefix_size);
+		scanner->pos = scanner->chunk;
+		scanner->end = scanner->chunk + prefix_size;
+	}
+
+	for(;;) {
+		char c;
+		if (scanner->pos == scanner->end) {
+			int e = s_scanner_fetch(scanner);
+			if (e) {
+				if (e == 1) errno = ESRCH;   /* EOF. */
+				goto fail;
+			}
+		}
+		c = *scanner->pos;
+		scanner->pos += 1;
+		if (c == '<') {
+			break;
+		}
+		else if (c == ' ' || c == '\n') {}
+		else {
+			outf("Expected '<' but found c=%i", c);
+			errno = EINVAL;
+			goto fail;
+		}
+	}
+
+	return 0;
+
+fail:
+	extract_xml_scanner_free(scanner);
+	return -1;
+}
+
+/* Starts a new attribute whose name starts at <offset>. We store the pending
+attribute in scanner->scan_attributes[scanner->scan_attributes_num]. */
+static int s_scan_attribute_begin(extract_xml_scanner_t *scanner, size_t offset)
+{
+	extract_xml_scan_attribute_t *attribute;
+
+	if (scanner->scan_attributes_num == scanner->scan_attributes_max)
+	{
+		int max = (scanner->scan_attributes_max) ? scanner->scan_attributes_max * 2 : 8;
+		if (extract_realloc2(
+				scanner->alloc,
+				&scanner->scan_attributes,
+				sizeof(*scanner->scan_attributes) * scanner->scan_attributes_max,
+				sizeof(*scanner->scan_attributes) * max
+				)) return -1;
+		scanner->scan_attributes_max = max;
+	}
+	attribute = &scanner->scan_attributes[scanner->scan_attributes_num];
+	attribute->name_begin = offset;
+	attribute->name_end = offset;
+	attribute->value_begin = offset;
+	attribute->value_end = offset;
+	attribute->escaped = 0;
+
+	return 0;
+}
+
+/* Scans scanner->pos..end, which is at <offset> within the current tag.
+
+Returns with scanner->state=SCAN_DONE and scanner->pos after the next '<' if
+we reached the end of the current tag's trailing text, otherwise with
+scanner->pos=scanner->end. */
+static int s_scan(extract_xml_scanner_t *scanner, size_t offset)
+{
+	const char *begin = scanner->pos;
+	const char *p     = begin;
+	const char *end   = scanner->end;
+
+	while (p != end)
+	{
+		extract_xml_scan_attribute_t *attribute;
+		size_t                        here;
+		char                          c;
+
+		if (scanner->state == SCAN_TEXT)
+		{
+			/* Text can be large, e.g. hex image data, so search for the
+			terminating '<' directly. */
+			const char *lt = memchr(p, '<', (size_t) (end - p));
+			if (!lt)
+			{
+				p = end;
+				break;
+			}
+			scanner->text_end = offset + (size_t) (lt - begin);
+			scanner->state = SCAN_DONE;
+			p = lt + 1;
+			break;
+		}
+
+		here = offset + (size_t) (p - begin);
+		c = *p;
+		p += 1;
+		attribute = &scanner->scan_attributes[scanner->scan_attributes_num];
+		switch (scanner->state)
+		{
+		case SCAN_NAME:
+			if (c == '>')
+			{
+				scanner->name_end = here;
+				scanner->text_begin = here + 1;
+				scanner->state = SCAN_TEXT;
+			}
+			else if (c == ' ')
+			{
+				scanner->name_end = here;
+				if (s_scan_attribute_begin(scanner, here + 1)) return -1;
+				scanner->state = SCAN_ATTRIBUTE_NAME;
+			}
+			break;
+
+		case SCAN_ATTRIBUTE_NAME:
+			if (c == '>')
+			{
+				/* Discard pending attribute. */
+				scanner->text_begin = here + 1;
+				scanner->state = SCAN_TEXT;
+			}
+			else if (c == ' ')
+			{
+				/* Attribute with empty value. */
+				attribute->name_end = here;
+				attribute->value_begin = here;
+				attribute->value_end = here;
+				scanner->scan_attributes_num += 1;
+				if (s_scan_attribute_begin(scanner, here + 1)) return -1;
+			}
+			else if (c == '=')
+			{
+				attribute->name_end = here;
+				attribute->value_begin = here + 1;
+				scanner->quote_single = 0;
+				scanner->quote_double = 0;
+				scanner->escape = 0;
+				scanner->state = SCAN_ATTRIBUTE_VALUE;
+			}
+			break;
+
+		case SCAN_ATTRIBUTE_VALUE:
+			if (scanner->escape)                scanner->escape = 0;
+			else if (c == '\'')                 scanner->quote_single = !scanner->quote_single;
+			else if (c == '"')                  scanner->quote_double = !scanner->quote_double;
+			else if (c == '\\')
+			{
+				scanner->escape = 1;
+				attribute->escaped = 1;
+			}
+			else if (!scanner->quote_single && !scanner->quote_double
+					&& (c == ' ' || c == '/' || c == '>')
+					)
+			{
+				/* We are at end of attribute value. */
+				attribute->value_end = here;
+				scanner->scan_attributes_num += 1;
+				if (c == '>')
+				{
+					scanner->text_begin = here + 1;
+					scanner->state = SCAN_TEXT;
+				}
+				else if (c == '/')
+				{
+					scanner->state = SCAN_AFTER_SLASH;
+				}
+				else
+				{
+					if (s_scan_attribute_begin(scanner, here + 1)) return -1;
+					scanner->state = SCAN_ATTRIBUTE_NAME;
+				}
+			}
+			break;
+
+		case SCAN_AFTER_SLASH:
+			if (c == '>')
+			{
+				scanner->text_begin = here + 1;
+				scanner->state = SCAN_TEXT;
+			}
+			else
+			{
+				/* Like extract_xml_pparse_next(), we discard <c>. */
+				if (s_scan_attribute_begin(scanner, here + 1)) return -1;
+				scanner->state = SCAN_ATTRIBUTE_NAME;
+			}
+			break;
+
+		default:
+			assert(0);
+			errno = EINVAL;
+			return -1;
+		}
+	}
+	scanner->pos = p;
+
+	return 0;
+}
+
+/* Sets up scanner->tag's slices, given that the current tag's data is at
+base..+. */
+static int s_scanner_make_tag(extract_xml_scanner_t *scanner, const char *base)
+{
+	extract_xml_slice_tag_t *tag = &scanner->tag;
+	int                      i;
+
+	tag->name.chars = base;
+	tag->name.chars_num = scanner->name_end;
+	tag->text.chars = base + scanner->text_begin;
+	tag->text.chars_num = scanner->text_end - scanner->text_begin;
+
+	if (scanner->scan_attributes_num > scanner->attributes_max)
+	{
+		if (extract_realloc2(
+				scanner->alloc,
+				&tag->attributes,
+				sizeof(*tag->attributes) * scanner->attributes_max,
+				sizeof(*tag->attributes) * scanner->scan_attributes_max
+				)) return -1;
+		scanner->attributes_max = scanner->scan_attributes_max;
+	}
+	tag->attributes_num = scanner->scan_attributes_num;
+
+	/* Values containing escapes are copied into scanner->unescaped. We store
+	offsets at first because scanner->unescaped can be reallocated. */
+	scanner->unescaped.chars_num = 0;
+	for (i=0; i<scanner->scan_attributes_num; ++i)
+	{
+		extract_xml_scan_attribute_t *attribute = &scanner->scan_attributes[i];
+		size_t                        begin = scanner->unescaped.chars_num;
+		size_t                        j;
+		if (!attribute->escaped) continue;
+		for (j=attribute->value_begin; j<attribute->value_end; ++j)
+		{
+			if (base[j] == '\\') j += 1;
+			if (astring_catc(scanner->alloc, &scanner->unescaped, base[j])) return -1;
+		}
+		attribute->value_begin = begin;
+		attribute->value_end = scanner->unescaped.chars_num;
+	}
+
+	for (i=0; i<scanner->scan_attributes_num; ++i)
+	{
+		extract_xml_scan_attribute_t  *attribute = &scanner->scan_attributes[i];
+		extract_xml_slice_attribute_t *out = &tag->attributes[i];
+		const char                    *value;
+		size_t                         l;
+		out->name.chars = base + attribute->name_begin;
+		out->name.chars_num = attribute->name_end - attribute->name_begin;
+		value = (attribute->escaped ? scanner->unescaped.chars : base) + attribute->value_begin;
+		l = attribute->value_end - attribute->value_begin;
+
+		/* Remove any enclosing quotes. */
+		if (l >= 2) {
+			if (
+					(value[0] == '"' && value[l-1] == '"')
+					||
+					(value[0] == '\'' && value[l-1] == '\'')
+					) {
+				value += 1;
+				l -= 2;
+			}
+		}
+		out->value.chars = (l) ? value : "";
+		out->value.chars_num = l;
+	}
+
+	return 0;
+}
+
+int extract_xml_scanner_next(extract_xml_scanner_t *scanner)
+{
+	const char *tag_begin = scanner->pos;
+	size_t      offset = 0;
+	int         carried = 0;
+
+	scanner->state = SCAN_NAME;
+	scanner->name_end = 0;
+	scanner->text_begin = 0;
+	scanner->text_end = 0;
+	scanner->scan_attributes_num = 0;
+
+	for(;;)
+	{
+		const char *begin = scanner->pos;
+		int         e;
+
+		if (s_scan(scanner, offset)) return -1;
+		if (scanner->state == SCAN_DONE)
+		{
+			if (carried)
+			{
+				if (astring_catl(
+						scanner->alloc,
+						&scanner->carry,
+						begin,
+						(size_t) (scanner->pos - 1 - begin)
+						)) return -1;
+			}
+			break;
+		}
+
+		/* The current tag continues into the next chunk, so we need to copy
+		it. */
+		if (!carried)
+		{
+			scanner->carry.chars_num = 0;
+			carried = 1;
+		}
+		if (astring_catl(
+				scanner->alloc,
+				&scanner->carry,
+				begin,
+				(size_t) (scanner->pos - begin)
+				)) return -1;
+		offset += (size_t) (scanner->pos - begin);
+
+		e = s_scanner_fetch(scanner);
+		if (e < 0) return -1;
+		if (e > 0)
+		{
+			/* EOF is not an error if we are in trailing text. */
+			if (scanner->state == SCAN_TEXT)
+			{
+				scanner->text_end = offset;
+				break;
+			}
+			if (offset) outf("EOF inside tag");
+			errno = ESRCH;
+			return +1;
+		}
+	}
+
+	if (s_scanner_make_tag(scanner, (carried) ? scanner->carry.chars : tag_begin)) return -1;
+
+	return 0;
+}
+
+int extract_xml_slice_is(const extract_xml_slice_t *slice, const char *text)
+{
+	size_t n = strlen(text);
+
+	return slice->chars_num == n && !memcmp(slice->chars, text, n);
+}
+
+int extract_xml_slice_to_astring(
+		extract_alloc_t           *alloc,
+		const extract_xml_slice_t *slice,
+		extract_astring_t         *string)
+{
+	string->chars_num = 0;
+
+	return extract_astring_catl(alloc, string, slice->chars, slice->chars_num);
+}
+
+const extract_xml_slice_t *extract_xml_slice_tag_find(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name)
+{
+	int i;
+
+	for (i=0; i<tag->attributes_num; ++i) {
+		if (extract_xml_slice_is(&tag->attributes[i].name, name)) {
+			return &tag->attributes[i].value;
+		}
+	}
+	outf("Failed to find attribute '%s'",name);
+
+	return NULL;
+}
+
+/* Copies <slice> into buffer[buffer_size] as a zero-terminated string. */
+static int s_slice_to_string(const extract_xml_slice_t *slice, char *buffer, size_t buffer_size)
+{
+	if (slice->chars_num >= buffer_size) {
+		errno = EINVAL;
+		return -1;
+	}
+	memcpy(buffer, slice->chars, slice->chars_num);
+	buffer[slice->chars_num] = 0;
+
+	return 0;
+}
+
+int extract_xml_slice_tag_find_int(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name,
+		int                           *o_out)
+{
+	const extract_xml_slice_t *value = extract_xml_slice_tag_find(tag, name);
+
+	if (!value) {
+		errno = ESRCH;
+		return -1;
+	}
+
+	return extract_xml_slice_to_int(value, o_out);
+}
+
+int extract_xml_slice_tag_find_uint(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name,
+		unsigned                      *o_out)
+{
+	const extract_xml_slice_t *value = extract_xml_slice_tag_find(tag, name);
+
+	if (!value) {
+		errno = ESRCH;
+		return -1;
+	}
+
+	return extract_xml_slice_to_uint(value, o_out);
+}
+
+int extract_xml_slice_tag_find_size(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name,
+		size_t                        *o_out)
+{
+	const extract_xml_slice_t *value = extract_xml_slice_tag_find(tag, name);
+	char                       buffer[64];
+
+	if (!value) {
+		errno = ESRCH;
+		return -1;
+	}
+	if (s_slice_to_string(value, buffer, sizeof(buffer))) return -1;
+
+	return extract_xml_str_to_size(buffer, o_out);
+}
+
+int extract_xml_slice_tag_find_double(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name,
+		double                        *o_out)
+{
+	const extract_xml_slice_t *value = extract_xml_slice_tag_find(tag, name);
+
+	if (!value) {
+		errno = ESRCH;
+		return -1;
+	}
+
+	return extract_xml_slice_to_double(value, o_out);
+}
+
+/* Parses <slice> if it looks like [-]ddd[.ddd]. Returns 0 with *o_mantissa
+set to the value of all digits ignoring any '.', and *o_fraction_digits
+set to the number of digits after the '.' or -1 if there is no '.'. Otherwise
+returns -1 without setting errno, e.g. if there are more than 19 significant
+digits so *o_mantissa might overflow. */
+static int s_decimal_parse(
+		const extract_xml_slice_t *slice,
+		int                       *o_negative,
+		uint64_t                  *o_mantissa,
+		int                       *o_fraction_digits)
+{
+	const char *p = slice->chars;
+	const char *end = p + slice->chars_num;
+	uint64_t    mantissa = 0;
+	int         significant = 0;
+	int         digits = 0;
+	int         fraction_digits = -1;
+
+	*o_negative = 0;
+	if (p != end && *p == '-') {
+		*o_negative = 1;
+		p += 1;
+	}
+	for (; p != end; ++p) {
+		char c = *p;
+		if (c >= '0' && c <= '9') {
+			if (mantissa || c != '0') {
+				significant += 1;
+				if (significant > 19) return -1;
+			}
+			mantissa = mantissa * 10 + (unsigned) (c - '0');
+			digits += 1;
+			if (fraction_digits >= 0) fraction_digits += 1;
+		}
+		else if (c == '.' && fraction_digits < 0) {
+			fraction_digits = 0;
+		}
+		else {
+			return -1;
+		}
+	}
+	if (!digits) return -1;
+	*o_mantissa = mantissa;
+	*o_fraction_digits = fraction_digits;
+
+	return 0;
+}
+
+int extract_xml_slice_to_int(const extract_xml_slice_t *slice, int *o_out)
+{
+	int      negative;
+	uint64_t mantissa;
+	int      fraction_digits;
+	char     buffer[256];
+
+	if (!s_decimal_parse(slice, &negative, &mantissa, &fraction_digits) && fraction_digits < 0) {
+		if (mantissa > (uint64_t) INT_MAX + negative) {
+			errno = ERANGE;
+			return -1;
+		}
+		*o_out = (negative) ? (int) (-(int64_t) mantissa) : (int) mantissa;
+		return 0;
+	}
+	if (s_slice_to_string(slice, buffer, sizeof(buffer))) return -1;
+
+	return extract_xml_str_to_int(buffer, o_out);
+}
+
+int extract_xml_slice_to_uint(const extract_xml_slice_t *slice, unsigned *o_out)
+{
+	int      negative;
+	uint64_t mantissa;
+	int      fraction_digits;
+	char     buffer[256];
+
+	if (!s_decimal_parse(slice, &negative, &mantissa, &fraction_digits) && fraction_digits < 0 && !negative) {
+		if (mantissa > UINT_MAX) {
+			errno = ERANGE;
+			return -1;
+		}
+		*o_out = (unsigned) mantissa;
+		return 0;
+	}
+	if (s_slice_to_string(slice, buffer, sizeof(buffer))) return -1;
+
+	return extract_xml_str_to_uint(buffer, o_out);
+}
+
+int extract_xml_slice_to_double(const extract_xml_slice_t *slice, double *o_out)
+{
+	/* Powers of ten that are exactly representable as doubles. */
+	static const double pow10[] = {
+		1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	int      negative;
+	uint64_t mantissa;
+	int      fraction_digits;
+	char     buffer[256];
+
+	if (!s_decimal_parse(slice, &negative, &mantissa, &fraction_digits)
+			&& mantissa <= ((uint64_t) 1 << 53)
+			&& fraction_digits < (int) (sizeof(pow10) / sizeof(pow10[0]))
+			)
+	{
+		/* Both (double) mantissa and the power of ten are exact, so the
+		division is correctly rounded, same as strtod(). */
+		double x = (double) mantissa;
+		if (fraction_digits > 0) x /= pow10[fraction_digits];
+		*o_out = (negative) ? -x : x;
+		return 0;
+	}
+	if (s_slice_to_string(slice, buffer, sizeof(buffer))) return -1;
+
+	return extract_xml_str_to_double(buffer, o_out);
+}
+
+
+/* Value of lowercase hex digits, otherwise -1. */
+static const signed char s_hex_values[256] =
+{
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+#if defined(__SSE2__)
+
+/* Decodes 16 lowercase hex digits at <text> into 8 bytes at <data>. Returns -1
+without writing anything if any of the 16 characters is not a lowercase hex
+digit. */
+static int s_hex_decode_16(const char *text, char *data)
+{
+	__m128i v = _mm_loadu_si128((const __m128i*) text);
+	/* Signed compares are fine here because chars >= 0x80 are negative, so
+	are rejected by both ranges. */
+	__m128i is_digit = _mm_and_si128(
+			_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+			_mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1))
+			);
+	__m128i is_letter = _mm_and_si128(
+			_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)),
+			_mm_cmplt_epi8(v, _mm_set1_epi8('f' + 1))
+			);
+	__m128i nibbles;
+	__m128i bytes;
+
+	if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff) return -1;
+	nibbles = _mm_or_si128(
+			_mm_and_si128(is_digit, _mm_sub_epi8(v, _mm_set1_epi8('0'))),
+			_mm_and_si128(is_letter, _mm_sub_epi8(v, _mm_set1_epi8('a' - 10)))
+			);
+	/* Each 16-bit lane has the high nibble in its low byte and the low nibble
+	in its high byte. */
+	bytes = _mm_or_si128(
+			_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00ff)), 4),
+			_mm_srli_epi16(nibbles, 8)
+			);
+	_mm_storel_epi64((__m128i*) data, _mm_packus_epi16(bytes, bytes));
+	return 0;
+}
+#define s_hex_decode_16_available
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+/* As above. */
+static int s_hex_decode_16(const char *text, char *data)
+{
+	uint8x16_t v = vld1q_u8((const uint8_t*) text);
+	uint8x16_t digit = vsubq_u8(v, vdupq_n_u8('0'));
+	uint8x16_t letter = vsubq_u8(v, vdupq_n_u8('a'));
+	uint8x16_t is_digit = vcltq_u8(digit, vdupq_n_u8(10));
+	uint8x16_t is_letter = vcltq_u8(letter, vdupq_n_u8(6));
+	uint8x16_t nibbles;
+	uint8x16_t bytes;
+
+	if (vminvq_u8(vorrq_u8(is_digit, is_letter)) == 0) return -1;
+	nibbles = vbslq_u8(is_digit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+	bytes = vorrq_u8(vshlq_n_u8(vuzp1q_u8(nibbles, nibbles), 4), vuzp2q_u8(nibbles, nibbles));
+	vst1_u8((uint8_t*) data, vget_low_u8(bytes));
+	return 0;
+}
+#define s_hex_decode_16_available
+
+#endif
+
+int extract_xml_slice_hex_decode(const extract_xml_slice_t *slice, char *data, size_t data_size)
+{
+	const char *c = slice->chars;
+	const char *c_end = c + slice->chars_num;
+	size_t      i = 0;
+	int         hi;
+	int         lo;
+
+	while (i < data_size)
+	{
+#ifdef s_hex_decode_16_available
+		/* Decode 16 characters at a time until we reach whitespace, then do
+		one byte with the scalar code below. */
+		while (data_size - i >= 8 && c_end - c >= 16)
+		{
+			if (s_hex_decode_16(c, data + i)) break;
+			c += 16;
+			i += 8;
+		}
+		if (i == data_size) break;
+#endif
+		while (c < c_end && (*c == ' ' || *c == '\n'))
+			c += 1;
+		if (c == c_end) goto error;
+		hi = s_hex_values[(unsigned char) *c];
+		if (hi < 0) goto error;
+		c += 1;
+		if (c == c_end) goto error;
+		lo = s_hex_values[(unsigned char) *c];
+		if (lo < 0) goto error;
+		c += 1;
+		data[i] = (char) (hi * 16 + lo);
+		i += 1;
+	}
+
+	return 0;
+
+error:
+	outf("Unrecognised hex character '%x' at offset %lli in image data",
+			(c < c_end) ? (unsigned char) *c : 0,
+			(long long) (c - slice->chars)
+			);
+	errno = EINVAL;
+	return -1;
+}
+
+void extract_xml_schema_init(
+		extract_xml_schema_t *schema,
+		const char *const    *names,
+		int                   names_num)
+{
+	int i;
+
+	assert(names_num <= EXTRACT_XML_SCHEMA_MAX);
+	schema->names_num = names_num;
+	for (i=0; i<names_num; ++i) {
+		schema->names[i] = names[i];
+		schema->names_len[i] = strlen(names[i]);
+		schema->positions[i] = i;
+	}
+}
+
+int extract_xml_schema_find(
+		extract_xml_schema_t          *schema,
+		const extract_xml_slice_tag_t *tag,
+		const extract_xml_slice_t    **o_values)
+{
+	int ret = 0;
+	int i;
+
+	for (i=0; i<schema->names_num; ++i) {
+		const char *name = schema->names[i];
+		size_t      name_len = schema->names_len[i];
+		int         position = schema->positions[i];
+
+		/* Look first where we found this attribute last time. */
+		if (position < tag->attributes_num
+				&& tag->attributes[position].name.chars_num == name_len
+				&& !memcmp(tag->attributes[position].name.chars, name, name_len)
+				) {
+			o_values[i] = &tag->attributes[position].value;
+			continue;
+		}
+		o_values[i] = NULL;
+		for (position=0; position<tag->attributes_num; ++position) {
+			if (tag->attributes[position].name.chars_num == name_len
+					&& !memcmp(tag->attributes[position].name.chars, name, name_len)
+					) {
+				o_values[i] = &tag->attributes[position].value;
+				schema->positions[i] = position;
+				break;
+			}
+		}
+		if (!o_values[i]) {
+			outf("Failed to find attribute '%s'", name);
+			errno = ESRCH;
+			ret = -1;
+		}
+	}
+
+	return ret;
+}
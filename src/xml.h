@@ -64,6 +64,195 @@ initialised, e.g. by by extract_xml_tag_init(). */
 int extract_xml_pparse_next(extract_buffer_t *buffer, extract_xml_tag_t *out);
 
 
+/* extract_xml_scanner_*(): faster alternative to extract_xml_pparse_*() that
+tokenises the same syntax but does not allocate per tag.
+
+Data is fetched in chunks with extract_buffer_read_chunk() and tags are
+returned as (pointer, length) slices into the chunk. Tags that span chunks
+are copied into an internal buffer, so a tag's slices are only valid until the
+next call of extract_xml_scanner_next(). */
+
+/* Reference to text that is not necessarily terminated by a zero char. */
+typedef struct {
+	const char *chars;
+	size_t      chars_num;
+} extract_xml_slice_t;
+
+typedef struct {
+	extract_xml_slice_t name;
+	extract_xml_slice_t value;
+} extract_xml_slice_attribute_t;
+
+/* Represents a single <...> XML tag plus trailing text. */
+typedef struct {
+	extract_xml_slice_t            name;
+	extract_xml_slice_attribute_t *attributes;
+	int                            attributes_num;
+	extract_xml_slice_t            text;
+} extract_xml_slice_tag_t;
+
+/* Offsets of an attribute within the current tag; used internally while a
+tag is being scanned. */
+typedef struct {
+	size_t name_begin;
+	size_t name_end;
+	size_t value_begin;
+	size_t value_end;
+	int    escaped;
+} extract_xml_scan_attribute_t;
+
+typedef struct {
+	extract_alloc_t              *alloc;
+	extract_buffer_t             *buffer;
+
+	/* Unread part of the current chunk. */
+	const char                   *pos;
+	const char                   *end;
+
+	/* Used by extract_buffer_read_chunk() if <buffer> has no cache. */
+	char                         *chunk;
+
+	/* Copy of the current tag if it spans chunks. */
+	extract_astring_t             carry;
+
+	/* Values of attributes that contain escapes. */
+	extract_astring_t             unescaped;
+
+	/* State of scan of current tag. */
+	int                           state;
+	int                           quote_single;
+	int                           quote_double;
+	int                           escape;
+	size_t                        name_end;
+	size_t                        text_begin;
+	size_t                        text_end;
+	extract_xml_scan_attribute_t *scan_attributes;
+	int                           scan_attributes_num;
+	int                           scan_attributes_max;
+	int                           attributes_max;
+
+	/* The most recent tag returned by extract_xml_scanner_next(). */
+	extract_xml_slice_tag_t       tag;
+} extract_xml_scanner_t;
+
+/* Initialises <scanner> and consumes the initial '<' from <buffer>.
+
+<prefix> and <prefix_size> are data that has already been read from <buffer>,
+for example when looking for a magic number; they are scanned before any
+further data from <buffer>. <prefix_size> must be at most 64KiB.
+
+Returns -1 with errno=ESRCH if we fail to read the first '<' due to EOF. On
+error, *scanner does not need to be passed to extract_xml_scanner_free(). */
+int extract_xml_scanner_init(
+		extract_alloc_t       *alloc,
+		extract_buffer_t      *buffer,
+		const char            *prefix,
+		size_t                 prefix_size,
+		extract_xml_scanner_t *scanner);
+
+/* Reads the next tag into scanner->tag.
+
+Returns 0 on success, or +1 if EOF, or -1 with errno set. Slices in
+scanner->tag are valid until the next call. */
+int extract_xml_scanner_next(extract_xml_scanner_t *scanner);
+
+/* Frees internal data. Does not close the buffer. */
+void extract_xml_scanner_free(extract_xml_scanner_t *scanner);
+
+/* Returns 1 if <slice> has same contents as <text>, otherwise 0. */
+int extract_xml_slice_is(const extract_xml_slice_t *slice, const char *text);
+
+/* Sets *string to contents of <slice>, reusing any existing allocation. */
+int extract_xml_slice_to_astring(
+		extract_alloc_t           *alloc,
+		const extract_xml_slice_t *slice,
+		extract_astring_t         *string);
+
+/* Returns value of specified attribute, or NULL if not found. */
+const extract_xml_slice_t *extract_xml_slice_tag_find(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name);
+
+/* Next few functions find numerical value of specified attribute, returning
+-1 with errno=ESRCH if not found, or -1 with errno=EINVAL or ERANGE if the
+value is invalid in the same way as extract_xml_str_to_*(). */
+
+int extract_xml_slice_tag_find_int(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name,
+		int                           *o_out);
+
+int extract_xml_slice_tag_find_uint(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name,
+		unsigned                      *o_out);
+
+int extract_xml_slice_tag_find_size(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name,
+		size_t                        *o_out);
+
+int extract_xml_slice_tag_find_double(
+		const extract_xml_slice_tag_t *tag,
+		const char                    *name,
+		double                        *o_out);
+
+
+/* Like extract_xml_str_to_*() but for slices.
+
+Values consisting only of an optional '-', decimal digits and an optional
+'.' followed by decimal digits (as written by mutool and gs) are converted
+directly. In this case extract_xml_slice_to_double() gives the same result
+as strtod() if there are at most 19 significant digits, at most 22 digits
+after the '.', and the digits fit in 53 bits. Anything else is passed to
+extract_xml_str_to_*(). */
+
+int extract_xml_slice_to_int(const extract_xml_slice_t *slice, int *o_out);
+
+int extract_xml_slice_to_uint(const extract_xml_slice_t *slice, unsigned *o_out);
+
+int extract_xml_slice_to_double(const extract_xml_slice_t *slice, double *o_out);
+
+/* Decodes <data_size> bytes from lowercase hex digits in <slice>, as written
+for compressed images in intermediate XML. Spaces and newlines are allowed
+between pairs of digits.
+
+Returns -1 with errno=EINVAL if we find any other character, or if <slice>
+ends before we have <data_size> bytes. */
+int extract_xml_slice_hex_decode(const extract_xml_slice_t *slice, char *data, size_t data_size);
+
+
+/* Maximum number of attributes in an extract_xml_schema_t. */
+#define EXTRACT_XML_SCHEMA_MAX 8
+
+/* Describes the attributes that we want from one kind of tag, e.g. <char>.
+
+Tags of one kind almost always have their attributes in the same order, so we
+remember where each attribute was found and look there first; this avoids
+comparing every attribute name for each tag. */
+typedef struct {
+	int         names_num;
+	const char *names[EXTRACT_XML_SCHEMA_MAX];
+	size_t      names_len[EXTRACT_XML_SCHEMA_MAX];
+	int         positions[EXTRACT_XML_SCHEMA_MAX];
+} extract_xml_schema_t;
+
+/* Initialises <schema> for the specified attribute names, which must remain
+valid for the lifetime of <schema>. */
+void extract_xml_schema_init(
+		extract_xml_schema_t *schema,
+		const char *const    *names,
+		int                   names_num);
+
+/* Sets o_values[i] to the value of attribute schema->names[i] in <tag>, or
+NULL if there is no such attribute. Returns -1 with errno=ESRCH if any are
+missing, otherwise 0. */
+int extract_xml_schema_find(
+		extract_xml_schema_t          *schema,
+		const extract_xml_slice_tag_t *tag,
+		const extract_xml_slice_t    **o_values);
+
+
 /* Returns pointer to value of specified attribute, or NULL if not found. */
 char *extract_xml_tag_attributes_find(extract_xml_tag_t *tag, const char *name);
 
@@ -1,14 +1,17 @@
+/* Category for allocations made with extract_malloc() etc. */
+#define extract_alloc_CATEGORY extract_alloc_category_ZIP
+
 #include "extract/alloc.h"
 
 #include "mem.h"
 #include "outf.h"
+#include "stats.h"
 #include "zip.h"
 
 #include <zlib.h>
 
 #include <assert.h>
 #include <errno.h>
-#include <limits.h>
 #include <time.h>
 
 #include "compat_stdint.h"
@@ -18,13 +21,24 @@ typedef struct
 {
 	int16_t  mtime;
 	int16_t  mdate;
-	int32_t  crc_sum;
-	int32_t  size_compressed;
-	int32_t  size_uncompressed;
+	uint32_t crc_sum;
+	uint64_t size_compressed;
+	uint64_t size_uncompressed;
 	char    *name;
-	uint32_t offset;
+	uint64_t offset;
+	uint16_t version_creator;
+	uint16_t version_extract;
+	uint16_t general_purpose_bit_flag;
+	uint16_t compression_method;
 	uint16_t attr_internal;
 	uint32_t attr_external;
+
+	/* Non-zero if the local file header has a Zip64 extended information
+	extra field, e.g. because we predicted that sizes could exceed
+	zip64_limit before compressing. The Central directory file header then
+	also has a Zip64 extra field containing both sizes, so that it agrees with
+	the local file header and data descriptor. */
+	int      zip64;
 } extract_zip_cd_file_t;
 
 struct extract_zip_t
@@ -49,6 +63,37 @@ struct extract_zip_t
 	uint16_t               file_attr_internal;
 	uint32_t               file_attr_external;
 	char                  *archive_comment;
+
+	/* Sizes and offsets >= zip64_limit are written using Zip64 extensions;
+	similarly numbers of files >= zip64_limit_num. */
+	uint64_t               zip64_limit;
+	int                    zip64_limit_num;
+};
+
+typedef struct
+{
+	char     *name;
+	uint16_t  version_creator;
+	uint16_t  version_extract;
+	uint16_t  general_purpose_bit_flag;
+	uint16_t  compression_method;
+	uint16_t  mtime;
+	uint16_t  mdate;
+	uint32_t  crc_sum;
+	uint64_t  size_compressed;
+	uint64_t  size_uncompressed;
+	uint64_t  offset;   /* Offset of local file header. */
+	uint16_t  attr_internal;
+	uint32_t  attr_external;
+} extract_zip_reader_file_t;
+
+struct extract_zip_reader_t
+{
+	extract_alloc_t           *alloc;
+	const unsigned char       *data;
+	size_t                     data_length;
+	extract_zip_reader_file_t *files;
+	int                        files_num;
 };
 
 int extract_zip_open(extract_buffer_t *buffer, extract_zip_t **o_zip)
@@ -114,6 +159,9 @@ int extract_zip_open(extract_buffer_t *buffer, extract_zip_t **o_zip)
 	zip->file_attr_external = (0100644 << 16) + 0;
 	if (extract_strdup(alloc, "Artifex", &zip->archive_comment)) goto end;
 
+	zip->zip64_limit = 0xffffffff;
+	zip->zip64_limit_num = 0xffff;
+
 	e = 0;
 end:
 
@@ -147,12 +195,11 @@ static int s_native_little_endinesss(void)
 }
 
 
-/* Allocation fns for zlib. */
+/* Allocation fns for zlib; <opaque> is an extract_alloc_t*. */
 
 static void *s_zalloc(void *opaque, unsigned items, unsigned size)
 {
-	extract_zip_t   *zip = opaque;
-	extract_alloc_t *alloc = extract_buffer_alloc(zip->buffer);
+	extract_alloc_t *alloc = opaque;
 	void            *ptr;
 
 	if (extract_malloc(alloc, &ptr, items*size)) return NULL;
@@ -162,13 +209,37 @@ static void *s_zalloc(void *opaque, unsigned items, unsigned size)
 
 static void s_zfree(void *opaque, void *ptr)
 {
-	extract_zip_t   *zip = opaque;
-	extract_alloc_t *alloc = extract_buffer_alloc(zip->buffer);
+	extract_alloc_t *alloc = opaque;
 
 	extract_free(alloc, &ptr);
 }
 
 
+/* Maximum number of bytes that we pass to zlib in one call. */
+static const size_t s_chunk_max = (size_t) 1 << 30;
+
+/* Returns CRC-32 of data, calling zlib's crc32() in chunks. */
+static uint32_t s_crc32(const void *data, size_t data_length)
+{
+	const unsigned char *p = data;
+	uLong                crc = crc32(0, NULL, 0);
+	while (data_length)
+	{
+		size_t n = (data_length > s_chunk_max) ? s_chunk_max : data_length;
+		crc = crc32(crc, p, (uInt) n);
+		p += n;
+		data_length -= n;
+	}
+	return (uint32_t) crc;
+}
+
+/* Returns an upper bound on the size of deflate compressed data; uses the same
+formula as zlib's compressBound(). */
+static uint64_t s_compress_bound(uint64_t n)
+{
+	return n + (n >> 12) + (n >> 14) + (n >> 25) + 13;
+}
+
 /* Uses zlib to write raw deflate compressed data to zip->buffer. */
 static int
 s_write_compressed(
@@ -185,7 +256,7 @@ s_write_compressed(
 
 	zstream.zalloc = s_zalloc;
 	zstream.zfree = s_zfree;
-	zstream.opaque = zip;
+	zstream.opaque = extract_buffer_alloc(zip->buffer);
 
 	/* We need to write raw deflate data, so we use deflateInit2() with -ve
 	windowBits. The values we use are deflateInit()'s defaults. */
@@ -203,9 +274,10 @@ s_write_compressed(
 		return -1;
 	}
 
-	/* Set zstream to read from specified data. */
+	/* Set zstream to read from specified data. zstream.avail_in is only an
+	unsigned int so we may need to do this in chunks; see below. */
 	zstream.next_in = (void*) data;
-	zstream.avail_in = (unsigned) data_length;
+	zstream.avail_in = 0;
 
 	/* We increment *o_compressed_length gradually so that if we return an
 	error, we still indicate how many butes of compressed data have been
@@ -220,6 +292,12 @@ s_write_compressed(
 		/* todo: write an extract_buffer_cache() function so we can write
 		directly into output buffer if it has a fn_cache. */
 		unsigned char   buffer[1024];
+		if (zstream.avail_in == 0)
+		{
+			size_t n = data_length - (size_t) ((const unsigned char*) zstream.next_in - (const unsigned char*) data);
+			if (n > s_chunk_max) n = s_chunk_max;
+			zstream.avail_in = (unsigned) n;
+		}
 		zstream.next_out = &buffer[0];
 		zstream.avail_out = sizeof(buffer);
 		ze = deflate(&zstream, zstream.avail_in ? Z_NO_FLUSH : Z_FINISH);
@@ -259,14 +337,69 @@ s_write_compressed(
 		zip->errno_ = errno;
 		return -1;
 	}
-	if (o_compressed_length)
+	if (o_compressed_length && data_length <= s_chunk_max)
 	{
+		/* zstream.total_out is only a uLong so can wrap. */
 		assert(*o_compressed_length == (size_t) zstream.total_out);
 	}
 
 	return 0;
 }
 
+/* Returns non-zero if a quick deflate of the start of <data> suggests that it
+is not worth compressing, e.g. because it is already compressed. */
+static int s_incompressible(extract_zip_t *zip, const void *data, size_t data_length)
+{
+	int             ret = 0;
+	int             ze;
+	z_stream        zstream = {0};
+	unsigned char   buffer[4096];
+	size_t          probe_length = data_length;
+
+	if (probe_length > sizeof(buffer))  probe_length = sizeof(buffer);
+	if (probe_length < 64)  return 0;
+
+	zstream.zalloc = s_zalloc;
+	zstream.zfree = s_zfree;
+	zstream.opaque = extract_buffer_alloc(zip->buffer);
+
+	/* Use fastest compression level; we only want a rough idea. */
+	ze = deflateInit2(&zstream, 1 /*level*/, Z_DEFLATED, -15 /*windowBits*/, 8 /*memLevel*/, Z_DEFAULT_STRATEGY);
+	if (ze != Z_OK)
+	{
+		/* Let the real compression report any error. */
+		return 0;
+	}
+	zstream.next_in = (void*) data;
+	zstream.avail_in = (unsigned) probe_length;
+	zstream.next_out = &buffer[0];
+	zstream.avail_out = sizeof(buffer);
+	ze = deflate(&zstream, Z_FINISH);
+	if (ze == Z_STREAM_END)
+	{
+		/* Store if we save less than 1/16 of the size. */
+		ret = (zstream.total_out >= probe_length - probe_length / 16);
+	}
+	else if (ze == Z_OK)
+	{
+		/* Output buffer filled up so data expanded. */
+		ret = 1;
+	}
+	deflateEnd(&zstream);
+	return ret;
+}
+
+extract_zip_method_t extract_zip_method_for_type(const char *type)
+{
+	static const char *stored_types[] = { "jpg", "jpeg", "png", "gif", "jp2", "jpx", "webp" };
+	int i;
+	for (i=0; i<(int) (sizeof(stored_types) / sizeof(stored_types[0])); ++i)
+	{
+		if (!strcmp(type, stored_types[i]))  return extract_zip_method_STORE;
+	}
+	return extract_zip_method_AUTO;
+}
+
 /* Writes uncompressed data to zip->buffer. */
 static int s_write(extract_zip_t *zip, const void *data, size_t data_length)
 {
@@ -299,6 +432,12 @@ static int s_write_uint32(extract_zip_t *zip, uint32_t value)
 	}
 }
 
+static int s_write_uint64(extract_zip_t *zip, uint64_t value)
+{
+	s_write_uint32(zip, (uint32_t) value);
+	return s_write_uint32(zip, (uint32_t) (value >> 32));
+}
+
 static int s_write_uint16(extract_zip_t *zip, uint16_t value)
 {
 	if (s_native_little_endinesss()) {
@@ -319,21 +458,37 @@ static int s_write_string(extract_zip_t *zip, const char *text)
 }
 
 
-int extract_zip_write_file(
-		extract_zip_t *zip,
-		const void    *data,
-		size_t         data_length,
-		const char    *name)
+/* Writes a file to the zip archive.
+
+If <data_compressed> is not NULL, it must be raw deflate compressed (or stored
+if <method> is extract_zip_method_STORE) version of <data_length> bytes with
+CRC-32 <crc_sum>, and we copy it directly. Otherwise we compress or store
+<data> according to <method>.
+
+If the sizes are known before we write the file's data (stored or
+precompressed), we write them in the local file header; otherwise we set bit 3
+of General purpose bit flag and write zeros in the local file header, then
+write the actual values in a data descriptor after the compressed data.
+
+If sizes could exceed zip->zip64_limit, we write 0xffffffff in the local file
+header and the actual sizes in a Zip64 extended information extra field, and
+the data descriptor uses 8-byte sizes. */
+static int s_write_file(
+		extract_zip_t        *zip,
+		const void           *data,
+		size_t                data_length,
+		const void           *data_compressed,
+		size_t                data_compressed_length,
+		unsigned long         crc_sum,
+		const char           *name,
+		extract_zip_method_t  method)
 {
 	int                    e = -1;
 	extract_zip_cd_file_t *cd_file = NULL;
 	extract_alloc_t       *alloc = extract_buffer_alloc(zip->buffer);
+	int                    descriptor;
+	int                    zip64;
 
-	if (data_length > INT_MAX) {
-		assert(0);
-		errno = EINVAL;
-		return -1;
-	}
 	/* Create central directory file header for later. */
 	if (extract_realloc2(
 			alloc,
@@ -346,65 +501,120 @@ int extract_zip_write_file(
 
 	cd_file->mtime = zip->mtime;
 	cd_file->mdate = zip->mdate;
-	cd_file->crc_sum = (int32_t) crc32(crc32(0, NULL, 0), data, (int) data_length);
-	cd_file->size_uncompressed = (int) data_length;
-	if (zip->compression_method == 0)
+	cd_file->size_uncompressed = data_length;
+	if (data_compressed)
 	{
-		cd_file->size_compressed = cd_file->size_uncompressed;
+		cd_file->crc_sum = (uint32_t) crc_sum;
+		cd_file->compression_method = (method == extract_zip_method_STORE) ? 0 : Z_DEFLATED;
+		cd_file->size_compressed = data_compressed_length;
+		descriptor = 0;
 	}
+	else
+	{
+		cd_file->crc_sum = s_crc32(data, data_length);
+		if (method == extract_zip_method_AUTO)
+		{
+			method = s_incompressible(zip, data, data_length) ? extract_zip_method_STORE : extract_zip_method_DEFLATE;
+		}
+		cd_file->compression_method = (method == extract_zip_method_STORE) ? 0 : zip->compression_method;
+		if (cd_file->compression_method == 0)
+		{
+			cd_file->size_compressed = cd_file->size_uncompressed;
+		}
+		descriptor = (cd_file->compression_method != 0);
+	}
+	if (descriptor)
+	{
+		zip64 = (s_compress_bound(cd_file->size_uncompressed) >= zip->zip64_limit);
+	}
+	else
+	{
+		zip64 = (cd_file->size_uncompressed >= zip->zip64_limit
+				|| cd_file->size_compressed >= zip->zip64_limit);
+	}
+	cd_file->version_extract = (zip64) ? 45 : zip->version_extract;   /* 45 means 4.5, needed for Zip64. */
+	cd_file->zip64 = zip64;
 	if (extract_strdup(alloc, name, &cd_file->name)) goto end;
-	cd_file->offset = (int) extract_buffer_pos(zip->buffer);
+	cd_file->offset = extract_buffer_pos(zip->buffer);
+	cd_file->version_creator = zip->version_creator;
+	cd_file->general_purpose_bit_flag = zip->general_purpose_bit_flag;
+	if (descriptor) cd_file->general_purpose_bit_flag |= 8;
 	cd_file->attr_internal = zip->file_attr_internal;
 	cd_file->attr_external = zip->file_attr_external;
 	if (!cd_file->name) goto end;
 
-	/* Write local file header. If we are using compression, we set bit 3 of
-	General purpose bit flag and write zeros for crc-32, compressed size and
-	uncompressed size; then we write the actual values in data descriptor after
-	the compressed data. */
+	/* Write local file header. */
 	{
 		const char extra_local[] = "";  /* Modify for testing. */
-		uint16_t general_purpose_bit_flag = zip->general_purpose_bit_flag;
-		if (zip->compression_method)    general_purpose_bit_flag |= 8;
 		s_write_uint32(zip, 0x04034b50);
-		s_write_uint16(zip, zip->version_extract);          /* Version needed to extract (minimum). */
-		s_write_uint16(zip, general_purpose_bit_flag);      /* General purpose bit flag */
-		s_write_uint16(zip, zip->compression_method);       /* Compression method */
+		s_write_uint16(zip, cd_file->version_extract);      /* Version needed to extract (minimum). */
+		s_write_uint16(zip, cd_file->general_purpose_bit_flag);  /* General purpose bit flag */
+		s_write_uint16(zip, cd_file->compression_method);   /* Compression method */
 		s_write_uint16(zip, cd_file->mtime);                /* File last modification time */
 		s_write_uint16(zip, cd_file->mdate);                /* File last modification date */
-		if (zip->compression_method)
+		s_write_uint32(zip, (descriptor) ? 0 : cd_file->crc_sum);  /* CRC-32 of uncompressed data */
+		if (zip64)
+		{
+			s_write_uint32(zip, 0xffffffff);                /* Compressed size */
+			s_write_uint32(zip, 0xffffffff);                /* Uncompressed size */
+		}
+		else if (descriptor)
 		{
-			s_write_uint32(zip, 0);                         /* CRC-32 of uncompressed data */
 			s_write_uint32(zip, 0);                         /* Compressed size */
 			s_write_uint32(zip, 0);                         /* Uncompressed size */
 		}
 		else
 		{
-			s_write_uint32(zip, cd_file->crc_sum);          /* CRC-32 of uncompressed data */
-			s_write_uint32(zip, cd_file->size_compressed);  /* Compressed size */
-			s_write_uint32(zip, cd_file->size_uncompressed);/* Uncompressed size */
+			s_write_uint32(zip, (uint32_t) cd_file->size_compressed);    /* Compressed size */
+			s_write_uint32(zip, (uint32_t) cd_file->size_uncompressed);  /* Uncompressed size */
 		}
 		s_write_uint16(zip, (uint16_t) strlen(name));       /* File name length (n) */
-		s_write_uint16(zip, sizeof(extra_local)-1);         /* Extra field length (m) */
+		s_write_uint16(zip, (uint16_t) (sizeof(extra_local)-1 + ((zip64) ? 20 : 0)));  /* Extra field length (m) */
 		s_write_string(zip, cd_file->name);                 /* File name */
 		s_write(zip, extra_local, sizeof(extra_local)-1);   /* Extra field */
+		if (zip64)
+		{
+			/* Zip64 extended information extra field. Local header must
+			contain both sizes. */
+			s_write_uint16(zip, 0x0001);                    /* Tag */
+			s_write_uint16(zip, 16);                        /* Size of remaining data */
+			s_write_uint64(zip, (descriptor) ? 0 : cd_file->size_uncompressed);  /* Uncompressed size */
+			s_write_uint64(zip, (descriptor) ? 0 : cd_file->size_compressed);    /* Compressed size */
+		}
 	}
 
-	if (zip->compression_method)
+	if (data_compressed)
+	{
+		/* Copy precompressed data. */
+		s_write(zip, data_compressed, data_compressed_length);
+	}
+	else if (cd_file->compression_method)
 	{
 		/* Write compressed data. */
-		size_t  data_length_compressed;
+		size_t                 data_length_compressed;
+		extract_probe_timer_t  timer;
+		extract_probe_begin(extract_buffer_get_probe(zip->buffer), extract_stage_ZIP, &timer);
 		s_write_compressed(zip, data, data_length, &data_length_compressed);
-		cd_file->size_compressed = (int) data_length_compressed;
+		extract_probe_end(extract_buffer_get_probe(zip->buffer), extract_stage_ZIP, &timer);
+		cd_file->size_compressed = data_length_compressed;
 
 		/* Write data descriptor. */
 		s_write_uint32(zip, 0x08074b50);                    /* Data descriptor signature */
 		s_write_uint32(zip, cd_file->crc_sum);              /* CRC-32 of uncompressed data */
-		s_write_uint32(zip, cd_file->size_compressed);      /* Compressed size */
-		s_write_uint32(zip, cd_file->size_uncompressed);    /* Uncompressed size */
+		if (zip64)
+		{
+			s_write_uint64(zip, cd_file->size_compressed);  /* Compressed size */
+			s_write_uint64(zip, cd_file->size_uncompressed);/* Uncompressed size */
+		}
+		else
+		{
+			s_write_uint32(zip, (uint32_t) cd_file->size_compressed);    /* Compressed size */
+			s_write_uint32(zip, (uint32_t) cd_file->size_uncompressed);  /* Uncompressed size */
+		}
 	}
 	else
 	{
+		/* Write stored data directly from caller's buffer. */
 		s_write(zip, data, data_length);
 	}
 
@@ -428,11 +638,47 @@ end:
 	return e;
 }
 
+int extract_zip_write_file(
+		extract_zip_t *zip,
+		const void    *data,
+		size_t         data_length,
+		const char    *name)
+{
+	return s_write_file(zip, data, data_length, NULL, 0, 0, name, extract_zip_method_DEFLATE);
+}
+
+int extract_zip_write_file_method(
+		extract_zip_t        *zip,
+		const void           *data,
+		size_t                data_length,
+		const char           *name,
+		extract_zip_method_t  method)
+{
+	return s_write_file(zip, data, data_length, NULL, 0, 0, name, method);
+}
+
+int extract_zip_write_file_precompressed(
+		extract_zip_t *zip,
+		const void    *data_compressed,
+		size_t         data_compressed_length,
+		size_t         data_length,
+		unsigned long  crc_sum,
+		const char    *name)
+{
+	return s_write_file(zip, NULL, data_length, data_compressed, data_compressed_length, crc_sum, name, extract_zip_method_DEFLATE);
+}
+
+void extract_zip_set_zip64_limits(extract_zip_t *zip, size_t limit, int limit_num)
+{
+	zip->zip64_limit = limit;
+	zip->zip64_limit_num = limit_num;
+}
+
 int extract_zip_close(extract_zip_t **pzip)
 {
 	int              e = -1;
-	size_t           pos;
-	size_t           len;
+	uint64_t         pos;
+	uint64_t         len;
 	int              i;
 	extract_zip_t   *zip = *pzip;
 	extract_alloc_t *alloc;
@@ -449,38 +695,86 @@ int extract_zip_close(extract_zip_t **pzip)
 		const char extra[] = "";
 		size_t pos2 = extract_buffer_pos(zip->buffer);
 		extract_zip_cd_file_t* cd_file = &zip->cd_files[i];
+		/* Values that need to go in Zip64 extended information extra field.
+		If the local file header has a Zip64 extra field, we always include
+		both sizes so that readers which check consistency with the local file
+		header and data descriptor are happy. */
+		int zip64_size_uncompressed = (cd_file->zip64 || cd_file->size_uncompressed >= zip->zip64_limit);
+		int zip64_size_compressed = (cd_file->zip64 || cd_file->size_compressed >= zip->zip64_limit);
+		int zip64_offset = (cd_file->offset >= zip->zip64_limit);
+		int zip64_extra_size = 8 * (zip64_size_uncompressed + zip64_size_compressed + zip64_offset);
+		uint16_t version_extract = cd_file->version_extract;
+		if (zip64_extra_size)   version_extract = 45;
 		s_write_uint32(zip, 0x02014b50);
-		s_write_uint16(zip, zip->version_creator);              /* Version made by, copied from command-line zip. */
-		s_write_uint16(zip, zip->version_extract);              /* Version needed to extract (minimum). */
-		s_write_uint16(zip, zip->general_purpose_bit_flag);     /* General purpose bit flag */
-		s_write_uint16(zip, zip->compression_method);           /* Compression method */
+		s_write_uint16(zip, cd_file->version_creator);          /* Version made by, copied from command-line zip. */
+		s_write_uint16(zip, version_extract);                   /* Version needed to extract (minimum). */
+		s_write_uint16(zip, cd_file->general_purpose_bit_flag); /* General purpose bit flag */
+		s_write_uint16(zip, cd_file->compression_method);       /* Compression method */
 		s_write_uint16(zip, cd_file->mtime);                    /* File last modification time */
 		s_write_uint16(zip, cd_file->mdate);                    /* File last modification date */
 		s_write_uint32(zip, cd_file->crc_sum);                  /* CRC-32 of uncompressed data */
-		s_write_uint32(zip, cd_file->size_compressed);          /* Compressed size */
-		s_write_uint32(zip, cd_file->size_uncompressed);        /* Uncompressed size */
+		s_write_uint32(zip, (zip64_size_compressed) ? 0xffffffff : (uint32_t) cd_file->size_compressed);     /* Compressed size */
+		s_write_uint32(zip, (zip64_size_uncompressed) ? 0xffffffff : (uint32_t) cd_file->size_uncompressed); /* Uncompressed size */
 		s_write_uint16(zip, (uint16_t) strlen(cd_file->name));  /* File name length (n) */
-		s_write_uint16(zip, sizeof(extra)-1);                   /* Extra field length (m) */
+		s_write_uint16(zip, (uint16_t) (sizeof(extra)-1 + ((zip64_extra_size) ? 4 + zip64_extra_size : 0)));  /* Extra field length (m) */
 		s_write_uint16(zip, 0);                                 /* File comment length (k) */
 		s_write_uint16(zip, 0);                                 /* Disk number where file starts */
 		s_write_uint16(zip, cd_file->attr_internal);            /* Internal file attributes */
 		s_write_uint32(zip, cd_file->attr_external);            /* External file attributes. */
-		s_write_uint32(zip, cd_file->offset);                   /* Offset of local file header. */
+		s_write_uint32(zip, (zip64_offset) ? 0xffffffff : (uint32_t) cd_file->offset);  /* Offset of local file header. */
 		s_write_string(zip, cd_file->name);                     /* File name */
 		s_write(zip, extra, sizeof(extra)-1);                   /* Extra field */
+		if (zip64_extra_size)
+		{
+			/* Zip64 extended information extra field, containing only the
+			values that we set to 0xffffffff above, in this order. */
+			s_write_uint16(zip, 0x0001);                                    /* Tag */
+			s_write_uint16(zip, (uint16_t) zip64_extra_size);               /* Size of remaining data */
+			if (zip64_size_uncompressed)    s_write_uint64(zip, cd_file->size_uncompressed);
+			if (zip64_size_compressed)      s_write_uint64(zip, cd_file->size_compressed);
+			if (zip64_offset)               s_write_uint64(zip, cd_file->offset);
+		}
 		len += extract_buffer_pos(zip->buffer) - pos2;
 		extract_free(alloc, &cd_file->name);
 	}
 	extract_free(alloc, &zip->cd_files);
 
-	/* Write End of central directory record. */
-	s_write_uint32(zip, 0x06054b50);
-	s_write_uint16(zip, 0);                             /* Number of this disk */
-	s_write_uint16(zip, 0);                             /* Disk where central directory starts */
-	s_write_uint16(zip, (uint16_t) zip->cd_files_num);  /* Number of central directory records on this disk */
-	s_write_uint16(zip, (uint16_t) zip->cd_files_num);  /* Total number of central directory records */
-	s_write_uint32(zip, (int) len);                     /* Size of central directory (bytes) */
-	s_write_uint32(zip, (int) pos);                     /* Offset of start of central directory, relative to start of archive */
+	if (zip->cd_files_num >= zip->zip64_limit_num
+			|| len >= zip->zip64_limit
+			|| pos >= zip->zip64_limit
+			)
+	{
+		/* Write Zip64 end of central directory record and locator. */
+		uint64_t pos_zip64 = extract_buffer_pos(zip->buffer);
+		s_write_uint32(zip, 0x06064b50);
+		s_write_uint64(zip, 44);                            /* Size of remaining record */
+		s_write_uint16(zip, zip->version_creator);          /* Version made by */
+		s_write_uint16(zip, 45);                            /* Version needed to extract (minimum) */
+		s_write_uint32(zip, 0);                             /* Number of this disk */
+		s_write_uint32(zip, 0);                             /* Disk where central directory starts */
+		s_write_uint64(zip, zip->cd_files_num);             /* Number of central directory records on this disk */
+		s_write_uint64(zip, zip->cd_files_num);             /* Total number of central directory records */
+		s_write_uint64(zip, len);                           /* Size of central directory (bytes) */
+		s_write_uint64(zip, pos);                           /* Offset of start of central directory */
+
+		s_write_uint32(zip, 0x07064b50);
+		s_write_uint32(zip, 0);                             /* Disk with Zip64 end of central directory record */
+		s_write_uint64(zip, pos_zip64);                     /* Offset of Zip64 end of central directory record */
+		s_write_uint32(zip, 1);                             /* Total number of disks */
+	}
+
+	/* Write End of central directory record. Values that don't fit are set
+	to all ones, indicating that they are in the Zip64 record. */
+	{
+		uint16_t num = (zip->cd_files_num >= zip->zip64_limit_num) ? 0xffff : (uint16_t) zip->cd_files_num;
+		s_write_uint32(zip, 0x06054b50);
+		s_write_uint16(zip, 0);                             /* Number of this disk */
+		s_write_uint16(zip, 0);                             /* Disk where central directory starts */
+		s_write_uint16(zip, num);                           /* Number of central directory records on this disk */
+		s_write_uint16(zip, num);                           /* Total number of central directory records */
+		s_write_uint32(zip, (len >= zip->zip64_limit) ? 0xffffffff : (uint32_t) len);  /* Size of central directory (bytes) */
+		s_write_uint32(zip, (pos >= zip->zip64_limit) ? 0xffffffff : (uint32_t) pos);  /* Offset of start of central directory, relative to start of archive */
+	}
 
 	s_write_uint16(zip, (uint16_t) strlen(zip->archive_comment));  /* Comment length (n) */
 	s_write_string(zip, zip->archive_comment);
@@ -494,3 +788,476 @@ int extract_zip_close(extract_zip_t **pzip)
 
 	return e;
 }
+
+
+/* Zip file reading. */
+
+static uint16_t s_read_uint16(const unsigned char *p)
+{
+	return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+static uint32_t s_read_uint32(const unsigned char *p)
+{
+	return (uint32_t) p[0]
+			| ((uint32_t) p[1] << 8)
+			| ((uint32_t) p[2] << 16)
+			| ((uint32_t) p[3] << 24);
+}
+
+static uint64_t s_read_uint64(const unsigned char *p)
+{
+	return (uint64_t) s_read_uint32(p) | ((uint64_t) s_read_uint32(p + 4) << 32);
+}
+
+/* Returns non-zero if reader->data has <n> bytes at <offset>. */
+static int s_reader_have(extract_zip_reader_t *reader, uint64_t offset, uint64_t n)
+{
+	return offset <= reader->data_length && n <= reader->data_length - offset;
+}
+
+static int s_reader_invalid(const char *message)
+{
+	outf("Invalid zip file: %s", message);
+	errno = EINVAL;
+	return -1;
+}
+
+/* Finds End of central directory record, and Zip64 end of central directory
+record if present, and sets *o_* to describe the Central directory. */
+static int s_reader_find_cd(
+		extract_zip_reader_t *reader,
+		uint64_t             *o_cd_num,
+		uint64_t             *o_cd_size,
+		uint64_t             *o_cd_offset)
+{
+	const unsigned char *data = reader->data;
+	size_t               pos;
+	size_t               pos_min;
+
+	if (reader->data_length < 22) return s_reader_invalid("too short");
+
+	/* End of central directory record is at least 22 bytes and is followed
+	by a comment of up to 65535 bytes. */
+	pos = reader->data_length - 22;
+	pos_min = (pos > 65535) ? pos - 65535 : 0;
+	for(;;)
+	{
+		if (s_read_uint32(data + pos) == 0x06054b50)    break;
+		if (pos == pos_min) return s_reader_invalid("cannot find End of central directory record");
+		pos -= 1;
+	}
+	*o_cd_num = s_read_uint16(data + pos + 10);
+	*o_cd_size = s_read_uint32(data + pos + 12);
+	*o_cd_offset = s_read_uint32(data + pos + 16);
+
+	if (pos >= 20 && s_read_uint32(data + pos - 20) == 0x07064b50)
+	{
+		/* Zip64 end of central directory locator. */
+		uint64_t pos64 = s_read_uint64(data + pos - 20 + 8);
+		if (!s_reader_have(reader, pos64, 56) || s_read_uint32(data + pos64) != 0x06064b50)
+		{
+			return s_reader_invalid("bad Zip64 end of central directory record");
+		}
+		*o_cd_num = s_read_uint64(data + pos64 + 32);
+		*o_cd_size = s_read_uint64(data + pos64 + 40);
+		*o_cd_offset = s_read_uint64(data + pos64 + 48);
+	}
+	if (!s_reader_have(reader, *o_cd_offset, *o_cd_size))
+	{
+		return s_reader_invalid("bad Central directory size/offset");
+	}
+	return 0;
+}
+
+/* Reads values from Zip64 extended information extra field for fields that
+are 0xffffffff. */
+static int s_reader_zip64_extra(
+		const unsigned char       *extra,
+		uint16_t                   extra_length,
+		extract_zip_reader_file_t *file,
+		uint32_t                   size_compressed32,
+		uint32_t                   size_uncompressed32,
+		uint32_t                   offset32)
+{
+	const unsigned char *p = extra;
+	const unsigned char *end = extra + extra_length;
+	while (p + 4 <= end)
+	{
+		uint16_t tag = s_read_uint16(p);
+		uint16_t size = s_read_uint16(p + 2);
+		p += 4;
+		if (p + size > end) break;
+		if (tag == 0x0001)
+		{
+			const unsigned char *q = p;
+			if (size_uncompressed32 == 0xffffffff)
+			{
+				if (q + 8 > p + size)   return s_reader_invalid("short Zip64 extra field");
+				file->size_uncompressed = s_read_uint64(q);
+				q += 8;
+			}
+			if (size_compressed32 == 0xffffffff)
+			{
+				if (q + 8 > p + size)   return s_reader_invalid("short Zip64 extra field");
+				file->size_compressed = s_read_uint64(q);
+				q += 8;
+			}
+			if (offset32 == 0xffffffff)
+			{
+				if (q + 8 > p + size)   return s_reader_invalid("short Zip64 extra field");
+				file->offset = s_read_uint64(q);
+			}
+			return 0;
+		}
+		p += size;
+	}
+	return 0;
+}
+
+int extract_zip_reader_open(
+		extract_alloc_t       *alloc,
+		const void            *data,
+		size_t                 data_length,
+		extract_zip_reader_t **o_reader)
+{
+	int                   e = -1;
+	extract_zip_reader_t *reader = NULL;
+	uint64_t              cd_num;
+	uint64_t              cd_size;
+	uint64_t              cd_offset;
+	uint64_t              pos;
+	uint64_t              i;
+
+	if (extract_malloc(alloc, &reader, sizeof(*reader))) goto end;
+	reader->alloc = alloc;
+	reader->data = data;
+	reader->data_length = data_length;
+	reader->files = NULL;
+	reader->files_num = 0;
+
+	if (s_reader_find_cd(reader, &cd_num, &cd_size, &cd_offset)) goto end;
+	if (cd_num > cd_size / 46)
+	{
+		s_reader_invalid("bad number of files");
+		goto end;
+	}
+	if (extract_malloc(alloc, &reader->files, sizeof(*reader->files) * (size_t) cd_num)) goto end;
+
+	pos = cd_offset;
+	for (i=0; i<cd_num; ++i)
+	{
+		const unsigned char       *p = reader->data + pos;
+		extract_zip_reader_file_t *file = &reader->files[reader->files_num];
+		uint16_t                   name_length;
+		uint16_t                   extra_length;
+		uint16_t                   comment_length;
+		uint32_t                   size_compressed32;
+		uint32_t                   size_uncompressed32;
+		uint32_t                   offset32;
+
+		if (!s_reader_have(reader, pos, 46) || s_read_uint32(p) != 0x02014b50)
+		{
+			s_reader_invalid("bad Central directory file header");
+			goto end;
+		}
+		name_length = s_read_uint16(p + 28);
+		extra_length = s_read_uint16(p + 30);
+		comment_length = s_read_uint16(p + 32);
+		if (!s_reader_have(reader, pos, 46 + name_length + extra_length + comment_length))
+		{
+			s_reader_invalid("truncated Central directory file header");
+			goto end;
+		}
+		size_compressed32 = s_read_uint32(p + 20);
+		size_uncompressed32 = s_read_uint32(p + 24);
+		offset32 = s_read_uint32(p + 42);
+		file->version_creator = s_read_uint16(p + 4);
+		file->version_extract = s_read_uint16(p + 6);
+		file->general_purpose_bit_flag = s_read_uint16(p + 8);
+		file->compression_method = s_read_uint16(p + 10);
+		file->mtime = s_read_uint16(p + 12);
+		file->mdate = s_read_uint16(p + 14);
+		file->crc_sum = s_read_uint32(p + 16);
+		file->attr_internal = s_read_uint16(p + 36);
+		file->attr_external = s_read_uint32(p + 38);
+		file->size_compressed = size_compressed32;
+		file->size_uncompressed = size_uncompressed32;
+		file->offset = offset32;
+		if (s_reader_zip64_extra(
+				p + 46 + name_length,
+				extra_length,
+				file,
+				size_compressed32,
+				size_uncompressed32,
+				offset32
+				)) goto end;
+		if (extract_malloc(alloc, &file->name, name_length + 1)) goto end;
+		memcpy(file->name, p + 46, name_length);
+		file->name[name_length] = 0;
+		reader->files_num += 1;
+
+		pos += 46 + name_length + extra_length + comment_length;
+	}
+
+	e = 0;
+end:
+
+	if (e) extract_zip_reader_close(&reader);
+	*o_reader = reader;
+	return e;
+}
+
+int extract_zip_reader_files_num(extract_zip_reader_t *reader)
+{
+	return reader->files_num;
+}
+
+const char *extract_zip_reader_file_name(extract_zip_reader_t *reader, int i)
+{
+	return reader->files[i].name;
+}
+
+/* Returns non-zero if local file header <p> has a Zip64 extended information
+extra field. Caller must have checked that the header's name and extra field
+are within the data. */
+static int s_reader_local_zip64(const unsigned char *p)
+{
+	uint16_t             extra_length = s_read_uint16(p + 28);
+	const unsigned char *extra = p + 30 + s_read_uint16(p + 26);
+	const unsigned char *q;
+	for (q = extra; q + 4 <= extra + extra_length; q += 4 + s_read_uint16(q + 2))
+	{
+		if (s_read_uint16(q) == 0x0001) return 1;
+	}
+	return 0;
+}
+
+/* Sets *o_data to point to <file>'s compressed data, after its local file
+header.
+
+If o_length is not NULL, we set *o_length to the total length of <file>'s
+local file header, compressed data and data descriptor (if any), i.e. the
+number of bytes starting at reader->data + file->offset that represent the
+file. */
+static int s_reader_file_data(
+		extract_zip_reader_t             *reader,
+		const extract_zip_reader_file_t  *file,
+		const unsigned char             **o_data,
+		uint64_t                         *o_length)
+{
+	const unsigned char *p = reader->data + file->offset;
+	uint64_t             pos;
+	uint16_t             extra_length;
+
+	if (!s_reader_have(reader, file->offset, 30) || s_read_uint32(p) != 0x04034b50)
+	{
+		return s_reader_invalid("bad Local file header");
+	}
+	extra_length = s_read_uint16(p + 28);
+	pos = file->offset + 30 + s_read_uint16(p + 26) + extra_length;
+	if (!s_reader_have(reader, pos, file->size_compressed))
+	{
+		return s_reader_invalid("truncated file data");
+	}
+	*o_data = reader->data + pos;
+
+	if (o_length)
+	{
+		pos += file->size_compressed;
+		if (s_read_uint16(p + 6) & 8)
+		{
+			/* Data descriptor, with optional signature. Sizes are 8 bytes if
+			local header has Zip64 extended information extra field. */
+			int zip64 = s_reader_local_zip64(p);
+			if (s_reader_have(reader, pos, 4) && s_read_uint32(reader->data + pos) == 0x08074b50)
+			{
+				pos += 4;
+			}
+			pos += (zip64) ? 4 + 8 + 8 : 4 + 4 + 4;
+			if (pos > reader->data_length)
+			{
+				return s_reader_invalid("truncated data descriptor");
+			}
+		}
+		*o_length = pos - file->offset;
+	}
+	return 0;
+}
+
+int extract_zip_reader_read_file(
+		extract_zip_reader_t  *reader,
+		int                    i,
+		char                 **o_data,
+		size_t                *o_data_length)
+{
+	int                              e = -1;
+	const extract_zip_reader_file_t *file = &reader->files[i];
+	const unsigned char             *data_compressed;
+	char                            *data = NULL;
+	size_t                           data_length = (size_t) file->size_uncompressed;
+	z_stream                         zstream = {0};
+	int                              zstream_valid = 0;
+
+	if (s_reader_file_data(reader, file, &data_compressed, NULL)) goto end;
+	if (data_length != file->size_uncompressed || data_length == SIZE_MAX)
+	{
+		errno = ENOMEM;
+		goto end;
+	}
+	if (extract_malloc(reader->alloc, &data, data_length + 1)) goto end;
+
+	if (file->compression_method == 0)
+	{
+		if (file->size_compressed != file->size_uncompressed)
+		{
+			s_reader_invalid("inconsistent sizes for stored file");
+			goto end;
+		}
+		memcpy(data, data_compressed, data_length);
+	}
+	else if (file->compression_method == Z_DEFLATED)
+	{
+		size_t  in_pos = 0;
+		size_t  out_pos = 0;
+		int     ze;
+
+		zstream.zalloc = s_zalloc;
+		zstream.zfree = s_zfree;
+		zstream.opaque = reader->alloc;
+		ze = inflateInit2(&zstream, -15 /*windowBits*/);
+		if (ze != Z_OK)
+		{
+			errno = (ze == Z_MEM_ERROR) ? ENOMEM : EINVAL;
+			outf("inflateInit2() failed ze=%i", ze);
+			goto end;
+		}
+		zstream_valid = 1;
+		for(;;)
+		{
+			size_t in_n = (size_t) file->size_compressed - in_pos;
+			size_t out_n = data_length - out_pos;
+			if (in_n > s_chunk_max)     in_n = s_chunk_max;
+			if (out_n > s_chunk_max)    out_n = s_chunk_max;
+			zstream.next_in = (void*) (data_compressed + in_pos);
+			zstream.avail_in = (unsigned) in_n;
+			zstream.next_out = (void*) (data + out_pos);
+			zstream.avail_out = (unsigned) out_n;
+			ze = inflate(&zstream, Z_NO_FLUSH);
+			in_pos += in_n - zstream.avail_in;
+			out_pos += out_n - zstream.avail_out;
+			if (ze == Z_STREAM_END) break;
+			if (ze != Z_OK || (in_n == zstream.avail_in && out_n == zstream.avail_out))
+			{
+				/* Error or no progress. */
+				s_reader_invalid("inflate() failed");
+				goto end;
+			}
+		}
+		if (out_pos != data_length)
+		{
+			s_reader_invalid("wrong uncompressed size");
+			goto end;
+		}
+	}
+	else
+	{
+		outf("Unsupported compression method %i for: %s", file->compression_method, file->name);
+		errno = ENOTSUP;
+		goto end;
+	}
+	if (s_crc32(data, data_length) != file->crc_sum)
+	{
+		s_reader_invalid("CRC mismatch");
+		goto end;
+	}
+	data[data_length] = 0;
+
+	e = 0;
+end:
+
+	if (zstream_valid)  inflateEnd(&zstream);
+	if (e)
+	{
+		extract_free(reader->alloc, &data);
+	}
+	else
+	{
+		if (o_data_length)  *o_data_length = data_length;
+	}
+	*o_data = data;
+	return e;
+}
+
+int extract_zip_copy_file(
+		extract_zip_t        *zip,
+		extract_zip_reader_t *reader,
+		int                   i)
+{
+	int                              e = -1;
+	const extract_zip_reader_file_t *file = &reader->files[i];
+	extract_zip_cd_file_t           *cd_file = NULL;
+	extract_alloc_t                 *alloc = extract_buffer_alloc(zip->buffer);
+	const unsigned char             *data_compressed;
+	uint64_t                         length;
+
+	if (s_reader_file_data(reader, file, &data_compressed, &length)) goto end;
+
+	/* Create central directory file header for later, reusing values from
+	<reader>'s central directory. */
+	if (extract_realloc2(
+			alloc,
+			&zip->cd_files,
+			sizeof(extract_zip_cd_file_t) * zip->cd_files_num,
+			sizeof(extract_zip_cd_file_t) * (zip->cd_files_num+1)
+			)) goto end;
+	cd_file = &zip->cd_files[zip->cd_files_num];
+	cd_file->name = NULL;
+	if (extract_strdup(alloc, file->name, &cd_file->name)) goto end;
+	cd_file->mtime = (int16_t) file->mtime;
+	cd_file->mdate = (int16_t) file->mdate;
+	cd_file->crc_sum = file->crc_sum;
+	cd_file->size_compressed = file->size_compressed;
+	cd_file->size_uncompressed = file->size_uncompressed;
+	cd_file->offset = extract_buffer_pos(zip->buffer);
+	cd_file->version_creator = file->version_creator;
+	cd_file->version_extract = file->version_extract;
+	cd_file->general_purpose_bit_flag = file->general_purpose_bit_flag;
+	cd_file->compression_method = file->compression_method;
+	cd_file->attr_internal = file->attr_internal;
+	cd_file->attr_external = file->attr_external;
+	cd_file->zip64 = s_reader_local_zip64(reader->data + file->offset);
+
+	/* Copy local file header, compressed data and data descriptor
+	byte-for-byte. */
+	s_write(zip, reader->data + file->offset, (size_t) length);
+
+	if (zip->errno_)    e = -1;
+	else if (zip->eof)  e = +1;
+	else e = 0;
+
+end:
+
+	if (e) {
+		if (cd_file) extract_free(alloc, &cd_file->name);
+	}
+	else {
+		zip->cd_files_num += 1;
+	}
+
+	return e;
+}
+
+void extract_zip_reader_close(extract_zip_reader_t **preader)
+{
+	extract_zip_reader_t *reader = *preader;
+	int                   i;
+
+	if (!reader) return;
+	for (i=0; i<reader->files_num; ++i)
+	{
+		extract_free(reader->alloc, &reader->files[i].name);
+	}
+	extract_free(reader->alloc, &reader->files);
+	extract_free(reader->alloc, preader);
+}
@@ -33,9 +33,33 @@ typedef struct extract_zip_t extract_zip_t;
 */
 int extract_zip_open(extract_buffer_t *buffer, extract_zip_t **o_zip);
 
+/* Compression method for an individual file within a zip archive. */
+typedef enum
+{
+	/* Store if a quick probe suggests that <data> is already compressed,
+	otherwise deflate. */
+	extract_zip_method_AUTO,
+
+	/* Always store, i.e. write <data> unchanged. */
+	extract_zip_method_STORE,
+
+	/* Always deflate. */
+	extract_zip_method_DEFLATE
+} extract_zip_method_t;
+
+/*
+	Returns compression method to use for file with type (extension) <type>,
+	e.g. "png". Types that are already compressed are stored; otherwise we
+	return extract_zip_method_AUTO.
+*/
+extract_zip_method_t extract_zip_method_for_type(const char *type);
+
 /*
 	Writes specified data into the zip file.
 
+	Always uses deflate compression; equivalent to
+	extract_zip_write_file_method() with extract_zip_method_DEFLATE.
+
 	Returns same as extract_buffer_write(): 0 on success, +1 if short write due to
 	EOF or -1 with errno set.
 
@@ -54,6 +78,61 @@ int extract_zip_write_file(
 		size_t         data_length,
 		const char    *name);
 
+/*
+	Like extract_zip_write_file() but with explicit compression method.
+
+	Stored files are written directly from data..+data_length without any
+	intermediate copy.
+
+	method:
+		extract_zip_method_AUTO, extract_zip_method_STORE or
+		extract_zip_method_DEFLATE.
+*/
+int extract_zip_write_file_method(
+		extract_zip_t        *zip,
+		const void           *data,
+		size_t                data_length,
+		const char           *name,
+		extract_zip_method_t  method);
+
+/*
+	Writes already-compressed data into the zip file, e.g. precompressed
+	template content. We copy <data_compressed> directly into the zip file
+	without any recompression.
+
+	zip:
+		From extract_zip_open().
+	data_compressed:
+		Raw deflate compressed data (as from zlib's deflate() with negative
+		windowBits).
+	data_compressed_length:
+		Length in bytes of <data_compressed>.
+	data_length:
+		Length in bytes of uncompressed data.
+	crc_sum:
+		CRC-32 of uncompressed data.
+	name:
+		Name of file within the zip file.
+*/
+int extract_zip_write_file_precompressed(
+		extract_zip_t *zip,
+		const void    *data_compressed,
+		size_t         data_compressed_length,
+		size_t         data_length,
+		unsigned long  crc_sum,
+		const char    *name);
+
+
+/*
+	Sets thresholds above which we use Zip64 extensions, for testing. Sizes and
+	offsets >= <limit> and numbers of files >= <limit_num> are written using
+	Zip64 extensions. Defaults are 0xffffffff and 0xffff, the largest values
+	that standard zip headers can represent.
+
+	Should be called before writing any files.
+*/
+void extract_zip_set_zip64_limits(extract_zip_t *zip, size_t limit, int limit_num);
+
 
 /*
 	Finishes writing the zip file (e.g. appends Central directory file headers
@@ -66,4 +145,71 @@ int extract_zip_write_file(
 */
 int extract_zip_close(extract_zip_t **pzip);
 
+
+/*
+	Support for reading zip file content.
+*/
+
+/* Abstract handle for reading zip file. */
+typedef struct extract_zip_reader_t extract_zip_reader_t;
+
+/*
+	Creates an extract_zip_reader_t for zip file content in memory, reading
+	the Central directory. Zip64 archives are supported.
+
+	Returns -1 with errno=EINVAL if <data> is not a valid zip file.
+
+	alloc:
+		Allocator.
+	data:
+	data_length:
+		Zip file content; must remain valid until extract_zip_reader_close().
+	o_reader:
+		Out-param.
+*/
+int extract_zip_reader_open(
+		extract_alloc_t       *alloc,
+		const void            *data,
+		size_t                 data_length,
+		extract_zip_reader_t **o_reader);
+
+/* Returns number of files in zip file. */
+int extract_zip_reader_files_num(extract_zip_reader_t *reader);
+
+/* Returns name of <i>-th file in zip file. */
+const char *extract_zip_reader_file_name(extract_zip_reader_t *reader, int i);
+
+/*
+	Decompresses <i>-th file into zero-terminated buffer. Supports stored and
+	deflated files, and checks CRC-32.
+
+	o_data:
+		Out-param; set to malloc'd buffer that caller should free.
+	o_data_length:
+		Out-param, can be NULL. Set to length of data excluding terminating
+		zero.
+*/
+int extract_zip_reader_read_file(
+		extract_zip_reader_t  *reader,
+		int                    i,
+		char                 **o_data,
+		size_t                *o_data_length);
+
+/*
+	Copies <i>-th file of <reader> into <zip> without decompressing and
+	recompressing.
+
+	The local file header, compressed data and data descriptor (if any) are
+	copied byte-for-byte, and the Central directory file header reuses the
+	original's CRC-32, sizes, compression method, times and attributes. So
+	this works with any compression method.
+*/
+int extract_zip_copy_file(
+		extract_zip_t        *zip,
+		extract_zip_reader_t *reader,
+		int                   i);
+
+/* Frees all data associated with *preader and sets *preader to NULL. */
+void extract_zip_reader_close(extract_zip_reader_t **preader);
+
 #endif